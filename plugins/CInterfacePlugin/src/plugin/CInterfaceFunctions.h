@@ -50,6 +50,9 @@ double CINTERFACE_API *GetDerivativesForState(double epoch, double state[],
 double CINTERFACE_API *GetDerivatives(double dt, int order, int *pdim);
 //double CINTERFACE_API *GetDerivatives(double dt, int order);
 
+int CINTERFACE_API SetForceProfiling(int onOff);
+const char CINTERFACE_API *GetForceProfile();
+
 int CINTERFACE_API CountObjects();
 const char CINTERFACE_API *GetObjectName(int which);
 const char CINTERFACE_API *GetRunSummary();
@@ -633,6 +633,56 @@ extern "C"
       return retval;
    }
 
+   //---------------------------------------------------------------------------
+   // int SetForceProfiling(int onOff)
+   //---------------------------------------------------------------------------
+   /**
+    * Turns the per-force profiling on or off for the current ODE model
+    *
+    * Turning profiling on or off clears the profile data collected so far.
+    *
+    * @param onOff Nonzero to turn profiling on, 0 to turn it off
+    *
+    * @return 0 on success, or a negative number on error
+    */
+   //---------------------------------------------------------------------------
+   int SetForceProfiling(int onOff)
+   {
+      if (ode == NULL)
+      {
+         lastMsg = "ERROR in SetForceProfiling: The ODE model is not yet set.";
+         return -1;
+      }
+
+      ode->SetOnOffParameter("ProfileForces", (onOff != 0 ? "On" : "Off"));
+      lastMsg = "Force profiling is ";
+      lastMsg += (onOff != 0 ? "on" : "off");
+
+      return 0;
+   }
+
+   //---------------------------------------------------------------------------
+   // const char *GetForceProfile()
+   //---------------------------------------------------------------------------
+   /**
+    * Retrieves the per-force call counts, timing and mean acceleration sizes
+    * collected for the current ODE model
+    *
+    * @return The force profile report
+    */
+   //---------------------------------------------------------------------------
+   const char *GetForceProfile()
+   {
+      if (ode == NULL)
+      {
+         lastMsg = "ERROR in GetForceProfile: The ODE model is not yet set.";
+         return lastMsg.c_str();
+      }
+
+      lastMsg = ode->GetStringParameter("ForceProfile");
+      return lastMsg.c_str();
+   }
+
    //---------------------------------------------------------------------------
    // int CountObjects()
    //---------------------------------------------------------------------------
@@ -24,6 +24,7 @@
 
 #include "MessageInterface.hpp"
 #include "ODEModel.hpp"
+#include "GmatConstants.hpp"
 
 //#define DEBUG_INITIALIZATION
 //#define DEBUG_EXECUTION
@@ -46,7 +47,8 @@ RunEstimator::RunEstimator() :
    bufferFilled            (false),
    currentEvent            (NULL),
    eventProcessComplete    (false),
-   eventMan                (NULL)
+   eventMan                (NULL),
+   trajectoryFilled        (false)
 {
    overridePropInit = true;
 }
@@ -85,7 +87,8 @@ RunEstimator::RunEstimator(const RunEstimator & rs) :
    bufferFilled            (false),
    currentEvent            (NULL),
    eventProcessComplete    (false),
-   eventMan                (NULL)
+   eventMan                (NULL),
+   trajectoryFilled        (false)
 {
    overridePropInit = true;
 }
@@ -117,6 +120,7 @@ RunEstimator& RunEstimator::operator=(const RunEstimator & rs)
       currentEvent     = NULL;
       eventProcessComplete = false;
       eventMan         = NULL;
+      trajectoryFilled = false;
    }
 
    return *this;
@@ -642,6 +646,8 @@ void RunEstimator::PrepareToEstimate()
    }
 
    estimationOffset = fm[0]->GetTime();
+   trajectoryFilled = false;
+   eventMan->SetTrajectoryStore(NULL);
 }
 
 
@@ -686,10 +692,31 @@ void RunEstimator::Propagate()
       fm[0]->UpdateFromSpaceObject();
       fm[0]->SetTime(estimationOffset);
       startNewPass = false;
+      trajectoryFilled = false;
+      eventMan->SetTrajectoryStore(NULL);
    }
 
    Real dt = theEstimator->GetTimeStep();
 
+   // When the estimator stores the trajectory, it is propagated across the
+   // observations once per pass and the measurement epochs are interpolated
+   Real nodeStep = theEstimator->GetTrajectoryStoreStep();
+   if (nodeStep > 0.0)
+   {
+      if (!trajectoryFilled)
+         FillTrajectory(nodeStep);
+
+      GmatEpoch nextEpoch = theEstimator->GetNextMeasurementEpoch();
+      if (trajectory.IsCovered(nextEpoch))
+      {
+         MoveAlongTrajectory(nextEpoch);
+         bufferFilled = false;
+
+         theEstimator->UpdateCurrentEpoch(currEpoch[0]);
+         return;
+      }
+   }
+
    // todo: This is a temporary fix; need to evaluate to find a more elegant
    //       solution here
    Real maxStep = 600.0;
@@ -702,6 +729,142 @@ void RunEstimator::Propagate()
 }
 
 
+//------------------------------------------------------------------------------
+// void FillTrajectory(Real nodeStep)
+//------------------------------------------------------------------------------
+/**
+ * Propagates across the observation span and stores the trajectory
+ *
+ * The propagation starts from the current state and runs to the earliest and
+ * to the latest observation, storing a node every nodeStep seconds.  The span
+ * is padded by one node on each side so that the light time offsets of the
+ * participants at the first and last observations are covered.  The
+ * propagator and the propagated objects are returned to the starting state
+ * afterwards.  Nothing is published while the nodes are generated.
+ *
+ * @param nodeStep The spacing of the nodes, in seconds
+ */
+//------------------------------------------------------------------------------
+void RunEstimator::FillTrajectory(Real nodeStep)
+{
+   ODEModel *ode = fm[0];
+   Integer size = ode->GetDimension();
+
+   trajectory.Initialize(size, ode->GetCartesianStart(),
+         ode->GetCartesianCount());
+   trajectoryFilled = true;
+
+   GmatEpoch firstEpoch, lastEpoch;
+   if (!theEstimator->GetMeasurementManager()->GetObservationSpan(firstEpoch,
+         lastEpoch))
+      return;
+   firstEpoch -= nodeStep / GmatTimeConstants::SECS_PER_DAY;
+   lastEpoch  += nodeStep / GmatTimeConstants::SECS_PER_DAY;
+
+   Real startTime = ode->GetTime();
+   GmatEpoch startEpoch = baseEpoch[0] + startTime /
+         GmatTimeConstants::SECS_PER_DAY;
+   RealArray startState(ode->GetState(), ode->GetState() + size);
+
+   bool wasPublishing = publishOnStep;
+   publishOnStep = false;
+
+   // Observations before the start are stored first; those nodes are reversed
+   // so that the later ones extend the store forward in time
+   for (Integer pass = 0; pass < 2; ++pass)
+   {
+      Real direction = (pass == 0 ? -1.0 : 1.0);
+      Real span = (pass == 0 ? firstEpoch - startEpoch : lastEpoch - startEpoch)
+            * GmatTimeConstants::SECS_PER_DAY * direction;
+      if (span <= 0.0)
+         continue;
+
+      if (trajectory.GetNodeCount() == 0)
+         StoreTrajectoryNode();
+
+      Integer stepCount = (Integer)ceil(span / nodeStep);
+      for (Integer i = 0; i < stepCount; ++i)
+      {
+         Real step = (i < stepCount - 1 ? nodeStep :
+               span - (stepCount - 1) * nodeStep);
+         Step(direction * step);
+         StoreTrajectoryNode();
+      }
+
+      if (pass == 0)
+         trajectory.Reverse();
+
+      memcpy(ode->GetState(), &startState[0], size * sizeof(Real));
+      ode->SetTime(startTime);
+      ode->UpdateSpaceObject(startEpoch);
+   }
+
+   elapsedTime[0] = startTime;
+   currEpoch[0] = startEpoch;
+   publishOnStep = wasPublishing;
+
+   // Event location uses the stored states as well
+   eventMan->SetTrajectoryStore(&trajectory);
+
+   #ifdef DEBUG_EXECUTION
+      MessageInterface::ShowMessage("RunEstimator stored %d trajectory nodes "
+            "spanning %.12lf to %.12lf\n", trajectory.GetNodeCount(),
+            firstEpoch, lastEpoch);
+   #endif
+}
+
+
+//------------------------------------------------------------------------------
+// void StoreTrajectoryNode()
+//------------------------------------------------------------------------------
+/**
+ * Adds the current propagation state and its derivative to the trajectory
+ */
+//------------------------------------------------------------------------------
+void RunEstimator::StoreTrajectoryNode()
+{
+   ODEModel *ode = fm[0];
+   Real *state = ode->GetState();
+
+   if (!ode->GetDerivatives(state, 0.0))
+      throw CommandException("The RunEstimator command could not evaluate "
+            "the derivatives for the stored trajectory");
+
+   trajectory.AddNode(baseEpoch[0] + ode->GetTime() /
+         GmatTimeConstants::SECS_PER_DAY, state, ode->GetDerivativeArray());
+}
+
+
+//------------------------------------------------------------------------------
+// void MoveAlongTrajectory(GmatEpoch toEpoch)
+//------------------------------------------------------------------------------
+/**
+ * Sets the propagation state and the propagated objects from the stored
+ * trajectory, standing in for a propagation step to the input epoch.
+ *
+ * @param toEpoch The (a.1 modified Julian) epoch of the new state
+ */
+//------------------------------------------------------------------------------
+void RunEstimator::MoveAlongTrajectory(GmatEpoch toEpoch)
+{
+   ODEModel *ode = fm[0];
+
+   trajectory.Interpolate(toEpoch, ode->GetState());
+
+   elapsedTime[0] = (toEpoch - baseEpoch[0]) * GmatTimeConstants::SECS_PER_DAY;
+   currEpoch[0] = toEpoch;
+   ode->SetTime(elapsedTime[0]);
+   ode->UpdateSpaceObject(toEpoch);
+
+   if (publishOnStep)
+   {
+      pubdata[0] = currEpoch[0];
+      memcpy(&pubdata[1], j2kState, dim*sizeof(Real));
+      publisher->Publish(this, streamID, pubdata, dim+1);
+   }
+}
+
+
 //------------------------------------------------------------------------------
 // void Calculate()
 //------------------------------------------------------------------------------
@@ -28,6 +28,7 @@
 #include "PropSetup.hpp"
 #include "Estimator.hpp"
 #include "EventManager.hpp"
+#include "TrajectoryStore.hpp"
 
 
 /**
@@ -97,6 +98,11 @@ protected:
    /// Time different used while running the event code
    Real dt;
 
+   /// Trajectory across the observations, used when the estimator stores one
+   TrajectoryStore trajectory;
+   /// Flag indicating that the trajectory has been stored for this pass
+   bool trajectoryFilled;
+
    // Methods called by specific states of the finite state machine
    void PrepareToEstimate();
    void Propagate();
@@ -110,6 +116,9 @@ protected:
    // Helper methods
    virtual void SetPropagationProperties(PropagationStateManager *psm);
    virtual void CleanUpEvents();
+   void FillTrajectory(Real nodeStep);
+   void StoreTrajectoryNode();
+   void MoveAlongTrajectory(GmatEpoch toEpoch);
 };
 
 #endif /* RunEstimator_hpp */
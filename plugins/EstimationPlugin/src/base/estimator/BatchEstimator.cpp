@@ -54,6 +54,8 @@ BatchEstimator::PARAMETER_TEXT[] =
 {
    "EstimationEpochFormat",         // The epoch of the solution
    "EstimationEpoch",         // The epoch of the solution
+   "TrajectoryStore",         // Interpolate a stored trajectory on each pass
+   "TrajectoryStoreStep",     // Spacing of the stored trajectory nodes
    // todo Add useApriori here
 };
 
@@ -62,6 +64,8 @@ BatchEstimator::PARAMETER_TYPE[] =
 {
    Gmat::STRING_TYPE,
    Gmat::STRING_TYPE,
+   Gmat::ON_OFF_TYPE,
+   Gmat::REAL_TYPE,
 };
 
 
@@ -84,7 +88,9 @@ BatchEstimator::BatchEstimator(const std::string &type,
    newResidualRMS             (1.0e12),
    useApriori                 (true),
    advanceToEstimationEpoch   (false),
-   converged                  (false)
+   converged                  (false),
+   useTrajectoryStore         (false),
+   trajectoryStoreStep        (60.0)
 {
    objectTypeNames.push_back("BatchEstimator");
    parameterCount = BatchEstimatorParamCount;
@@ -123,7 +129,9 @@ BatchEstimator::BatchEstimator(const BatchEstimator& est) :
    newResidualRMS             (1.0e12),
    useApriori                 (est.useApriori),
    advanceToEstimationEpoch   (false),
-   converged                  (false)
+   converged                  (false),
+   useTrajectoryStore         (est.useTrajectoryStore),
+   trajectoryStoreStep        (est.trajectoryStoreStep)
 {
    // Clear the loop buffer
    for (UnsignedInt i = 0; i < outerLoopBuffer.size(); ++i)
@@ -155,6 +163,8 @@ BatchEstimator& BatchEstimator::operator=(const BatchEstimator& est)
       oldResidualRMS = 0.0;
       newResidualRMS = 1.0e12;
       useApriori     = est.useApriori;
+      useTrajectoryStore  = est.useTrajectoryStore;
+      trajectoryStoreStep = est.trajectoryStoreStep;
 
       advanceToEstimationEpoch = false;
       converged                = false;
@@ -264,6 +274,51 @@ std::string BatchEstimator::GetParameterTypeString(const Integer id) const
 }
 
 
+//------------------------------------------------------------------------------
+//  Real GetRealParameter(const Integer id) const
+//------------------------------------------------------------------------------
+/**
+ * This method returns the Real parameter value, given the input parameter ID.
+ *
+ * @param id ID for the requested parameter value.
+ *
+ * @return  Real value of the requested parameter.
+ */
+//------------------------------------------------------------------------------
+Real BatchEstimator::GetRealParameter(const Integer id) const
+{
+   if (id == TRAJECTORY_STORE_STEP)
+      return trajectoryStoreStep;
+
+   return Estimator::GetRealParameter(id);
+}
+
+
+//------------------------------------------------------------------------------
+//  Real SetRealParameter(const Integer id, const Real value)
+//------------------------------------------------------------------------------
+/**
+ * This method sets the Real parameter value, given the input parameter ID.
+ *
+ * @param id ID for the parameter whose value to change.
+ * @param value Value for the parameter.
+ *
+ * @return  Real value of the requested parameter.
+ */
+//------------------------------------------------------------------------------
+Real BatchEstimator::SetRealParameter(const Integer id, const Real value)
+{
+   if (id == TRAJECTORY_STORE_STEP)
+   {
+      if (value > 0.0)
+         trajectoryStoreStep = value;
+      return trajectoryStoreStep;
+   }
+
+   return Estimator::SetRealParameter(id, value);
+}
+
+
 //------------------------------------------------------------------------------
 // std::string GetStringParameter(const Integer id) const
 //------------------------------------------------------------------------------
@@ -455,6 +510,97 @@ bool BatchEstimator::SetStringParameter(const std::string &label,
 }
 
 
+//------------------------------------------------------------------------------
+// std::string GetOnOffParameter(const Integer id) const
+//------------------------------------------------------------------------------
+/**
+ * Retrieves boolean parameters that are scripted using the words On and Off
+ *
+ * @param id The ID of the parameter
+ *
+ * @return the word "On" or "Off"
+ */
+//------------------------------------------------------------------------------
+std::string BatchEstimator::GetOnOffParameter(const Integer id) const
+{
+   if (id == TRAJECTORY_STORE)
+      return (useTrajectoryStore ? "On" : "Off");
+
+   return Estimator::GetOnOffParameter(id);
+}
+
+
+//------------------------------------------------------------------------------
+// bool SetOnOffParameter(const Integer id, const std::string &value)
+//------------------------------------------------------------------------------
+/**
+ * Sets boolean parameters that are scripted using the words On and Off
+ *
+ * @param id The ID of the parameter
+ * @param value The new setting, "On" or "Off"
+ *
+ * @return true on success, false if the parameter was not set
+ */
+//------------------------------------------------------------------------------
+bool BatchEstimator::SetOnOffParameter(const Integer id,
+      const std::string &value)
+{
+   if (id == TRAJECTORY_STORE)
+   {
+      if (value == "On")
+      {
+         useTrajectoryStore = true;
+         return true;
+      }
+      else if (value == "Off")
+      {
+         useTrajectoryStore = false;
+         return true;
+      }
+
+      return false;
+   }
+
+   return Estimator::SetOnOffParameter(id, value);
+}
+
+
+//------------------------------------------------------------------------------
+// std::string GetOnOffParameter(const std::string &label) const
+//------------------------------------------------------------------------------
+/**
+ * Retrieves boolean parameters that are scripted using the words On and Off
+ *
+ * @param label The string used to script the parameter
+ *
+ * @return The word "On" or "Off"
+ */
+//------------------------------------------------------------------------------
+std::string BatchEstimator::GetOnOffParameter(const std::string &label) const
+{
+   return GetOnOffParameter(GetParameterID(label));
+}
+
+
+//------------------------------------------------------------------------------
+// bool SetOnOffParameter(const std::string &label, const std::string &value)
+//------------------------------------------------------------------------------
+/**
+ * Sets boolean parameters that are scripted using the words On and Off
+ *
+ * @param label The string used to script the parameter
+ * @param value The new setting, "On" or "Off"
+ *
+ * @return true on success, false if the parameter was not set
+ */
+//------------------------------------------------------------------------------
+bool BatchEstimator::SetOnOffParameter(const std::string &label,
+      const std::string &value)
+{
+   return SetOnOffParameter(GetParameterID(label), value);
+}
+
+
 //------------------------------------------------------------------------------
 // const StringArray& GetPropertyEnumStrings(const Integer id) const
 //------------------------------------------------------------------------------
@@ -525,6 +671,27 @@ bool BatchEstimator::TakeAction(const std::string &action,
 }
 
 
+//------------------------------------------------------------------------------
+//  Real GetTrajectoryStoreStep()
+//------------------------------------------------------------------------------
+/**
+ * Returns the node spacing for the stored trajectory
+ *
+ * The trajectory is only stored once the state is at the estimation epoch and
+ * the observations are loaded, so this method returns 0.0 while the
+ * propagator is advancing to the estimation epoch.
+ *
+ * @return The node spacing in seconds, or 0.0 if no trajectory is stored
+ */
+//------------------------------------------------------------------------------
+Real BatchEstimator::GetTrajectoryStoreStep()
+{
+   if (!useTrajectoryStore || advanceToEstimationEpoch)
+      return 0.0;
+   return trajectoryStoreStep;
+}
+
+
 //------------------------------------------------------------------------------
 //  bool Initialize()
 //------------------------------------------------------------------------------
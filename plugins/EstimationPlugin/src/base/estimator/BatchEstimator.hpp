@@ -62,6 +62,10 @@ public:
                         GetParameterType(const Integer id) const;
    virtual std::string  GetParameterTypeString(const Integer id) const;
 
+   virtual Real         GetRealParameter(const Integer id) const;
+   virtual Real         SetRealParameter(const Integer id,
+                                         const Real value);
+
    virtual std::string  GetStringParameter(const Integer id) const;
    virtual bool         SetStringParameter(const Integer id,
                                            const std::string &value);
@@ -78,11 +82,19 @@ public:
    virtual bool         SetStringParameter(const std::string &label,
                                            const std::string &value,
                                            const Integer index);
+   virtual std::string  GetOnOffParameter(const Integer id) const;
+   virtual bool         SetOnOffParameter(const Integer id,
+                                          const std::string &value);
+   virtual std::string  GetOnOffParameter(const std::string &label) const;
+   virtual bool         SetOnOffParameter(const std::string &label,
+                                          const std::string &value);
    virtual const StringArray& GetPropertyEnumStrings(const Integer id) const;
 
    virtual bool         TakeAction(const std::string &action,
                                    const std::string &actionData = "");
 
+   virtual Real         GetTrajectoryStoreStep();
+
 protected:
    /// Time system used to specify the estimation epoch
    std::string             estEpochFormat;
@@ -104,12 +116,18 @@ protected:
    bool                    converged;
    /// Buffer of the participants for the outer batch loop
    ObjectArray             outerLoopBuffer;
+   /// Flag set to propagate once per pass and interpolate to the measurements
+   bool                    useTrajectoryStore;
+   /// Spacing, in seconds, of the stored trajectory nodes
+   Real                    trajectoryStoreStep;
 
    /// Parameter IDs for the BatchEstimators
    enum
    {
       ESTIMATION_EPOCH_FORMAT = EstimatorParamCount,
       ESTIMATION_EPOCH,
+      TRAJECTORY_STORE,
+      TRAJECTORY_STORE_STEP,
       BatchEstimatorParamCount,
    };
 
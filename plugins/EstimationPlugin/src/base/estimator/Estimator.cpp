@@ -1137,6 +1137,40 @@ Real Estimator::GetTimeStep()
 }
 
 
+//------------------------------------------------------------------------------
+//  Real GetTrajectoryStoreStep()
+//------------------------------------------------------------------------------
+/**
+ * Returns the node spacing used when the trajectory across the observations is
+ * propagated once and interpolated at the measurement epochs.
+ *
+ * This default version returns 0.0, so the propagator is stepped to each
+ * measurement epoch.
+ *
+ * @return The node spacing in seconds, or 0.0 if no trajectory is stored
+ */
+//------------------------------------------------------------------------------
+Real Estimator::GetTrajectoryStoreStep()
+{
+   return 0.0;
+}
+
+
+//------------------------------------------------------------------------------
+//  GmatEpoch GetNextMeasurementEpoch()
+//------------------------------------------------------------------------------
+/**
+ * Returns the epoch of the next measurement that the estimator will process
+ *
+ * @return The (a.1 modified Julian) epoch, or 0.0 when the data are exhausted
+ */
+//------------------------------------------------------------------------------
+GmatEpoch Estimator::GetNextMeasurementEpoch()
+{
+   return nextMeasurementEpoch;
+}
+
+
 //------------------------------------------------------------------------------
 // bool ResetState()
 //------------------------------------------------------------------------------
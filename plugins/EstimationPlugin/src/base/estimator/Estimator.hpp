@@ -100,6 +100,8 @@ public:
    virtual ObjectArray& GetRefObjectArray(const std::string& typeString);
 
    Real                 GetTimeStep();
+   virtual Real         GetTrajectoryStoreStep();
+   GmatEpoch            GetNextMeasurementEpoch();
 
    virtual bool         TakeAction(const std::string &action,
                                    const std::string &actionData = "");
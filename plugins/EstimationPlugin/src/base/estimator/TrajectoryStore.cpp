@@ -0,0 +1,352 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                           TrajectoryStore
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002-2011 United States Government as represented by the
+// Administrator of The National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Created: 2026/10/18
+//
+/**
+ * Implementation of the TrajectoryStore class
+ */
+//------------------------------------------------------------------------------
+
+
+#include "TrajectoryStore.hpp"
+#include "GmatConstants.hpp"
+#include <algorithm>             // for upper_bound() and swap_ranges()
+
+//#define DEBUG_TRAJECTORY_STORE
+
+#ifdef DEBUG_TRAJECTORY_STORE
+   #include "MessageInterface.hpp"
+#endif
+
+
+//------------------------------------------------------------------------------
+// static data
+//------------------------------------------------------------------------------
+
+const Real TrajectoryStore::COVERAGE_TOLERANCE = 1.0e-3;
+
+
+//------------------------------------------------------------------------------
+// TrajectoryStore()
+//------------------------------------------------------------------------------
+/**
+ * Default constructor
+ */
+//------------------------------------------------------------------------------
+TrajectoryStore::TrajectoryStore() :
+   stateSize         (0),
+   cartesianStart    (-1),
+   cartesianCount    (0)
+{
+}
+
+
+//------------------------------------------------------------------------------
+// ~TrajectoryStore()
+//------------------------------------------------------------------------------
+/**
+ * Destructor
+ */
+//------------------------------------------------------------------------------
+TrajectoryStore::~TrajectoryStore()
+{
+}
+
+
+//------------------------------------------------------------------------------
+// TrajectoryStore(const TrajectoryStore& ts)
+//------------------------------------------------------------------------------
+/**
+ * Copy constructor
+ *
+ * @param ts The TrajectoryStore that is copied
+ */
+//------------------------------------------------------------------------------
+TrajectoryStore::TrajectoryStore(const TrajectoryStore& ts) :
+   stateSize         (ts.stateSize),
+   cartesianStart    (ts.cartesianStart),
+   cartesianCount    (ts.cartesianCount),
+   epochs            (ts.epochs),
+   states            (ts.states),
+   derivatives       (ts.derivatives)
+{
+}
+
+
+//------------------------------------------------------------------------------
+// TrajectoryStore& operator=(const TrajectoryStore& ts)
+//------------------------------------------------------------------------------
+/**
+ * Assignment operator
+ *
+ * @param ts The TrajectoryStore that supplies the data for this one
+ *
+ * @return This TrajectoryStore, configured to match ts
+ */
+//------------------------------------------------------------------------------
+TrajectoryStore& TrajectoryStore::operator=(const TrajectoryStore& ts)
+{
+   if (this != &ts)
+   {
+      stateSize      = ts.stateSize;
+      cartesianStart = ts.cartesianStart;
+      cartesianCount = ts.cartesianCount;
+      epochs         = ts.epochs;
+      states         = ts.states;
+      derivatives    = ts.derivatives;
+   }
+
+   return *this;
+}
+
+
+//------------------------------------------------------------------------------
+// void Initialize(Integer size, Integer cartStart, Integer cartCount)
+//------------------------------------------------------------------------------
+/**
+ * Empties the store and sets the layout of the states it will hold
+ *
+ * @param size      The number of elements in each state
+ * @param cartStart Index of the first Cartesian element, or -1 if there are none
+ * @param cartCount Number of consecutive 6 element Cartesian states
+ */
+//------------------------------------------------------------------------------
+void TrajectoryStore::Initialize(Integer size, Integer cartStart,
+      Integer cartCount)
+{
+   Clear();
+
+   stateSize      = size;
+   cartesianStart = cartStart;
+   cartesianCount = cartCount;
+
+   // Without a valid layout, all elements use the cubic interpolant
+   if ((cartesianStart < 0) || (cartesianStart + 6 * cartesianCount > size))
+      cartesianCount = 0;
+}
+
+
+//------------------------------------------------------------------------------
+// void Clear()
+//------------------------------------------------------------------------------
+/**
+ * Removes all of the nodes
+ */
+//------------------------------------------------------------------------------
+void TrajectoryStore::Clear()
+{
+   epochs.clear();
+   states.clear();
+   derivatives.clear();
+}
+
+
+//------------------------------------------------------------------------------
+// void AddNode(GmatEpoch epoch, const Real *state, const Real *derivative)
+//------------------------------------------------------------------------------
+/**
+ * Appends a node to the store
+ *
+ * Nodes are added in the order they are propagated.  Nodes propagated
+ * backwards in time are put into time order by calling Reverse() once they
+ * are all added.
+ *
+ * @param epoch      The (a.1 modified Julian) epoch of the node
+ * @param state      The state at the node; stateSize elements
+ * @param derivative The time derivative of the state, per second
+ */
+//------------------------------------------------------------------------------
+void TrajectoryStore::AddNode(GmatEpoch epoch, const Real *state,
+      const Real *derivative)
+{
+   epochs.push_back(epoch);
+   states.insert(states.end(), state, state + stateSize);
+   derivatives.insert(derivatives.end(), derivative, derivative + stateSize);
+}
+
+
+//------------------------------------------------------------------------------
+// void Reverse()
+//------------------------------------------------------------------------------
+/**
+ * Reverses the order of the nodes
+ */
+//------------------------------------------------------------------------------
+void TrajectoryStore::Reverse()
+{
+   Integer count = epochs.size();
+
+   for (Integer i = 0, j = count - 1; i < j; ++i, --j)
+   {
+      std::swap(epochs[i], epochs[j]);
+      std::swap_ranges(states.begin() + i * stateSize,
+            states.begin() + (i + 1) * stateSize,
+            states.begin() + j * stateSize);
+      std::swap_ranges(derivatives.begin() + i * stateSize,
+            derivatives.begin() + (i + 1) * stateSize,
+            derivatives.begin() + j * stateSize);
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// Integer GetNodeCount() const
+//------------------------------------------------------------------------------
+/**
+ * Retrieves the number of stored nodes
+ *
+ * @return The node count
+ */
+//------------------------------------------------------------------------------
+Integer TrajectoryStore::GetNodeCount() const
+{
+   return epochs.size();
+}
+
+
+//------------------------------------------------------------------------------
+// Integer GetStateSize() const
+//------------------------------------------------------------------------------
+/**
+ * Retrieves the number of elements in each stored state
+ *
+ * @return The state size
+ */
+//------------------------------------------------------------------------------
+Integer TrajectoryStore::GetStateSize() const
+{
+   return stateSize;
+}
+
+
+//------------------------------------------------------------------------------
+// bool IsCovered(GmatEpoch epoch) const
+//------------------------------------------------------------------------------
+/**
+ * Checks that an epoch lies within the span of the nodes
+ *
+ * @param epoch The (a.1 modified Julian) epoch to check
+ *
+ * @return true if the state at the epoch can be interpolated
+ */
+//------------------------------------------------------------------------------
+bool TrajectoryStore::IsCovered(GmatEpoch epoch) const
+{
+   if (epochs.empty())
+      return false;
+
+   Real tolerance = COVERAGE_TOLERANCE / GmatTimeConstants::SECS_PER_DAY;
+   return ((epoch >= epochs.front() - tolerance) &&
+           (epoch <= epochs.back() + tolerance));
+}
+
+
+//------------------------------------------------------------------------------
+// bool Interpolate(GmatEpoch epoch, Real *state) const
+//------------------------------------------------------------------------------
+/**
+ * Interpolates the stored trajectory
+ *
+ * @param epoch The (a.1 modified Julian) epoch of the requested state
+ * @param state Array of stateSize elements that receives the state
+ *
+ * @return true if the state was set, false if the epoch is not covered
+ */
+//------------------------------------------------------------------------------
+bool TrajectoryStore::Interpolate(GmatEpoch epoch, Real *state) const
+{
+   if (!IsCovered(epoch))
+      return false;
+
+   if (epochs.size() == 1)
+   {
+      std::copy(states.begin(), states.end(), state);
+      return true;
+   }
+
+   Integer i = FindInterval(epoch);
+   const Real *x0 = &states[i * stateSize];
+   const Real *x1 = &states[(i + 1) * stateSize];
+   const Real *d0 = &derivatives[i * stateSize];
+   const Real *d1 = &derivatives[(i + 1) * stateSize];
+
+   Real h = (epochs[i+1] - epochs[i]) * GmatTimeConstants::SECS_PER_DAY;
+   Real s = (epoch - epochs[i]) / (epochs[i+1] - epochs[i]);
+   Real s2 = s * s, s3 = s2 * s, s4 = s3 * s, s5 = s4 * s;
+
+   Real c0 = 2.0 * s3 - 3.0 * s2 + 1.0;
+   Real c1 = (s3 - 2.0 * s2 + s) * h;
+   Real c2 = 3.0 * s2 - 2.0 * s3;
+   Real c3 = (s3 - s2) * h;
+   for (Integer j = 0; j < stateSize; ++j)
+      state[j] = c0 * x0[j] + c1 * d0[j] + c2 * x1[j] + c3 * d1[j];
+
+   // Quintic position weights and their time derivatives
+   Real q0 = 1.0 - 10.0 * s3 + 15.0 * s4 - 6.0 * s5;
+   Real q1 = (s - 6.0 * s3 + 8.0 * s4 - 3.0 * s5) * h;
+   Real q2 = (0.5 * s2 - 1.5 * s3 + 1.5 * s4 - 0.5 * s5) * h * h;
+   Real q3 = (0.5 * s3 - s4 + 0.5 * s5) * h * h;
+   Real q4 = (-4.0 * s3 + 7.0 * s4 - 3.0 * s5) * h;
+   Real q5 = 10.0 * s3 - 15.0 * s4 + 6.0 * s5;
+
+   Real r0 = (-30.0 * s2 + 60.0 * s3 - 30.0 * s4) / h;
+   Real r1 = 1.0 - 18.0 * s2 + 32.0 * s3 - 15.0 * s4;
+   Real r2 = (s - 4.5 * s2 + 6.0 * s3 - 2.5 * s4) * h;
+   Real r3 = (1.5 * s2 - 4.0 * s3 + 2.5 * s4) * h;
+   Real r4 = -12.0 * s2 + 28.0 * s3 - 15.0 * s4;
+
+   for (Integer j = 0; j < cartesianCount; ++j)
+   {
+      for (Integer k = cartesianStart + 6 * j;
+           k < cartesianStart + 6 * j + 3; ++k)
+      {
+         Integer v = k + 3;
+         state[k] = q0 * x0[k] + q1 * x0[v] + q2 * d0[v] + q3 * d1[v] +
+                    q4 * x1[v] + q5 * x1[k];
+         state[v] = r0 * (x0[k] - x1[k]) + r1 * x0[v] + r2 * d0[v] +
+                    r3 * d1[v] + r4 * x1[v];
+      }
+   }
+
+   #ifdef DEBUG_TRAJECTORY_STORE
+      MessageInterface::ShowMessage("TrajectoryStore::Interpolate(%.12lf) "
+            "used nodes %d and %d, s = %.6lf\n", epoch, i, i+1, s);
+   #endif
+
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// Integer FindInterval(GmatEpoch epoch) const
+//------------------------------------------------------------------------------
+/**
+ * Finds the pair of nodes that bracket an epoch
+ *
+ * Epochs just outside of the span use the end intervals.
+ *
+ * @param epoch The (a.1 modified Julian) epoch
+ *
+ * @return The index of the first node of the interval
+ */
+//------------------------------------------------------------------------------
+Integer TrajectoryStore::FindInterval(GmatEpoch epoch) const
+{
+   Integer index = std::upper_bound(epochs.begin(), epochs.end(), epoch) -
+         epochs.begin() - 1;
+
+   if (index < 0)
+      index = 0;
+   if (index > (Integer)epochs.size() - 2)
+      index = epochs.size() - 2;
+
+   return index;
+}
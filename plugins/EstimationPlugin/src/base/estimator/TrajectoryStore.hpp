@@ -0,0 +1,80 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                           TrajectoryStore
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002-2011 United States Government as represented by the
+// Administrator of The National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Created: 2026/10/18
+//
+/**
+ * Definition of the TrajectoryStore class
+ */
+//------------------------------------------------------------------------------
+
+
+#ifndef TrajectoryStore_hpp
+#define TrajectoryStore_hpp
+
+#include "estimation_defs.hpp"
+#include "gmatdefs.hpp"
+
+
+/**
+ * Propagation states and their derivatives stored on a grid of epochs
+ *
+ * A batch estimator processes the same span of observations on every pass.
+ * The TrajectoryStore holds the propagated state, including the state
+ * transition matrix, at nodes spanning the observations so that the states at
+ * the observation epochs are found by interpolation rather than by stepping
+ * the integrator to each one.
+ *
+ * Every element is interpolated with a cubic Hermite polynomial built from the
+ * values and derivatives at the ends of the interval containing the requested
+ * epoch.  Cartesian positions also use the accelerations, giving a quintic
+ * polynomial, and the velocities are taken from its derivative.
+ */
+class ESTIMATION_API TrajectoryStore
+{
+public:
+   TrajectoryStore();
+   virtual ~TrajectoryStore();
+   TrajectoryStore(const TrajectoryStore& ts);
+   TrajectoryStore& operator=(const TrajectoryStore& ts);
+
+   void           Initialize(Integer size, Integer cartStart,
+                             Integer cartCount);
+   void           Clear();
+   void           AddNode(GmatEpoch epoch, const Real *state,
+                          const Real *derivative);
+   void           Reverse();
+
+   Integer        GetNodeCount() const;
+   Integer        GetStateSize() const;
+   bool           IsCovered(GmatEpoch epoch) const;
+   bool           Interpolate(GmatEpoch epoch, Real *state) const;
+
+   /// Distance, in seconds, past the end nodes that is still covered
+   static const Real       COVERAGE_TOLERANCE;
+
+protected:
+   /// Number of elements in each stored state
+   Integer                 stateSize;
+   /// Index of the first Cartesian element in the state
+   Integer                 cartesianStart;
+   /// Number of Cartesian (6 element) states in the state
+   Integer                 cartesianCount;
+   /// Epochs of the nodes
+   RealArray               epochs;
+   /// The states at the nodes, stateSize elements per node
+   RealArray               states;
+   /// The time derivatives of the states at the nodes
+   RealArray               derivatives;
+
+   Integer                 FindInterval(GmatEpoch epoch) const;
+};
+
+#endif /* TrajectoryStore_hpp */
@@ -37,7 +37,8 @@
  */
 //------------------------------------------------------------------------------
 EstimationRootFinder::EstimationRootFinder() :
-   propagator        (NULL)
+   propagator        (NULL),
+   trajectory        (NULL)
 {
 }
 
@@ -61,7 +62,8 @@ EstimationRootFinder::~EstimationRootFinder()
  * Copy constructor
  */
 //------------------------------------------------------------------------------
-EstimationRootFinder::EstimationRootFinder(const EstimationRootFinder& rl)
+EstimationRootFinder::EstimationRootFinder(const EstimationRootFinder& rl) :
+   trajectory        (NULL)
 {
 }
 
@@ -82,6 +84,7 @@ EstimationRootFinder& EstimationRootFinder::operator =(const EstimationRootFinde
    if (this != &rl)
    {
       propagator = NULL;
+      trajectory = NULL;
    }
 
    return *this;
@@ -112,6 +115,21 @@ void EstimationRootFinder::SetPropSetup(PropSetup* ps)
 }
 
 
+//------------------------------------------------------------------------------
+// void SetTrajectoryStore(TrajectoryStore *ts)
+//------------------------------------------------------------------------------
+/**
+ * Sets a stored trajectory that replaces propagation where it is covered
+ *
+ * @param ts The stored trajectory, or NULL to propagate for every state
+ */
+//------------------------------------------------------------------------------
+void EstimationRootFinder::SetTrajectoryStore(TrajectoryStore *ts)
+{
+   trajectory = ts;
+}
+
+
 //-----------------------------------------------------------------------------
 // void EstimationRootFinder::FixState(Event *thisOne)
 //-----------------------------------------------------------------------------
@@ -119,8 +137,9 @@ void EstimationRootFinder::SetPropSetup(PropSetup* ps)
  * Fixes state data for an event
  *
  * This method tells the input Event to set the state data for its fixed states
- * for use during the event location process.  The method propagates to the
- * fixed state epoch if propagation is needed.
+ * for use during the event location process.  The method moves to the
+ * fixed state epoch if needed, interpolating the stored trajectory when it
+ * covers that epoch and propagating otherwise.
  *
  * @param thisOne The Event that needs to fix some state data
  */
@@ -142,14 +161,17 @@ void EstimationRootFinder::FixState(Event *thisOne)
       #ifdef DEBUG_FIXED_STEP
          MessageInterface::ShowMessage("   Stepping %.12lf ", dt);
       #endif
-      // Propagate by dt
-      propagator->GetPropagator()->Step(dt);
       // Need fixed time offset here as well
       newEpoch += dt/GmatTimeConstants::SECS_PER_DAY;
       #ifdef DEBUG_FIXED_STEP
          MessageInterface::ShowMessage("to epoch %.12lf\n", newEpoch);
       #endif
-      ode->UpdateSpaceObject(newEpoch);
+      if (!InterpolateState(newEpoch, dt))
+      {
+         // Propagate by dt
+         propagator->GetPropagator()->Step(dt);
+         ode->UpdateSpaceObject(newEpoch);
+      }
    }
 
    thisOne->FixState();
@@ -203,7 +225,9 @@ Real EstimationRootFinder::Locate(ObjectArray &whichOnes)
  * time step in the search does not add to this fixed time step when propagation
  * is performed.  Instead, the propagation to the variable time is applied to
  * the initial state.  The implementation does it this way to minimize round-off
- * errors from multiple propagation step accumulations.
+ * errors from multiple propagation step accumulations.  When a stored
+ * trajectory covers the epoch of the attempt, the state is interpolated from
+ * it and no propagation is performed.
  *
  * @param whichOne The index of the root that is being located
  *
@@ -226,13 +250,15 @@ Real EstimationRootFinder::FindRoot(Integer whichOne)
       MessageInterface::ShowMessage("   timestep = %.12le\n", dt);
    #endif
 
-   // Propagate by dt
-   propagator->GetPropagator()->Step(dtFixed + dt);
-
-
    // Need fixed time offset here as well
    Real newEpoch = (*events)[whichOne]->GetFixedEpoch() + dt/GmatTimeConstants::SECS_PER_DAY;
-   propagator->GetODEModel()->UpdateSpaceObject(newEpoch);
+
+   if (!InterpolateState(newEpoch, dtFixed + dt))
+   {
+      // Propagate by dt
+      propagator->GetPropagator()->Step(dtFixed + dt);
+      propagator->GetODEModel()->UpdateSpaceObject(newEpoch);
+   }
 
    #ifdef DEBUG_ROOT_SEARCH
       Real ef = (*events)[whichOne]->Evaluate();
@@ -244,6 +270,43 @@ Real EstimationRootFinder::FindRoot(Integer whichOne)
 }
 
 
+//------------------------------------------------------------------------------
+// bool InterpolateState(GmatEpoch toEpoch, Real dt)
+//------------------------------------------------------------------------------
+/**
+ * Sets the propagated state from the stored trajectory
+ *
+ * The ODEModel time is advanced by dt, as a propagation step of that size
+ * would have done, and the propagated objects are updated to the new epoch.
+ *
+ * @param toEpoch The (a.1 modified Julian) epoch of the state
+ * @param dt      The time from the current state to toEpoch, in seconds
+ *
+ * @return true if the state was interpolated, false if propagation is needed
+ */
+//------------------------------------------------------------------------------
+bool EstimationRootFinder::InterpolateState(GmatEpoch toEpoch, Real dt)
+{
+   if ((trajectory == NULL) || !trajectory->IsCovered(toEpoch))
+      return false;
+
+   ODEModel *ode = propagator->GetODEModel();
+   if (trajectory->GetStateSize() != ode->GetDimension())
+      return false;
+
+   trajectory->Interpolate(toEpoch, ode->GetState());
+   ode->SetTime(ode->GetTime() + dt);
+   ode->UpdateSpaceObject(toEpoch);
+
+   #ifdef DEBUG_ROOT_SEARCH
+      MessageInterface::ShowMessage("   Interpolated the state at epoch "
+            "%.12lf\n", toEpoch);
+   #endif
+
+   return true;
+}
+
+
 //------------------------------------------------------------------------------
 // void BufferSatelliteStates(bool fillingBuffer)
 //------------------------------------------------------------------------------
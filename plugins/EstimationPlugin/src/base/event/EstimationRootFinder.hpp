@@ -31,6 +31,7 @@
 #include "ODEModel.hpp"
 #include "GmatState.hpp"
 #include "Event.hpp"
+#include "TrajectoryStore.hpp"
 
 #include "Spacecraft.hpp"
 #include "Formation.hpp"
@@ -48,6 +49,7 @@ public:
    EstimationRootFinder& operator=(const EstimationRootFinder& rl);
 
    virtual void SetPropSetup(PropSetup* ps);
+   virtual void SetTrajectoryStore(TrajectoryStore *ts);
    virtual void FixState(Event *thisOne);
    virtual Real Locate(ObjectArray &whichOnes);
 
@@ -65,8 +67,11 @@ protected:
    std::vector<Formation *>     formBuffer;
    /// The current set of events that the EstimationRootFinder is using
    std::vector<Event*> *events;
+   /// Stored trajectory used in place of propagation, or NULL
+   TrajectoryStore *trajectory;
 
    virtual Real FindRoot(Integer whichOne);
+   bool InterpolateState(GmatEpoch toEpoch, Real dt);
    virtual void BufferSatelliteStates(bool fillingBuffer);
 };
 
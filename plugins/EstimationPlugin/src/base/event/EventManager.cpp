@@ -250,6 +250,22 @@ void EventManager::SetFixedState(Event *thisOne)
 }
 
 
+//-----------------------------------------------------------------------------
+// void SetTrajectoryStore(TrajectoryStore *ts)
+//-----------------------------------------------------------------------------
+/**
+ * Passes a stored trajectory to the root finder, which interpolates it in
+ * place of propagation
+ *
+ * @param ts The stored trajectory, or NULL to always propagate
+ */
+//-----------------------------------------------------------------------------
+void EventManager::SetTrajectoryStore(TrajectoryStore *ts)
+{
+   locater.SetTrajectoryStore(ts);
+}
+
+
 //-----------------------------------------------------------------------------
 // Real FindRoot(Integer whichOne)
 //-----------------------------------------------------------------------------
@@ -50,6 +50,7 @@ public:
    virtual TriggerManager* Clone();
 
    virtual void SetFixedState(Event *thisOne);
+   void SetTrajectoryStore(TrajectoryStore *ts);
    Real FindRoot(Integer whichOne);
    RealArray EvaluateEvent(Integer whichOne);
    const IntegerArray& GetStatus();
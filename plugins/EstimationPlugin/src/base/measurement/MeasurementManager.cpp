@@ -23,6 +23,8 @@
 #include "MeasurementException.hpp"
 #include "GmatConstants.hpp"
 #include "MessageInterface.hpp"
+#include "BodyFixedPoint.hpp"
+#include <map>
 
 #include "DataFileAdapter.hpp"
 
@@ -297,6 +299,7 @@ Integer MeasurementManager::Calculate(const Integer measurementToCalc,
 
    if (measurementToCalc == -1)
    {
+      PrepareStationStates();
       for (UnsignedInt j = 0; j < models.size(); ++j)
       {
          measurements[j] = models[j]->CalculateMeasurement(withEvents);
@@ -549,6 +552,41 @@ GmatEpoch MeasurementManager::GetNextEpoch()
 }
 
 
+//-----------------------------------------------------------------------------
+// bool GetObservationSpan(GmatEpoch &firstEpoch, GmatEpoch &lastEpoch)
+//-----------------------------------------------------------------------------
+/**
+ * Finds the earliest and latest epochs of the loaded observations
+ *
+ * The observations are not required to be in time order, so the full list is
+ * scanned.
+ *
+ * @param firstEpoch Set to the (a.1 modified Julian) epoch of the earliest
+ *                   observation
+ * @param lastEpoch  Set to the epoch of the latest observation
+ *
+ * @return true if observations are loaded, false if there are none
+ */
+//-----------------------------------------------------------------------------
+bool MeasurementManager::GetObservationSpan(GmatEpoch &firstEpoch,
+      GmatEpoch &lastEpoch)
+{
+   if (observations.empty())
+      return false;
+
+   firstEpoch = lastEpoch = observations[0].epoch;
+   for (UnsignedInt i = 1; i < observations.size(); ++i)
+   {
+      if (observations[i].epoch < firstEpoch)
+         firstEpoch = observations[i].epoch;
+      if (observations[i].epoch > lastEpoch)
+         lastEpoch = observations[i].epoch;
+   }
+
+   return true;
+}
+
+
 //-----------------------------------------------------------------------------
 // const ObservationData *GetObsData(const Integer observationToGet)
 //-----------------------------------------------------------------------------
@@ -803,6 +841,7 @@ bool MeasurementManager::CalculateMeasurements(bool withEvents)
    bool retval = false;
 
    eventCount = 0;
+   PrepareStationStates();
 
    for (UnsignedInt j = 0; j < models.size(); ++j)
    {
@@ -1146,3 +1185,66 @@ void  MeasurementManager::Reset()
 {
    currentObs = observations.begin();
 }
+
+
+//-----------------------------------------------------------------------------
+// void PrepareStationStates()
+//-----------------------------------------------------------------------------
+/**
+ * Computes the MJ2000 states of the body-fixed measurement participants
+ * before the measurement models are calculated.
+ *
+ * The measurements are computed at the epoch of their spacecraft.  Stations
+ * used at the same epoch are passed together to
+ * BodyFixedPoint::GetMJ2000States(), which rotates all of the stations on a
+ * body with one body-fixed conversion and stores each state in the station's
+ * epoch cache.  The models then read the station states from that cache.
+ */
+//-----------------------------------------------------------------------------
+void MeasurementManager::PrepareStationStates()
+{
+   std::map<GmatEpoch, std::vector<BodyFixedPoint*> > stations;
+
+   for (UnsignedInt i = 0; i < models.size(); ++i)
+   {
+      ObjectArray &parts = models[i]->GetRefObjectArray(Gmat::SPACE_POINT);
+
+      GmatBase *sat = NULL;
+      for (UnsignedInt j = 0; j < parts.size(); ++j)
+      {
+         if (parts[j]->IsOfType(Gmat::SPACECRAFT))
+         {
+            sat = parts[j];
+            break;
+         }
+      }
+      if (sat == NULL)
+         continue;
+
+      std::vector<BodyFixedPoint*> *points = NULL;
+      for (UnsignedInt j = 0; j < parts.size(); ++j)
+      {
+         if (!parts[j]->IsOfType("BodyFixedPoint"))
+            continue;
+
+         if (points == NULL)
+            points = &stations[sat->GetRealParameter("A1Epoch")];
+
+         BodyFixedPoint *bfp = (BodyFixedPoint*)parts[j];
+         if (find(points->begin(), points->end(), bfp) == points->end())
+            points->push_back(bfp);
+      }
+   }
+
+   std::vector<Rvector6> states;
+   for (std::map<GmatEpoch, std::vector<BodyFixedPoint*> >::iterator i =
+         stations.begin(); i != stations.end(); ++i)
+   {
+      BodyFixedPoint::GetMJ2000States(i->second, A1Mjd(i->first), states);
+
+      #ifdef DEBUG_FLOW
+         MessageInterface::ShowMessage("Computed %d station states at "
+               "epoch %.12lf\n", i->second.size(), i->first);
+      #endif
+   }
+}
@@ -82,6 +82,8 @@ public:
    void                    LoadObservations();
    GmatEpoch               GetEpoch();
    GmatEpoch               GetNextEpoch();
+   bool                    GetObservationSpan(GmatEpoch &firstEpoch,
+                                              GmatEpoch &lastEpoch);
    const ObservationData * GetObsData(const Integer observationToGet = -1);
    void                    AdvanceObservation();
    void                    Reset();
@@ -134,6 +136,7 @@ protected:
    Integer                          eventCount;
 
    Integer                          FindModelForObservation();
+   void                             PrepareStationStates();
 };
 
 #endif /*MeasurementManager_hpp*/
@@ -1647,6 +1647,8 @@ bool MeasurementModel::SetRefObject(GmatBase *obj, const Gmat::ObjectType type,
 /**
  * Retrieves an array of reference objects
  *
+ * Requests for Gmat::SPACE_POINT objects return the measurement participants.
+ *
  * @param type The Gmat::OBJECT_TYPE requested
  *
  * @return The array of objects
@@ -1654,6 +1656,9 @@ bool MeasurementModel::SetRefObject(GmatBase *obj, const Gmat::ObjectType type,
 //------------------------------------------------------------------------------
 ObjectArray& MeasurementModel::GetRefObjectArray(const Gmat::ObjectType type)
 {
+   if (type == Gmat::SPACE_POINT)
+      return participants;
+
    return GmatBase::GetRefObjectArray(type);
 }
 
@@ -72,6 +72,10 @@ BodyFixedPoint::PARAMETER_TEXT[BodyFixedPointParamCount - SpacePointParamCount]
          wxT("LOCATION_UNITS_3")   // "km" or "km"
    };
 
+const ParameterIndex
+BodyFixedPoint::PARAMETER_INDEX(PARAMETER_TEXT,
+      SpacePointParamCount, BodyFixedPointParamCount);
+
 const Gmat::ParameterType
 BodyFixedPoint::PARAMETER_TYPE[BodyFixedPointParamCount - SpacePointParamCount] =
    {
@@ -241,6 +245,8 @@ BodyFixedPoint& BodyFixedPoint::operator=(const BodyFixedPoint& bfp)
 //---------------------------------------------------------------------------
 bool BodyFixedPoint::Initialize()
 {
+   InvalidateStateCache();
+
    // Initialize the body data
    if (!theBody)
       throw AssetException(wxT("Unable to initialize ground station ") +
@@ -388,11 +394,9 @@ Integer BodyFixedPoint::GetParameterID(const wxString &str) const
    if (str == locationLabels[2])
       return LOCATION_3;
 
-   for (Integer i = SpacePointParamCount; i < BodyFixedPointParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - SpacePointParamCount])
-         return i;
-   }
+   Integer id = PARAMETER_INDEX.Find(str);
+   if (id != -1)
+      return id;
 
    return SpacePoint::GetParameterID(str);
 }
@@ -688,6 +692,9 @@ bool BodyFixedPoint::SetStringParameter(const Integer id,
    else
       retval = SpacePoint::SetStringParameter(id, value);
 
+   if (retval)
+      InvalidateStateCache();
+
    return retval;
 }
 
@@ -788,6 +795,7 @@ bool BodyFixedPoint::SetRefObject(GmatBase *obj, const Gmat::ObjectType type,
          if (obj->GetName() == cBodyName)
          {
             theBody = (SpacePoint*)obj;
+            InvalidateStateCache();
             // Let ancestors process this object as well
 
             #ifdef DEBUG_OBJECT_MAPPING
@@ -815,6 +823,7 @@ bool BodyFixedPoint::SetRefObject(GmatBase *obj, const Gmat::ObjectType type,
                       tmpCS->GetName().c_str());
                #endif
                bfcs = tmpCS;
+               InvalidateStateCache();
                return true;
             }
             if ((name == mj2kcsName) &&
@@ -826,6 +835,7 @@ bool BodyFixedPoint::SetRefObject(GmatBase *obj, const Gmat::ObjectType type,
                       tmpCS->GetName().c_str());
                #endif
                mj2kcs = tmpCS;
+               InvalidateStateCache();
                return true;
             }
 
@@ -866,6 +876,9 @@ Real BodyFixedPoint::SetRealParameter(const Integer id,
 //      MessageInterface::ShowMessage(wxT("stateType = %s and horizon = %s\n"),
 //            stateType.c_str(), horizon.c_str());
    #endif
+   if ((id >= LOCATION_1) && (id <= LOCATION_3))
+      InvalidateStateCache();
+
    if (((id == LOCATION_1) || (id == LOCATION_2)) && stateType == wxT("Spherical"))
    {
       // if Spherical statetype, then check if Latitude/Longitude are in the correct range
@@ -1137,6 +1150,10 @@ const Rvector6 BodyFixedPoint::GetMJ2000State(const A1Mjd &atTime)
             instanceName.c_str());
    #endif
 
+   // Measurements and event locators ask repeatedly for the same epoch
+   if (GetCachedMJ2000State(atTime, j2000PosVel))
+      return j2000PosVel;
+
    UpdateBodyFixedLocation();
    Real     epoch = atTime.Get();
    Rvector6 bfState;
@@ -1161,6 +1178,7 @@ const Rvector6 BodyFixedPoint::GetMJ2000State(const A1Mjd &atTime)
             (j2000PosVel.ToString()).c_str());
    #endif
 
+   SetCachedMJ2000State(atTime, j2000PosVel);
    return j2000PosVel;
 }
 
@@ -1252,6 +1270,113 @@ CoordinateSystem* BodyFixedPoint::GetBodyFixedCoordinateSystem() const
 }
 
 
+//------------------------------------------------------------------------------
+//  void GetMJ2000States(const std::vector<BodyFixedPoint*> &points,
+//                       const A1Mjd &atTime, std::vector<Rvector6> &states)
+//------------------------------------------------------------------------------
+/**
+ * Computes the MJ2000 states of a set of body-fixed points at one epoch.
+ *
+ * Points that share a body-fixed and an MJ2000 coordinate system (e.g. all
+ * of the stations in a tracking network on the Earth) are transformed with a
+ * single body-fixed rotation: the first point of each group goes through the
+ * coordinate converter, and the resulting rotation and rotation rate matrices
+ * are applied directly to the rest of the group.  Each computed state is also
+ * stored in the point's epoch cache.
+ *
+ * @param <points>  The body-fixed points.
+ * @param <atTime>  Time for which the states are requested.
+ * @param <states>  The MJ2000 states, in the order of points.
+ */
+//------------------------------------------------------------------------------
+void BodyFixedPoint::GetMJ2000States(const std::vector<BodyFixedPoint*> &points,
+                                     const A1Mjd &atTime,
+                                     std::vector<Rvector6> &states)
+{
+   UnsignedInt count = points.size();
+   states.resize(count);
+
+   // Points still needing a state; cached points are filled right away
+   std::vector<bool> pending(count, false);
+   for (UnsignedInt i = 0; i < count; ++i)
+   {
+      BodyFixedPoint *bfp = points[i];
+      if (bfp == NULL)
+         throw AssetException(wxT("Unable to compute body-fixed point states; ")
+               wxT("a point in the list is NULL"));
+      if (!bfp->GetCachedMJ2000State(atTime, states[i]))
+         pending[i] = true;
+   }
+
+   Real rot[9], rotDot[9], fromRot[9], fromRotDot[9];
+   Real m[9], mDot[9];
+
+   for (UnsignedInt i = 0; i < count; ++i)
+   {
+      if (!pending[i])
+         continue;
+
+      // The lead point of the group uses the full conversion
+      BodyFixedPoint *lead = points[i];
+      states[i] = lead->GetMJ2000State(atTime);
+      pending[i] = false;
+
+      CoordinateSystem *inCS  = lead->bfcs;
+      CoordinateSystem *outCS = lead->mj2kcs;
+
+      // The rotation can only be reused when no translation was applied
+      if ((inCS == NULL) || (outCS == NULL) ||
+          (inCS->GetName() == outCS->GetName()) ||
+          (inCS->GetOrigin() != outCS->GetOrigin()))
+         continue;
+
+      // Rotation from body-fixed to MJ2000 axes, then into the output axes:
+      //    M = F^T R,  Mdot = Fdot^T R + F^T Rdot
+      inCS->GetLastRotationMatrix(rot);
+      inCS->GetLastRotationDotMatrix(rotDot);
+      outCS->GetLastRotationMatrix(fromRot);
+      outCS->GetLastRotationDotMatrix(fromRotDot);
+
+      for (Integer p = 0; p < 3; ++p)
+      {
+         for (Integer q = 0; q < 3; ++q)
+         {
+            m[3*p+q]    = 0.0;
+            mDot[3*p+q] = 0.0;
+            for (Integer k = 0; k < 3; ++k)
+            {
+               m[3*p+q]    += fromRot[3*k+p] * rot[3*k+q];
+               mDot[3*p+q] += fromRotDot[3*k+p] * rot[3*k+q] +
+                              fromRot[3*k+p] * rotDot[3*k+q];
+            }
+         }
+      }
+
+      for (UnsignedInt j = i + 1; j < count; ++j)
+      {
+         if (!pending[j])
+            continue;
+
+         BodyFixedPoint *bfp = points[j];
+         if ((bfp->bfcs != inCS) || (bfp->mj2kcs != outCS))
+            continue;
+
+         bfp->UpdateBodyFixedLocation();
+         const Real *r = bfp->bfLocation;
+         Rvector6 &st = states[j];
+         for (Integer p = 0; p < 3; ++p)
+         {
+            st[p]   = m[3*p]    * r[0] + m[3*p+1]    * r[1] + m[3*p+2]    * r[2];
+            st[p+3] = mDot[3*p] * r[0] + mDot[3*p+1] * r[1] + mDot[3*p+2] * r[2];
+         }
+         bfp->j2000PosVel = st;
+         bfp->SetCachedMJ2000State(atTime, st);
+         pending[j] = false;
+      }
+   }
+}
+
+
 //------------------------------------------------------------------------------
 //  void SetSolarSystem(SolarSystem *ss)
 //------------------------------------------------------------------------------
@@ -1314,3 +1439,21 @@ void BodyFixedPoint::UpdateBodyFixedLocation()
    }
 
 }
+
+
+//------------------------------------------------------------------------------
+//  UnsignedInt GetDependencyStateVersion()
+//------------------------------------------------------------------------------
+/**
+ * Returns the cache version of the body the point is attached to, so that
+ * changes to the body's orientation data invalidate the point's cached state.
+ *
+ * @return The dependency version.
+ */
+//------------------------------------------------------------------------------
+UnsignedInt BodyFixedPoint::GetDependencyStateVersion()
+{
+   if (theBody == NULL)
+      return 0;
+   return theBody->GetStateCacheVersion();
+}
@@ -135,6 +135,11 @@ public:
    virtual CoordinateSystem*
                            GetBodyFixedCoordinateSystem() const;
 
+   static void             GetMJ2000States(
+                                 const std::vector<BodyFixedPoint*> &points,
+                                 const A1Mjd &atTime,
+                                 std::vector<Rvector6> &states);
+
    virtual void            SetSolarSystem(SolarSystem *ss);
    virtual bool            IsValidID(const wxString &id) = 0;
 
@@ -174,6 +179,7 @@ protected:
    CoordinateConverter ccvtr;
 
    void UpdateBodyFixedLocation();
+   virtual UnsignedInt GetDependencyStateVersion();
 
 
    /// Conversion code used to transform from lat-long-height to body fixed
@@ -205,6 +211,8 @@ public:
    /// burn parameter labels
    static const wxString
       PARAMETER_TEXT[BodyFixedPointParamCount - SpacePointParamCount];
+   /// Hash index of the PARAMETER_TEXT labels, used by GetParameterID()
+   static const ParameterIndex PARAMETER_INDEX;
    /// burn parameter types
    static const Gmat::ParameterType
       PARAMETER_TYPE[BodyFixedPointParamCount - SpacePointParamCount];
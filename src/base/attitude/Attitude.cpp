@@ -90,6 +90,10 @@ Attitude::PARAMETER_TEXT[AttitudeParamCount - GmatBaseParamCount] =
    wxT("AngularVelocityZ"),
 };
 
+const ParameterIndex
+Attitude::PARAMETER_INDEX(PARAMETER_TEXT,
+      GmatBaseParamCount, AttitudeParamCount);
+
 const Gmat::ParameterType
 Attitude::PARAMETER_TYPE[AttitudeParamCount - GmatBaseParamCount] =
 {
@@ -1958,11 +1962,9 @@ wxString Attitude::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer Attitude::GetParameterID(const wxString &str) const
 {
-   for (Integer i = GmatBaseParamCount; i < AttitudeParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - GmatBaseParamCount])
-         return i;
-   }
+   Integer id = PARAMETER_INDEX.Find(str);
+   if (id != -1)
+      return id;
    // otherwise, check for other reps
    for (Integer i = OTHER_REPS_OFFSET; i < EndOtherReps; i++)
    {
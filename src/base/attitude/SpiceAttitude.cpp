@@ -41,6 +41,10 @@ SpiceAttitude::PARAMETER_TEXT[SpiceAttitudeParamCount - AttitudeParamCount] =
    wxT("FrameKernelName"),
 };
 
+const ParameterIndex
+SpiceAttitude::PARAMETER_INDEX(PARAMETER_TEXT,
+      AttitudeParamCount, SpiceAttitudeParamCount);
+
 const Gmat::ParameterType
 SpiceAttitude::PARAMETER_TYPE[SpiceAttitudeParamCount - AttitudeParamCount] =
 {
@@ -455,11 +459,9 @@ wxString SpiceAttitude::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer SpiceAttitude::GetParameterID(const wxString &str) const
 {
-   for (Integer i = AttitudeParamCount; i < SpiceAttitudeParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - AttitudeParamCount])
-         return i;
-   }
+   Integer id = PARAMETER_INDEX.Find(str);
+   if (id != -1)
+      return id;
 
    return Attitude::GetParameterID(str);
 }
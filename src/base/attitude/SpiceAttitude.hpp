@@ -131,6 +131,8 @@ protected:
 
    // static text and types for parameters
    static const wxString PARAMETER_TEXT[SpiceAttitudeParamCount - AttitudeParamCount];
+   /// Hash index of the PARAMETER_TEXT labels, used by GetParameterID()
+   static const ParameterIndex PARAMETER_INDEX;
 
    static const Gmat::ParameterType PARAMETER_TYPE[SpiceAttitudeParamCount - AttitudeParamCount];
 
@@ -61,6 +61,9 @@ Burn::PARAMETER_TEXT[BurnParamCount - GmatBaseParamCount] =
    wxT("SpacecraftName"),
 };
 
+const ParameterIndex
+Burn::PARAMETER_INDEX(PARAMETER_TEXT, GmatBaseParamCount, BurnParamCount);
+
 /// Types of the parameters used by thrusters.
 const Gmat::ParameterType
 Burn::PARAMETER_TYPE[BurnParamCount - GmatBaseParamCount] =
@@ -362,14 +365,7 @@ Integer Burn::GetParameterID(const wxString &str) const
       return DELTAV3;
    }
    
-   for (Integer i = GmatBaseParamCount; i < BurnParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - GmatBaseParamCount])
-      {
-         id = i;
-         break;
-      }
-   }
+   id = PARAMETER_INDEX.Find(str);
    
    if (id != -1)
    {
@@ -46,6 +46,10 @@ FiniteBurn::PARAMETER_TEXT[FiniteBurnParamCount - BurnParamCount] =
    wxT("BurnScaleFactor")
 };
 
+const ParameterIndex
+FiniteBurn::PARAMETER_INDEX(PARAMETER_TEXT,
+      BurnParamCount, FiniteBurnParamCount);
+
 /// Types of the parameters used by finite burns.
 const Gmat::ParameterType
 FiniteBurn::PARAMETER_TYPE[FiniteBurnParamCount - BurnParamCount] =
@@ -217,6 +221,11 @@ bool FiniteBurn::Fire(Real *burnData, Real epoch)
    
    tMass = spacecraft->GetRealParameter(wxT("TotalMass"));
    
+   wxString frameKey;
+   UnsignedInt frameIndex;
+   frameKeys.clear();
+   frameRotations.clear();
+   
    #ifdef DEBUG_BURN_ORIGIN
    Real *satState = spacecraft->GetState().GetState();
    MessageInterface::ShowMessage
@@ -249,8 +258,24 @@ bool FiniteBurn::Fire(Real *burnData, Real epoch)
       thrusterMap[current->GetName()] = current;
       
       // FiniteBurn class is friend of Thruster class, so we can access
-      // member data directly
-      current->ComputeInertialDirection(epoch);
+      // member data directly.  Thrusters sharing a frame share the rotation.
+      frameKey = current->GetFrameKey();
+      for (frameIndex = 0; frameIndex < frameKeys.size(); ++frameIndex)
+         if (frameKeys[frameIndex] == frameKey)
+            break;
+
+      if (frameIndex < frameKeys.size())
+         current->ApplyFrameRotation(&frameRotations[frameIndex * 9], epoch);
+      else
+      {
+         current->ComputeInertialDirection(epoch);
+         if (current->frameRotationValid)
+         {
+            frameKeys.push_back(frameKey);
+            frameRotations.insert(frameRotations.end(),
+                  current->frameRotation, current->frameRotation + 9);
+         }
+      }
       dir = current->inertialDirection;
       norm = sqrt(dir[0]*dir[0] + dir[1]*dir[1] + dir[2]*dir[2]);
       
@@ -384,11 +409,9 @@ Integer FiniteBurn::GetParameterID(const wxString &str) const
       return BURNAXES;
    }
    
-   for (Integer i = BurnParamCount; i < FiniteBurnParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - BurnParamCount])
-         return i;
-   }
+   Integer id = PARAMETER_INDEX.Find(str);
+   if (id != -1)
+      return id;
    
    return Burn::GetParameterID(str);
 }
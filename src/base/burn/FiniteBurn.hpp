@@ -91,6 +91,10 @@ protected:
    ObjectMap               thrusterMap;
    /// List of fuel tanks used in the maneuver (deprecated)
    StringArray             tankNames;
+   /// Thrust frames already rotated to MJ2000Eq during the current Fire()
+   StringArray             frameKeys;
+   /// Rotation matrices for frameKeys, 9 row-major elements per frame
+   RealArray               frameRotations;
    
    bool SetThrustersFromSpacecraft();
    
@@ -106,6 +110,8 @@ protected:
    /// Thruster parameter labels
    static const wxString 
                         PARAMETER_TEXT[FiniteBurnParamCount - BurnParamCount];
+   /// Hash index of the PARAMETER_TEXT labels, used by GetParameterID()
+   static const ParameterIndex PARAMETER_INDEX;
    /// Thruster parameter types
    static const Gmat::ParameterType 
                         PARAMETER_TYPE[FiniteBurnParamCount - BurnParamCount];
@@ -46,6 +46,10 @@ ImpulsiveBurn::PARAMETER_TEXT[ImpulsiveBurnParamCount - BurnParamCount] =
    wxT("DeltaTankMass"),
 };
 
+const ParameterIndex
+ImpulsiveBurn::PARAMETER_INDEX(PARAMETER_TEXT,
+      BurnParamCount, ImpulsiveBurnParamCount);
+
 /// Types of the parameters
 const Gmat::ParameterType
 ImpulsiveBurn::PARAMETER_TYPE[ImpulsiveBurnParamCount - BurnParamCount] =
@@ -451,11 +455,9 @@ wxString ImpulsiveBurn::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer ImpulsiveBurn::GetParameterID(const wxString &str) const
 {
-   for (Integer i = BurnParamCount; i < ImpulsiveBurnParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - BurnParamCount])
-         return i;
-   }
+   Integer id = PARAMETER_INDEX.Find(str);
+   if (id != -1)
+      return id;
    
    return Burn::GetParameterID(str);
 }
@@ -120,6 +120,8 @@ protected:
    /// Parameter labels
    static const wxString
       PARAMETER_TEXT[ImpulsiveBurnParamCount - BurnParamCount];
+   /// Hash index of the PARAMETER_TEXT labels, used by GetParameterID()
+   static const ParameterIndex PARAMETER_INDEX;
    /// Parameter types
    static const Gmat::ParameterType 
       PARAMETER_TYPE[ImpulsiveBurnParamCount - BurnParamCount];
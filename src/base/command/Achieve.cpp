@@ -51,6 +51,10 @@ const wxString
       wxT("GoalValue"),
       wxT("Tolerance")
    };
+
+const ParameterIndex
+Achieve::PARAMETER_INDEX(PARAMETER_TEXT,
+      GmatCommandParamCount, AchieveParamCount);
    
 const Gmat::ParameterType
    Achieve::PARAMETER_TYPE[AchieveParamCount - GmatCommandParamCount] =
@@ -301,11 +305,9 @@ wxString Achieve::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer Achieve::GetParameterID(const wxString &str) const
 {
-   for (Integer i = GmatCommandParamCount; i < AchieveParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - GmatCommandParamCount])
-         return i;
-   }
+   Integer id = PARAMETER_INDEX.Find(str);
+   if (id != -1)
+      return id;
 
    return GmatCommand::GetParameterID(str);
 }
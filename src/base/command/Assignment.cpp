@@ -854,6 +854,9 @@ bool Assignment::Initialize()
             if (!topNode->ValidateInputs())
                throw CommandException(wxT("Failed to validate equation inputs in\n   \"") +
                                       generatingString + wxT("\"") + fnMsg);
+            
+            // Lower scalar equations to the register program used by Execute
+            mathTree->Compile();
          }
          else
          {
@@ -985,9 +988,21 @@ bool Assignment::Execute()
          ShowObjectMaps(wxT("object maps at the start"));
          #endif
          
-         outWrapper = RunMathTree();
-         retval = ElementWrapper::SetValue(lhsWrapper, outWrapper, solarSys, objectMap,
-                                           globalObjectMap, setRefObj);
+         // Compiled scalar equations are set directly on a Real lhs, so no
+         // output wrapper is built; compiled matrix equations are run by
+         // RunMathTree()
+         if (mathTree->IsCompiledReal() &&
+             lhsWrapper->GetDataType() == Gmat::REAL_TYPE)
+         {
+            lhsWrapper->TakeRequiredAction();
+            retval = lhsWrapper->SetReal(mathTree->Evaluate());
+         }
+         else
+         {
+            outWrapper = RunMathTree();
+            retval = ElementWrapper::SetValue(lhsWrapper, outWrapper, solarSys, objectMap,
+                                              globalObjectMap, setRefObj);
+         }
       }
       
       #ifdef DEBUG_ASSIGNMENT_EXEC
@@ -1343,6 +1358,9 @@ bool Assignment::SetElementWrapper(ElementWrapper *toWrapper,
                rhsOldWrapper = mathWrapperMap[withName];
                rhsNewWrapper = toWrapper;
                mathWrapperMap[withName] = toWrapper;
+               // The compiled equation holds the old wrapper
+               if (mathTree)
+                  mathTree->ClearProgram();
             }
             retval = true;
          }
@@ -1681,7 +1699,7 @@ ElementWrapper* Assignment::RunMathTree()
             #endif
             
             Real rval = -9999.9999;
-            rval = topNode->Evaluate();
+            rval = mathTree->Evaluate();
             
             #ifdef DEBUG_ASSIGNMENT_EXEC
             MessageInterface::ShowMessage(wxT("   Returned %f\n"), rval);
@@ -1707,7 +1725,7 @@ ElementWrapper* Assignment::RunMathTree()
             
             Rmatrix rmat;
             rmat.SetSize(numRow, numCol);
-            rmat = topNode->MatrixEvaluate();
+            rmat = mathTree->MatrixEvaluate();
             // create Array, this array will be deleted when ArrayWrapper is deleted
             Array *outArray = new Array(wxT("ArrayOutput"));
             #ifdef DEBUG_MEMORY
@@ -40,6 +40,10 @@ BeginFunction::PARAMETER_TEXT[BeginFunctionParamCount - GmatCommandParamCount] =
    wxT("CallFunctionOutput")
 };
 
+const ParameterIndex
+BeginFunction::PARAMETER_INDEX(PARAMETER_TEXT,
+      GmatCommandParamCount, BeginFunctionParamCount);
+
 
 const Gmat::ParameterType
 BeginFunction::PARAMETER_TYPE[BeginFunctionParamCount - GmatCommandParamCount] =
@@ -203,9 +207,9 @@ wxString BeginFunction::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer BeginFunction::GetParameterID(const wxString &str) const
 {
-   for (int i = 0; i < BeginFunctionParamCount - GmatCommandParamCount; ++i)
-      if (PARAMETER_TEXT[i] == str)
-         return i+GmatCommandParamCount;
+   Integer id = PARAMETER_INDEX.Find(str);
+   if (id != -1)
+      return id;
 
    return GmatCommand::GetParameterID(str);
 }
@@ -138,6 +138,8 @@ protected:
    /// burn parameter labels
    static const wxString
       PARAMETER_TEXT[BeginFunctionParamCount - GmatCommandParamCount];
+   /// Hash index of the PARAMETER_TEXT labels, used by GetParameterID()
+   static const ParameterIndex PARAMETER_INDEX;
    /// burn parameter types
    static const Gmat::ParameterType
       PARAMETER_TYPE[BeginFunctionParamCount - GmatCommandParamCount];
@@ -67,6 +67,10 @@ CallFunction::PARAMETER_TEXT[CallFunctionParamCount - GmatCommandParamCount] =
    wxT("CommandStream"),
 };
 
+const ParameterIndex
+CallFunction::PARAMETER_INDEX(PARAMETER_TEXT,
+      GmatCommandParamCount, CallFunctionParamCount);
+
 
 const Gmat::ParameterType
 CallFunction::PARAMETER_TYPE[CallFunctionParamCount - GmatCommandParamCount] =
@@ -476,11 +480,9 @@ Integer CallFunction::GetParameterID(const wxString &str) const
       MessageInterface::ShowMessage(wxT("CallFunction::GetParameterID \n"));
    #endif
 
-   for (int i=GmatCommandParamCount; i<CallFunctionParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - GmatCommandParamCount])
-         return i;
-   }
+   Integer id = PARAMETER_INDEX.Find(str);
+   if (id != -1)
+      return id;
    
    return GmatCommand::GetParameterID(str);
 }
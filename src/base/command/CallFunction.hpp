@@ -138,6 +138,8 @@ protected:
    
    static const wxString
       PARAMETER_TEXT[CallFunctionParamCount - GmatCommandParamCount];
+   /// Hash index of the PARAMETER_TEXT labels, used by GetParameterID()
+   static const ParameterIndex PARAMETER_INDEX;
    static const Gmat::ParameterType
       PARAMETER_TYPE[CallFunctionParamCount - GmatCommandParamCount];
 };
@@ -56,6 +56,10 @@ ConditionalBranch::PARAMETER_TEXT[ConditionalBranchParamCount - BranchCommandPar
    wxT("LogicalOperators"),
 };
 
+const ParameterIndex
+ConditionalBranch::PARAMETER_INDEX(PARAMETER_TEXT,
+      BranchCommandParamCount, ConditionalBranchParamCount);
+
 const Gmat::ParameterType
 ConditionalBranch::PARAMETER_TYPE[ConditionalBranchParamCount - BranchCommandParamCount] =
 {
@@ -667,11 +671,9 @@ wxString ConditionalBranch::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer ConditionalBranch::GetParameterID(const wxString &str) const
 {
-   for (Integer i = BranchCommandParamCount; i < ConditionalBranchParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - BranchCommandParamCount])
-         return i;
-   }
+   Integer id = PARAMETER_INDEX.Find(str);
+   if (id != -1)
+      return id;
    
    return BranchCommand::GetParameterID(str);
 }
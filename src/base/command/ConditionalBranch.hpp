@@ -132,6 +132,8 @@ protected:
 
    static const wxString
    PARAMETER_TEXT[ConditionalBranchParamCount - BranchCommandParamCount];
+   /// Hash index of the PARAMETER_TEXT labels, used by GetParameterID()
+   static const ParameterIndex PARAMETER_INDEX;
    
    static const Gmat::ParameterType
    PARAMETER_TYPE[ConditionalBranchParamCount - BranchCommandParamCount];
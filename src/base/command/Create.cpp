@@ -52,6 +52,10 @@ Create::PARAMETER_TEXT[CreateParamCount - ManageObjectParamCount] =
       wxT("ObjectType"),
 };
 
+const ParameterIndex
+Create::PARAMETER_INDEX(PARAMETER_TEXT,
+      ManageObjectParamCount, CreateParamCount);
+
 const Gmat::ParameterType
 Create::PARAMETER_TYPE[CreateParamCount - ManageObjectParamCount] =
 {
@@ -157,11 +161,9 @@ wxString Create::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer Create::GetParameterID(const wxString &str) const
 {
-   for (Integer i = ManageObjectParamCount; i < CreateParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - ManageObjectParamCount])
-         return i;
-   }
+   Integer id = PARAMETER_INDEX.Find(str);
+   if (id != -1)
+      return id;
    
    return ManageObject::GetParameterID(str);
 }
@@ -66,6 +66,8 @@ protected:
       CreateParamCount
    };
    static const wxString PARAMETER_TEXT[CreateParamCount - ManageObjectParamCount];
+   /// Hash index of the PARAMETER_TEXT labels, used by GetParameterID()
+   static const ParameterIndex PARAMETER_INDEX;
    
    static const Gmat::ParameterType PARAMETER_TYPE[CreateParamCount - ManageObjectParamCount];
    
@@ -60,6 +60,9 @@ For::PARAMETER_TEXT[ForParamCount - BranchCommandParamCount] =
    wxT("IncrementName"),
 };
 
+const ParameterIndex
+For::PARAMETER_INDEX(PARAMETER_TEXT, BranchCommandParamCount, ForParamCount);
+
 const Gmat::ParameterType
 For::PARAMETER_TYPE[ForParamCount - BranchCommandParamCount] =
 {
@@ -581,11 +584,9 @@ wxString For::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer For::GetParameterID(const wxString &str) const
 {
-   for (Integer i = BranchCommandParamCount; i < ForParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - BranchCommandParamCount])
-         return i;
-   }
+   Integer id = PARAMETER_INDEX.Find(str);
+   if (id != -1)
+      return id;
    
    return BranchCommand::GetParameterID(str);
 }
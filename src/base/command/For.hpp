@@ -115,6 +115,8 @@ protected:
 
    static const wxString PARAMETER_TEXT[
       ForParamCount - BranchCommandParamCount];
+   /// Hash index of the PARAMETER_TEXT labels, used by GetParameterID()
+   static const ParameterIndex PARAMETER_INDEX;
 
    static const Gmat::ParameterType PARAMETER_TYPE[
       ForParamCount - BranchCommandParamCount];
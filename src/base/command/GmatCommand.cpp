@@ -80,6 +80,10 @@ const wxString
       wxT("MissionSummary")
    };
 
+const ParameterIndex
+GmatCommand::PARAMETER_INDEX(PARAMETER_TEXT,
+      GmatBaseParamCount, GmatCommandParamCount);
+
 
 const Gmat::ParameterType 
    GmatCommand::PARAMETER_TYPE[GmatCommandParamCount - GmatBaseParamCount] =
@@ -943,11 +947,9 @@ wxString GmatCommand::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer GmatCommand::GetParameterID(const wxString &str) const
 {
-   for (Integer i = GmatBaseParamCount; i < GmatCommandParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - GmatBaseParamCount])
-         return i;
-   }
+   Integer id = PARAMETER_INDEX.Find(str);
+   if (id != -1)
+      return id;
 
    return GmatBase::GetParameterID(str);
 }
@@ -223,6 +223,8 @@ protected:
    /// Command parameter labels
    static const wxString 
                      PARAMETER_TEXT[GmatCommandParamCount - GmatBaseParamCount];
+   /// Hash index of the PARAMETER_TEXT labels, used by GetParameterID()
+   static const ParameterIndex PARAMETER_INDEX;
    /// Command parameter types
    static const Gmat::ParameterType 
                      PARAMETER_TYPE[GmatCommandParamCount - GmatBaseParamCount];
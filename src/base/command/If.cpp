@@ -39,6 +39,9 @@ If::PARAMETER_TEXT[IfParamCount - ConditionalBranchParamCount] =
    wxT("NestLevel"),
 };
 
+const ParameterIndex
+If::PARAMETER_INDEX(PARAMETER_TEXT, ConditionalBranchParamCount, IfParamCount);
+
 const Gmat::ParameterType
 If::PARAMETER_TYPE[IfParamCount - ConditionalBranchParamCount] =
 {
@@ -291,11 +294,9 @@ wxString If::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer If::GetParameterID(const wxString &str) const
 {
-   for (Integer i = ConditionalBranchParamCount; i < IfParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - ConditionalBranchParamCount])
-         return i;
-   }
+   Integer id = PARAMETER_INDEX.Find(str);
+   if (id != -1)
+      return id;
    
    return ConditionalBranch::GetParameterID(str);
 }
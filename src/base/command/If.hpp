@@ -78,6 +78,8 @@ protected:
    };
 
    static const wxString PARAMETER_TEXT[IfParamCount - ConditionalBranchParamCount];
+   /// Hash index of the PARAMETER_TEXT labels, used by GetParameterID()
+   static const ParameterIndex PARAMETER_INDEX;
    
    static const Gmat::ParameterType PARAMETER_TYPE[IfParamCount - ConditionalBranchParamCount];
    
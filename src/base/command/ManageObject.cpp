@@ -36,6 +36,10 @@ ManageObject::PARAMETER_TEXT[ManageObjectParamCount - GmatCommandParamCount] =
    wxT("ObjectNames"),
 };
 
+const ParameterIndex
+ManageObject::PARAMETER_INDEX(PARAMETER_TEXT,
+      GmatCommandParamCount, ManageObjectParamCount);
+
 const Gmat::ParameterType
 ManageObject::PARAMETER_TYPE[ManageObjectParamCount - GmatCommandParamCount] =
 {
@@ -115,11 +119,9 @@ wxString ManageObject::GetParameterText(const Integer id) const
 
 Integer ManageObject::GetParameterID(const wxString &str) const
 {
-   for (Integer i = GmatCommandParamCount; i < ManageObjectParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - GmatCommandParamCount])
-         return i;
-   }
+   Integer id = PARAMETER_INDEX.Find(str);
+   if (id != -1)
+      return id;
    
    return GmatCommand::GetParameterID(str);
 }
@@ -72,6 +72,8 @@ protected:
       ManageObjectParamCount
    };
    static const wxString PARAMETER_TEXT[ManageObjectParamCount - GmatCommandParamCount];
+   /// Hash index of the PARAMETER_TEXT labels, used by GetParameterID()
+   static const ParameterIndex PARAMETER_INDEX;
 
    static const Gmat::ParameterType PARAMETER_TYPE[ManageObjectParamCount - GmatCommandParamCount];
   
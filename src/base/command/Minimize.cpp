@@ -43,6 +43,10 @@ const wxString
       wxT("OptimizerName"),
       wxT("ObjectiveName"),
    };
+
+const ParameterIndex
+Minimize::PARAMETER_INDEX(PARAMETER_TEXT,
+      GmatCommandParamCount, MinimizeParamCount);
    
 const Gmat::ParameterType
    Minimize::PARAMETER_TYPE[MinimizeParamCount - GmatCommandParamCount] =
@@ -293,11 +297,9 @@ wxString Minimize::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer Minimize::GetParameterID(const wxString &str) const
 {
-   for (Integer i = GmatCommandParamCount; i < MinimizeParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - GmatCommandParamCount])
-         return i;
-   }
+   Integer id = PARAMETER_INDEX.Find(str);
+   if (id != -1)
+      return id;
 
    return GmatCommand::GetParameterID(str);
 }
@@ -44,6 +44,10 @@ const wxString
       wxT("ConstraintArg2"),
       wxT("Tolerance"),
    };
+
+const ParameterIndex
+NonlinearConstraint::PARAMETER_INDEX(PARAMETER_TEXT,
+      GmatCommandParamCount, NonlinearConstraintParamCount);
    
 const Gmat::ParameterType
    NonlinearConstraint::PARAMETER_TYPE[NonlinearConstraintParamCount - GmatCommandParamCount] =
@@ -310,11 +314,9 @@ wxString NonlinearConstraint::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer NonlinearConstraint::GetParameterID(const wxString &str) const
 {
-   for (Integer i = GmatCommandParamCount; i < NonlinearConstraintParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - GmatCommandParamCount])
-         return i;
-   }
+   Integer id = PARAMETER_INDEX.Find(str);
+   if (id != -1)
+      return id;
 
    return GmatCommand::GetParameterID(str);
 }
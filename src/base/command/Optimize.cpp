@@ -56,6 +56,10 @@ Optimize::PARAMETER_TEXT[OptimizeParamCount - SolverBranchCommandParamCount] =
    wxT("OptimizerConverged"),
 };
 
+const ParameterIndex
+Optimize::PARAMETER_INDEX(PARAMETER_TEXT,
+      SolverBranchCommandParamCount, OptimizeParamCount);
+
 const Gmat::ParameterType
 Optimize::PARAMETER_TYPE[OptimizeParamCount - SolverBranchCommandParamCount] =
 {
@@ -261,11 +265,9 @@ wxString Optimize::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer Optimize::GetParameterID(const wxString &str) const
 {
-   for (Integer i = SolverBranchCommandParamCount; i < OptimizeParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - SolverBranchCommandParamCount])
-         return i;
-   }
+   Integer id = PARAMETER_INDEX.Find(str);
+   if (id != -1)
+      return id;
     
    return SolverBranchCommand::GetParameterID(str);
 }
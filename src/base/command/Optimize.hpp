@@ -87,6 +87,8 @@ protected:
    // save for possible later use
    static const wxString
           PARAMETER_TEXT[OptimizeParamCount - SolverBranchCommandParamCount];
+   /// Hash index of the PARAMETER_TEXT labels, used by GetParameterID()
+   static const ParameterIndex PARAMETER_INDEX;
    
    static const Gmat::ParameterType
           PARAMETER_TYPE[OptimizeParamCount - SolverBranchCommandParamCount];
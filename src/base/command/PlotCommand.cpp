@@ -37,6 +37,10 @@ PlotCommand::PARAMETER_TEXT[PlotCommandParamCount - GmatCommandParamCount] =
    wxT("Subscriber"),
 };
 
+const ParameterIndex
+PlotCommand::PARAMETER_INDEX(PARAMETER_TEXT,
+      GmatCommandParamCount, PlotCommandParamCount);
+
 const Gmat::ParameterType
 PlotCommand::PARAMETER_TYPE[PlotCommandParamCount - GmatCommandParamCount] =
 {
@@ -193,11 +197,9 @@ wxString PlotCommand::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer PlotCommand::GetParameterID(const wxString &str) const
 {
-   for (Integer i = GmatCommandParamCount; i < PlotCommandParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - GmatCommandParamCount])
-         return i;
-   }
+   Integer id = PARAMETER_INDEX.Find(str);
+   if (id != -1)
+      return id;
    
    return GmatCommand::GetParameterID(str);
 }
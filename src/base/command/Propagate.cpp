@@ -89,6 +89,10 @@ Propagate::PARAMETER_TEXT[PropagateCommandParamCount - GmatCommandParamCount] =
    wxT("PropForward")
 };
 
+const ParameterIndex
+Propagate::PARAMETER_INDEX(PARAMETER_TEXT,
+      GmatCommandParamCount, PropagateCommandParamCount);
+
 const Gmat::ParameterType
 Propagate::PARAMETER_TYPE[PropagateCommandParamCount - GmatCommandParamCount] =
 {
@@ -907,11 +911,9 @@ wxString Propagate::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer Propagate::GetParameterID(const wxString &str) const
 {
-   for (Integer i = GmatCommandParamCount; i < PropagateCommandParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - GmatCommandParamCount])
-         return i;
-   }
+   Integer id = PARAMETER_INDEX.Find(str);
+   if (id != -1)
+      return id;
 
    return PropagationEnabledCommand::GetParameterID(str);
 }
@@ -3533,6 +3535,11 @@ void Propagate::PrepareToPropagate()
       }
    }
 
+   // Start a new force profile for this propagation segment
+   for (UnsignedInt i = 0; i < fm.size(); ++i)
+      if (fm[i] != NULL)
+         fm[i]->TakeAction(wxT("ResetForceProfile"));
+
    if (pubdata)
    {
       #ifdef DEBUG_MEMORY
@@ -3964,6 +3971,11 @@ bool Propagate::Execute()
 
       TakeFinalStep(epochID, trigger);
 
+      // Write the force profiles, if requested, before transient forces go
+      for (UnsignedInt i = 0; i < fm.size(); ++i)
+         if (fm[i] != NULL)
+            fm[i]->TakeAction(wxT("ReportForceProfile"));
+
       // reset the stopping conditions so that scanning starts over
       for (UnsignedInt i=0; i<stopWhen.size(); i++)
          stopWhen[i]->Reset();
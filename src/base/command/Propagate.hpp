@@ -292,6 +292,8 @@ protected:
    /// Parameter ID strings
    static const wxString
       PARAMETER_TEXT[PropagateCommandParamCount - GmatCommandParamCount];
+   /// Hash index of the PARAMETER_TEXT labels, used by GetParameterID()
+   static const ParameterIndex PARAMETER_INDEX;
    /// Array of allowed propagation modes
    static wxString      PropModeList[PropModeCount];
 
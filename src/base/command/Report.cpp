@@ -51,6 +51,10 @@ Report::PARAMETER_TEXT[ReportParamCount - GmatCommandParamCount] =
    wxT("Add"),
 };
 
+const ParameterIndex
+Report::PARAMETER_INDEX(PARAMETER_TEXT,
+      GmatCommandParamCount, ReportParamCount);
+
 const Gmat::ParameterType
 Report::PARAMETER_TYPE[ReportParamCount - GmatCommandParamCount] =
 {
@@ -158,11 +162,9 @@ Report& Report::operator=(const Report &rep)
 //------------------------------------------------------------------------------
 Integer Report::GetParameterID(const wxString &str) const
 {
-   for (Integer i = GmatCommandParamCount; i < ReportParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - GmatCommandParamCount])
-         return i;
-   }
+   Integer id = PARAMETER_INDEX.Find(str);
+   if (id != -1)
+      return id;
    
    return GmatCommand::GetParameterID(str);
 }
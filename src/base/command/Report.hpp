@@ -140,6 +140,8 @@ private:
 
    static const wxString
       PARAMETER_TEXT[ReportParamCount - GmatCommandParamCount];
+   /// Hash index of the PARAMETER_TEXT labels, used by GetParameterID()
+   static const ParameterIndex PARAMETER_INDEX;
    static const Gmat::ParameterType
       PARAMETER_TYPE[ReportParamCount - GmatCommandParamCount];
 };
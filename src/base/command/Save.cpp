@@ -41,6 +41,9 @@ Save::PARAMETER_TEXT[SaveParamCount - GmatCommandParamCount] =
    wxT("ObjectNames"),
 };
 
+const ParameterIndex
+Save::PARAMETER_INDEX(PARAMETER_TEXT, GmatCommandParamCount, SaveParamCount);
+
 const Gmat::ParameterType
 Save::PARAMETER_TYPE[SaveParamCount - GmatCommandParamCount] =
 {
@@ -144,11 +147,9 @@ wxString Save::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer Save::GetParameterID(const wxString &str) const
 {
-   for (int i=GmatCommandParamCount; i<SaveParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - GmatCommandParamCount])
-         return i;
-   }
+   Integer id = PARAMETER_INDEX.Find(str);
+   if (id != -1)
+      return id;
    
    return GmatCommand::GetParameterID(str);
 }
@@ -40,6 +40,10 @@ SaveMission::PARAMETER_TEXT[SaveMissionParamCount - GmatCommandParamCount] =
    wxT("FileName"),
 };
 
+const ParameterIndex
+SaveMission::PARAMETER_INDEX(PARAMETER_TEXT,
+      GmatCommandParamCount, SaveMissionParamCount);
+
 const Gmat::ParameterType
 SaveMission::PARAMETER_TYPE[SaveMissionParamCount - GmatCommandParamCount] =
 {
@@ -241,11 +245,9 @@ wxString SaveMission::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer SaveMission::GetParameterID(const wxString &str) const
 {
-   for (int i=GmatCommandParamCount; i<SaveMissionParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - GmatCommandParamCount])
-         return i;
-   }
+   Integer id = PARAMETER_INDEX.Find(str);
+   if (id != -1)
+      return id;
    
    return GmatCommand::GetParameterID(str);
 }
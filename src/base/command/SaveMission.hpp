@@ -77,6 +77,8 @@ protected:
    
    static const wxString
       PARAMETER_TEXT[SaveMissionParamCount - GmatCommandParamCount];
+   /// Hash index of the PARAMETER_TEXT labels, used by GetParameterID()
+   static const ParameterIndex PARAMETER_INDEX;
    static const Gmat::ParameterType
       PARAMETER_TYPE[SaveMissionParamCount - GmatCommandParamCount];
 };
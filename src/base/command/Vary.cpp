@@ -62,6 +62,9 @@ const wxString Vary::PARAMETER_TEXT[VaryParamCount -
    wxT("MultiplicativeScaleFactor")   
 };
 
+const ParameterIndex
+Vary::PARAMETER_INDEX(PARAMETER_TEXT, GmatCommandParamCount, VaryParamCount);
+
 const Gmat::ParameterType Vary::PARAMETER_TYPE[VaryParamCount -
                                                GmatCommandParamCount] = 
 {
@@ -506,11 +509,9 @@ wxString Vary::GetParameterText(const Integer id) const
 //---------------------------------------------------------------------------
 Integer Vary::GetParameterID(const wxString &str) const
 {
-   for (Integer i = GmatCommandParamCount; i < VaryParamCount; ++i)
-   {
-      if (str == PARAMETER_TEXT[i - GmatCommandParamCount])
-         return i;
-   }
+   Integer id = PARAMETER_INDEX.Find(str);
+   if (id != -1)
+      return id;
 
    return GmatCommand::GetParameterID(str);
 }
@@ -128,6 +128,8 @@ protected:
 
    static const wxString    PARAMETER_TEXT[VaryParamCount -
                                               GmatCommandParamCount];
+   /// Hash index of the PARAMETER_TEXT labels, used by GetParameterID()
+   static const ParameterIndex PARAMETER_INDEX;
    static const Gmat::ParameterType
                                PARAMETER_TYPE[VaryParamCount -
                                               GmatCommandParamCount];
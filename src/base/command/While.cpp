@@ -39,6 +39,10 @@ While::PARAMETER_TEXT[WhileParamCount - ConditionalBranchParamCount] =
    wxT("NestLevel"),
 };
 
+const ParameterIndex
+While::PARAMETER_INDEX(PARAMETER_TEXT,
+      ConditionalBranchParamCount, WhileParamCount);
+
 const Gmat::ParameterType
 While::PARAMETER_TYPE[WhileParamCount - ConditionalBranchParamCount] =
 {
@@ -279,11 +283,9 @@ wxString While::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer While::GetParameterID(const wxString &str) const
 {
-   for (Integer i = ConditionalBranchParamCount; i < WhileParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - ConditionalBranchParamCount])
-         return i;
-   }
+   Integer id = PARAMETER_INDEX.Find(str);
+   if (id != -1)
+      return id;
    
    return ConditionalBranch::GetParameterID(str);
 }
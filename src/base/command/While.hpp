@@ -79,6 +79,8 @@ protected:
    };
    
    static const wxString PARAMETER_TEXT[WhileParamCount - ConditionalBranchParamCount];
+   /// Hash index of the PARAMETER_TEXT labels, used by GetParameterID()
+   static const ParameterIndex PARAMETER_INDEX;
    
    static const Gmat::ParameterType PARAMETER_TYPE[WhileParamCount - ConditionalBranchParamCount];
    
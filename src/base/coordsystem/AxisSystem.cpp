@@ -82,6 +82,10 @@ AxisSystem::PARAMETER_TEXT[AxisSystemParamCount - CoordinateBaseParamCount] =
    wxT("OverrideOriginInterval"),
 };
 
+const ParameterIndex
+AxisSystem::PARAMETER_INDEX(PARAMETER_TEXT,
+      CoordinateBaseParamCount, AxisSystemParamCount);
+
 const Gmat::ParameterType
 AxisSystem::PARAMETER_TYPE[AxisSystemParamCount - CoordinateBaseParamCount] =
 {
@@ -967,11 +971,9 @@ wxString AxisSystem::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer AxisSystem::GetParameterID(const wxString &str) const
 {
-   for (Integer i = CoordinateBaseParamCount; i < AxisSystemParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - CoordinateBaseParamCount])
-         return i;
-   }
+   Integer id = PARAMETER_INDEX.Find(str);
+   if (id != -1)
+      return id;
    
    return CoordinateBase::GetParameterID(str);
 }
@@ -140,6 +140,8 @@ protected:
    };
    
    static const wxString PARAMETER_TEXT[AxisSystemParamCount - CoordinateBaseParamCount];
+   /// Hash index of the PARAMETER_TEXT labels, used by GetParameterID()
+   static const ParameterIndex PARAMETER_INDEX;
    
    static const Gmat::ParameterType PARAMETER_TYPE[AxisSystemParamCount - CoordinateBaseParamCount];
    
@@ -43,6 +43,10 @@ CoordinateBase::PARAMETER_TEXT[CoordinateBaseParamCount - GmatBaseParamCount] =
    wxT("J2000Body"),
 };
 
+const ParameterIndex
+CoordinateBase::PARAMETER_INDEX(PARAMETER_TEXT,
+      GmatBaseParamCount, CoordinateBaseParamCount);
+
 const Gmat::ParameterType
 CoordinateBase::PARAMETER_TYPE[CoordinateBaseParamCount - GmatBaseParamCount] =
 {
@@ -403,11 +407,9 @@ wxString CoordinateBase::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer CoordinateBase::GetParameterID(const wxString &str) const
 {
-   for (Integer i = GmatBaseParamCount; i < CoordinateBaseParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - GmatBaseParamCount])
-         return i;
-   }
+   Integer id = PARAMETER_INDEX.Find(str);
+   if (id != -1)
+      return id;
 
    return GmatBase::GetParameterID(str);
 }
@@ -144,6 +144,8 @@ protected:
    };
    
    static const wxString PARAMETER_TEXT[CoordinateBaseParamCount - GmatBaseParamCount];
+   /// Hash index of the PARAMETER_TEXT labels, used by GetParameterID()
+   static const ParameterIndex PARAMETER_INDEX;
    
    static const Gmat::ParameterType PARAMETER_TYPE[CoordinateBaseParamCount - GmatBaseParamCount];
    
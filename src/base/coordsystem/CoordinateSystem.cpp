@@ -69,6 +69,10 @@ CoordinateSystem::PARAMETER_TEXT[CoordinateSystemParamCount - CoordinateBasePara
    wxT("Epoch"),
 };
 
+const ParameterIndex
+CoordinateSystem::PARAMETER_INDEX(PARAMETER_TEXT,
+      CoordinateBaseParamCount, CoordinateSystemParamCount);
+
 const Gmat::ParameterType
 CoordinateSystem::PARAMETER_TYPE[CoordinateSystemParamCount - CoordinateBaseParamCount] =
 {
@@ -816,11 +820,9 @@ wxString CoordinateSystem::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer CoordinateSystem::GetParameterID(const wxString &str) const
 {
-   for (Integer i = CoordinateBaseParamCount; i < CoordinateSystemParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - CoordinateBaseParamCount])
-         return i;
-   }
+   Integer id = PARAMETER_INDEX.Find(str);
+   if (id != -1)
+      return id;
    
    return CoordinateBase::GetParameterID(str);
 }
@@ -174,6 +174,8 @@ protected:
    
    static const wxString PARAMETER_TEXT[
       CoordinateSystemParamCount - CoordinateBaseParamCount];
+   /// Hash index of the PARAMETER_TEXT labels, used by GetParameterID()
+   static const ParameterIndex PARAMETER_INDEX;
    
    static const Gmat::ParameterType PARAMETER_TYPE[
       CoordinateSystemParamCount - CoordinateBaseParamCount];
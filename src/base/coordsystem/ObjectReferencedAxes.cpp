@@ -58,6 +58,10 @@ ObjectReferencedAxes::PARAMETER_TEXT[ObjectReferencedAxesParamCount - DynamicAxe
    wxT("Secondary"),
 };
 
+const ParameterIndex
+ObjectReferencedAxes::PARAMETER_INDEX(PARAMETER_TEXT,
+      DynamicAxesParamCount, ObjectReferencedAxesParamCount);
+
 const Gmat::ParameterType
 ObjectReferencedAxes::PARAMETER_TYPE[ObjectReferencedAxesParamCount - DynamicAxesParamCount] =
 {
@@ -455,11 +459,9 @@ wxString ObjectReferencedAxes::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer ObjectReferencedAxes::GetParameterID(const wxString &str) const
 {
-   for (Integer i = DynamicAxesParamCount; i < ObjectReferencedAxesParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - DynamicAxesParamCount])
-         return i;
-   }
+   Integer id = PARAMETER_INDEX.Find(str);
+   if (id != -1)
+      return id;
 
    return DynamicAxes::GetParameterID(str);
 }
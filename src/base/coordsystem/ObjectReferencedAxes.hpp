@@ -107,6 +107,8 @@ protected:
    
    static const wxString PARAMETER_TEXT[ObjectReferencedAxesParamCount - 
                                            DynamicAxesParamCount];
+   /// Hash index of the PARAMETER_TEXT labels, used by GetParameterID()
+   static const ParameterIndex PARAMETER_INDEX;
    
    static const Gmat::ParameterType PARAMETER_TYPE[ObjectReferencedAxesParamCount - 
                                                    DynamicAxesParamCount];
@@ -48,6 +48,10 @@ EventLocator::PARAMETER_TEXT[EventLocatorParamCount - GmatBaseParamCount] =
    wxT("EventFunction")      // EVENT_FUNCTION (Read only)
 };
 
+const ParameterIndex
+EventLocator::PARAMETER_INDEX(PARAMETER_TEXT,
+      GmatBaseParamCount, EventLocatorParamCount);
+
 const Gmat::ParameterType
 EventLocator::PARAMETER_TYPE[EventLocatorParamCount - GmatBaseParamCount] =
 {
@@ -216,11 +220,9 @@ wxString EventLocator::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer EventLocator::GetParameterID(const wxString &str) const
 {
-   for (Integer i = GmatBaseParamCount; i < EventLocatorParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - GmatBaseParamCount])
-         return i;
-   }
+   Integer id = PARAMETER_INDEX.Find(str);
+   if (id != -1)
+      return id;
 
    return GmatBase::GetParameterID(str);
 }
@@ -68,6 +68,8 @@
 #include "StringUtil.hpp"           // for GmatStringUtil::
 #include "FileUtil.hpp"             // for GmatFileUtil::
 #include <algorithm>                // for sort(), set_difference()
+#include <fstream>                  // for rerun cache script text
+#include <sstream>
 #include <wx/datetime.h>                    // for clock()
 #include <wx/sstream.h>
 #include <wx/txtstrm.h>
@@ -6122,6 +6124,8 @@ bool Moderator::ClearResource()
    MessageInterface::ShowMessage(wxT("   Removing configured objects...\n"));
    #endif
    
+   ClearRerunCache();
+   
    theConfigManager->RemoveAllItems();
    
    #if DEBUG_SEQUENCE_CLEARING
@@ -6193,6 +6197,8 @@ bool Moderator::ClearCommandSeq(bool leaveFirstCmd, bool callRunComplete,
    MessageInterface::ShowMessage(wxT("Moderator::ClearCommandSeq() entered\n"));
    #endif
    
+   ClearRerunCache();
+   
    if (commands.empty())
    {
       #if DEBUG_SEQUENCE_CLEARING
@@ -6563,6 +6569,18 @@ bool Moderator::InterpretScript(const wxString &filename, bool readBack,
    endOfInterpreter = false;
    runState = Gmat::IDLE;
    
+   // Reuse the configured objects and mission sequence if this script was the
+   // last one interpreted and neither it nor the configuration has changed
+   if (!readBack && IsRerunCacheCurrent(filename))
+   {
+      MessageInterface::ShowMessage
+         (wxT("\nRerunning the mission of the unchanged script.\n***** file: ") +
+          filename + wxT("\n"));
+      isRunReady = true;
+      endOfInterpreter = true;
+      return true;
+   }
+   
    //MessageInterface::ShowMessage(wxT("========================================\n"));
    MessageInterface::ShowMessage
       (wxT("\nInterpreting scripts from the file.\n***** file: ") + filename + wxT("\n"));
@@ -6700,6 +6718,8 @@ bool Moderator::InterpretScript(const wxString &filename, bool readBack,
       MessageInterface::ShowMessage(wxT("Moderator::InterpretScript() returning %d\n"), isGoodScript);
       #endif
 
+      if (!readBack)
+         SaveRerunCache(filename);
    }
    
    return isGoodScript;
@@ -6865,6 +6885,71 @@ Integer Moderator::RunScript(Integer sandboxNum)
    return RunMission(sandboxNum);
 }
 
+
+// Rerun cache
+//------------------------------------------------------------------------------
+// void EnableRerunCache(bool enable)
+//------------------------------------------------------------------------------
+/**
+ * Turns reuse of the last interpreted mission on or off.
+ *
+ * When enabled, the text of the last interpreted script file is kept
+ * alongside the configured objects and command sequence built from it.
+ * Interpreting the same file again while its text and the configuration are
+ * unchanged skips the script reading, parsing, validation and object creation
+ * and runs the existing mission.  The Sandbox works on clones of the
+ * configured objects and reinitializes the commands on every run, so running
+ * the mission does not alter it.
+ *
+ * The cache is off by default and is only turned on at the user's request.
+ * Only the text of the script file itself is compared; files it pulls in
+ * through #Include, GmatFunction files and data files read during
+ * interpretation are not checked, so the cache must not be enabled while any
+ * of those change between runs.
+ *
+ * This is not a serialized mission image.  Nothing is written to disk, so
+ * only identical reruns of one script within a single process, such as a
+ * batch file listing the script several times, are served.  Any other script,
+ * an edited script, or a new process is interpreted in full.
+ *
+ * @param <enable> true to rerun the cached mission, false to always interpret
+ */
+//------------------------------------------------------------------------------
+void Moderator::EnableRerunCache(bool enable)
+{
+   useRerunCache = enable;
+   if (!useRerunCache)
+      ClearRerunCache();
+}
+
+
+//------------------------------------------------------------------------------
+// bool IsRerunCacheEnabled()
+//------------------------------------------------------------------------------
+/**
+ * @return true if the last mission is rerun for an unchanged script
+ */
+//------------------------------------------------------------------------------
+bool Moderator::IsRerunCacheEnabled()
+{
+   return useRerunCache;
+}
+
+
+//------------------------------------------------------------------------------
+// void ClearRerunCache()
+//------------------------------------------------------------------------------
+/**
+ * Invalidates the rerun cache so that the next script is interpreted.
+ */
+//------------------------------------------------------------------------------
+void Moderator::ClearRerunCache()
+{
+   isRerunCacheValid = false;
+   rerunScriptFile = wxT("");
+   rerunScriptText.clear();
+}
+
 //------------------------------------------------------------------------------
 // bool StartMatlabServer()
 //------------------------------------------------------------------------------
@@ -6952,6 +7037,93 @@ void Moderator::CreateTimeFile()
 }
 
 
+// rerun cache
+//------------------------------------------------------------------------------
+// bool ReadScriptText(const wxString &filename, std::string &text)
+//------------------------------------------------------------------------------
+/**
+ * Reads the raw contents of a script file.
+ *
+ * @param <filename> The script file
+ * @param <text>     The file contents
+ *
+ * @return true if the file was read, false if it could not be opened
+ */
+//------------------------------------------------------------------------------
+bool Moderator::ReadScriptText(const wxString &filename, std::string &text)
+{
+   std::ifstream scriptFile(filename.char_str(),
+                            std::ios::in | std::ios::binary);
+   if (!scriptFile)
+      return false;
+   
+   std::ostringstream contents;
+   contents << scriptFile.rdbuf();
+   text = contents.str();
+   
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// bool IsRerunCacheCurrent(const wxString &filename)
+//------------------------------------------------------------------------------
+/**
+ * Checks if the last mission can be rerun in place of interpreting a script.
+ *
+ * @param <filename> The script file that is about to be interpreted
+ *
+ * @return true if the mission was built from this file, the file text matches
+ *         the text that was interpreted, and the configuration has not been
+ *         changed since (included, function and data files are not checked)
+ */
+//------------------------------------------------------------------------------
+bool Moderator::IsRerunCacheCurrent(const wxString &filename)
+{
+   if (!useRerunCache || !isRerunCacheValid)
+      return false;
+   
+   if ((filename != rerunScriptFile) || HasConfigurationChanged())
+      return false;
+   
+   std::string text;
+   if (!ReadScriptText(filename, text))
+      return false;
+   
+   #if DEBUG_INTERPRET
+   MessageInterface::ShowMessage
+      (wxT("Moderator::IsRerunCacheCurrent() script text %s\n"),
+       (text == rerunScriptText ? wxT("matches") : wxT("has changed")));
+   #endif
+   
+   return (text == rerunScriptText);
+}
+
+
+//------------------------------------------------------------------------------
+// void SaveRerunCache(const wxString &filename)
+//------------------------------------------------------------------------------
+/**
+ * Records the text of the freshly interpreted script for the rerun cache.
+ *
+ * @param <filename> The script file that was interpreted
+ */
+//------------------------------------------------------------------------------
+void Moderator::SaveRerunCache(const wxString &filename)
+{
+   ClearRerunCache();
+   
+   if (!useRerunCache)
+      return;
+   
+   if (ReadScriptText(filename, rerunScriptText))
+   {
+      rerunScriptFile = filename;
+      isRerunCacheValid = true;
+   }
+}
+
+
 // prepare next script reading
 //------------------------------------------------------------------------------
 // void PrepareNextScriptReading(bool clearObjs = true)
@@ -6975,6 +7147,9 @@ void Moderator::PrepareNextScriptReading(bool clearObjs)
    // Set object manage option to configuration
    objectManageOption = 1;
    
+   // Whatever is read next replaces the cached mission
+   ClearRerunCache();
+   
    // Clear command sequence before resource (loj: 2008.07.10)
    if (clearObjs)
    {
@@ -8885,6 +9060,9 @@ Moderator::Moderator()
    objectMapInUse = NULL;
    currentFunction = NULL;
    
+   useRerunCache = false;
+   isRerunCacheValid = false;
+   
    sandboxes.reserve(Gmat::MAX_SANDBOX);
    commands.reserve(Gmat::MAX_SANDBOX);
 }
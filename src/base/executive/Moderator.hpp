@@ -399,6 +399,11 @@ public:
    wxString GetScript(Gmat::WriteMode mode = Gmat::SCRIPTING);
    Integer RunScript(Integer sandboxNum = 1);
    
+   // Rerun cache
+   void EnableRerunCache(bool enable);
+   bool IsRerunCacheEnabled();
+   void ClearRerunCache();
+   
    // MATLAB Server Startup Interface
    bool StartMatlabServer();
    
@@ -464,6 +469,11 @@ private:
    void InitializeSandbox(Integer index);
    void ExecuteSandbox(Integer index);
    
+   // rerun cache
+   bool ReadScriptText(const wxString &filename, std::string &text);
+   bool IsRerunCacheCurrent(const wxString &filename);
+   void SaveRerunCache(const wxString &filename);
+   
    // for Debug
    void ShowCommand(const wxString &title1, GmatCommand *cmd1,
                     const wxString &title2 = wxT(""), GmatCommand *cmd2 = NULL);
@@ -484,6 +494,14 @@ private:
    std::vector<TriggerManager*> triggerManagers;
    std::vector<GmatCommand*> commands;
    
+   // Rerun cache: the text of the last interpreted script, so its configured
+   // objects and command sequence are reused when it is run again unchanged
+   // in this process; nothing is serialized
+   bool useRerunCache;
+   bool isRerunCacheValid;
+   wxString rerunScriptFile;
+   std::string rerunScriptText;
+   
    ObjectMap *objectMapInUse;
    Function *currentFunction;
    ObjectArray unmanagedFunctions;
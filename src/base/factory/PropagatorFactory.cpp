@@ -29,8 +29,10 @@
 #include "PrinceDormand78.hpp" 
 #include "AdamsBashforthMoulton.hpp"
 #include "BulirschStoer.hpp"
+#include "OrbitAveragedIntegrator.hpp"
 
 // Ephemeris propagators
+#include "BinaryEphemPropagator.hpp"
 #ifdef __USE_SPICE__
 #include "SPKPropagator.hpp"
 #endif
@@ -92,9 +94,13 @@ Propagator* PropagatorFactory::CreatePropagator(const wxString &ofType,
       return new BulirschStoer(withName);
    if (ofType == wxT("AdamsBashforthMoulton"))
       return new AdamsBashforthMoulton(withName);
+   if (ofType == wxT("OrbitAveraged"))
+      return new OrbitAveragedIntegrator(withName);
 //   if (ofType == wxT("Cowell"))
 //      return new Cowell(withName);
    // EphemerisPropagators
+   if (ofType == wxT("BinaryEphem"))
+      return new BinaryEphemPropagator(withName);
    #ifdef __USE_SPICE__
       if (ofType == wxT("SPK"))
          return new SPKPropagator(withName);
@@ -131,7 +137,9 @@ PropagatorFactory::PropagatorFactory()
             creatables.push_back(wxT("RungeKutta56"));
       creatables.push_back(wxT("BulirschStoer"));
       creatables.push_back(wxT("AdamsBashforthMoulton"));
+      creatables.push_back(wxT("OrbitAveraged"));
 //      creatables.push_back(wxT("Cowell"));
+      creatables.push_back(wxT("BinaryEphem"));
       
       #ifdef __USE_SPICE__
          creatables.push_back(wxT("SPK"));
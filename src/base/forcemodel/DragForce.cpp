@@ -67,8 +67,13 @@ DragForce::PARAMETER_TEXT[DragForceParamCount - PhysicalModelParamCount] =
    wxT("FixedCoordinateSystem"),         // FIXED_COORD_SYSTEM  (Read-only parameter)
    wxT("AngularMomentumUpdateInterval"), // W_UPDATE_INTERVAL (in days, Read-only)
    wxT("KpToApMethod"),                  // KP2AP_METHOD (Read-only)
+   wxT("DensityCacheTolerance"),         // DENSITY_CACHE_TOLERANCE
 };
 
+const ParameterIndex
+DragForce::PARAMETER_INDEX(PARAMETER_TEXT,
+      PhysicalModelParamCount, DragForceParamCount);
+
 const Gmat::ParameterType
 DragForce::PARAMETER_TYPE[DragForceParamCount - PhysicalModelParamCount] =
 {
@@ -82,6 +87,7 @@ DragForce::PARAMETER_TYPE[DragForceParamCount - PhysicalModelParamCount] =
    Gmat::STRING_TYPE,   // wxT("FixedCoordinateSystem")
    Gmat::REAL_TYPE,     // wxT("AngularMomentumUpdateInterval")
    Gmat::INTEGER_TYPE,  // wxT("KpToApMethod")
+   Gmat::REAL_TYPE,     // wxT("DensityCacheTolerance")
 };
 
 //------------------------------------------------------------------------------
@@ -127,7 +133,8 @@ DragForce::DragForce(const wxString &name) :
    fillCartesian           (false),
    cbFixed                 (NULL),
    internalCoordSystem     (NULL),
-   kpApConversion          (0)
+   kpApConversion          (0),
+   densityCacheTolerance   (0.0)
 {
    dimension = 6;
    parameterCount = DragForceParamCount;
@@ -149,6 +156,8 @@ DragForce::DragForce(const wxString &name) :
    ap = CalculateAp(kp);
    
    derivativeIds.push_back(Gmat::CARTESIAN_STATE);
+   derivativeIds.push_back(Gmat::ORBIT_STATE_TRANSITION_MATRIX);
+   derivativeIds.push_back(Gmat::ORBIT_A_MATRIX);
    
    #ifdef DEBUG_DRAGFORCE_DENSITY
        dragdata.open(wxT("DragData.csv"));
@@ -257,7 +266,8 @@ DragForce::DragForce(const DragForce& df) :
    fillCartesian           (df.fillCartesian),
    cbFixed                 (NULL),
    internalCoordSystem     (NULL),
-   kpApConversion          (df.kpApConversion)
+   kpApConversion          (df.kpApConversion),
+   densityCacheTolerance   (df.densityCacheTolerance)
 {
    internalAtmos = NULL;
    if (df.internalAtmos)
@@ -368,6 +378,7 @@ DragForce& DragForce::operator=(const DragForce& df)
    fluxF107              = df.fluxF107;
    fluxF107A             = df.fluxF107A;
    kpApConversion        = df.kpApConversion;
+   densityCacheTolerance = df.densityCacheTolerance;
    kp                    = df.kp;
    ap                    = CalculateAp(kp);
    
@@ -668,6 +679,8 @@ bool DragForce::Initialize()
       
       density   = new Real[satCount];
       prefactor = new Real[satCount];
+      densityGradient.assign(satCount * 3, 0.0);
+      cdPartial.assign(satCount * 3, 0.0);
       
       #ifdef DEBUG_MEMORY
       MemoryTracker::Instance()->Add
@@ -760,6 +773,8 @@ bool DragForce::Initialize()
             atmos->SetSolarSystem(solarSystem);
             atmos->SetUpdateParameters(wUpdateInterval, wUpdateEpoch);
             atmos->SetKpApConversionMethod(kpApConversion);
+            if (atmos->SupportsDensityCache())
+               atmos->SetDensityCacheTolerance(densityCacheTolerance);
 
             angVel = atmos->GetAngularVelocity();
             hasWindModel = atmos->HasWindModel();
@@ -977,7 +992,10 @@ bool DragForce::GetDerivatives(Real *state, Real dt, Integer order,
    #ifdef DEBUG_DRAGFORCE_DENSITY
       dragdata << wxT("Looking up density\n");
    #endif
-   GetDensity(dragState, now);
+   if (fillSTM || fillAMatrix)
+      GetDensity(dragState, now, &densityGradient[0]);
+   else
+      GetDensity(dragState, now);
    Real wind[6];
 
    if (fillCartesian)
@@ -1099,11 +1117,131 @@ bool DragForce::GetDerivatives(Real *state, Real dt, Integer order,
          }
       }
    }
+
+   if (fillSTM || fillAMatrix)
+      FillDragPartials(now);
    
    return true;
 }
 
 
+//------------------------------------------------------------------------------
+// void FillDragPartials(Real now)
+//------------------------------------------------------------------------------
+/**
+ * Builds the drag contribution to the A-matrix and the STM derivative.
+ *
+ * With a = f rho |v_r| v_r, where f is the prefactor and v_r = v - w x r, the
+ * partials are
+ *
+ *    da/dv = f rho (|v_r| I + v_r v_r^T / |v_r|)
+ *    da/dr = f |v_r| v_r grad(rho)^T - da/dv [w x]
+ *
+ * The upper half of the 6x6 matrix is left to the ODEModel.  The partial
+ * with respect to Cd, a / Cd, is saved for GetDragCoefficientPartial().
+ * Local wind models are treated as corotation for the partials.
+ *
+ * @param now The epoch of the derivative data
+ */
+//------------------------------------------------------------------------------
+void DragForce::FillDragPartials(Real now)
+{
+   Real aTilde[36], vRelative[3], vRelMag, factor, dadv[9], cd;
+   Integer i6, s6, a6, element;
+   Integer aiCount = (fillSTM ? stmCount : aMatrixCount);
+   if (aiCount > satCount)
+      aiCount = satCount;
+
+   for (Integer i = 0; i < aiCount; ++i)
+   {
+      i6 = i * 6;
+      s6 = stmStart + i * 36;
+      a6 = aMatrixStart + i * 36;
+
+      // v_rel = v - w x R
+      vRelative[0] = dragState[i6+3] -
+                     (angVel[1]*dragState[i6+2] - angVel[2]*dragState[i6+1]);
+      vRelative[1] = dragState[i6+4] -
+                     (angVel[2]*dragState[ i6 ] - angVel[0]*dragState[i6+2]);
+      vRelative[2] = dragState[i6+5] -
+                     (angVel[0]*dragState[i6+1] - angVel[1]*dragState[ i6 ]);
+      vRelMag = sqrt(vRelative[0]*vRelative[0] + vRelative[1]*vRelative[1] +
+                     vRelative[2]*vRelative[2]);
+
+      factor = prefactor[i] * density[i];
+
+      for (Integer j = 0; j < 3; ++j)
+         for (Integer k = 0; k < 3; ++k)
+            dadv[j*3+k] = factor * ((j == k ? vRelMag : 0.0) +
+                  (vRelMag > 0.0 ? vRelative[j] * vRelative[k] / vRelMag : 0.0));
+
+      // Upper half is the identity/zero block managed by the ODEModel
+      for (Integer j = 0; j < 18; ++j)
+         aTilde[j] = 0.0;
+
+      for (Integer j = 0; j < 3; ++j)
+      {
+         for (Integer k = 0; k < 3; ++k)
+         {
+            // [w x] has rows (0, -w2, w1), (w2, 0, -w0), (-w1, w0, 0), so
+            // d(v_r)/dr = -[w x]
+            Real dadvW = dadv[j*3]   * (k == 0 ? 0.0 :
+                                        (k == 1 ? -angVel[2] : angVel[1])) +
+                         dadv[j*3+1] * (k == 0 ? angVel[2] :
+                                        (k == 1 ? 0.0 : -angVel[0])) +
+                         dadv[j*3+2] * (k == 0 ? -angVel[1] :
+                                        (k == 1 ? angVel[0] : 0.0));
+
+            aTilde[(j+3)*6 + k] = prefactor[i] * vRelMag * vRelative[j] *
+                  densityGradient[i*3+k] - dadvW;
+            aTilde[(j+3)*6 + k + 3] = dadv[j*3+k];
+         }
+      }
+
+      for (element = 0; element < 36; ++element)
+      {
+         if (fillSTM)
+            deriv[s6 + element] = aTilde[element];
+         if (fillAMatrix)
+            deriv[a6 + element] = aTilde[element];
+      }
+
+      cd = (dragCoeff.size() > (UnsignedInt)i ? dragCoeff[i] : 2.2);
+      for (Integer j = 0; j < 3; ++j)
+         cdPartial[i*3+j] = (cd != 0.0 ?
+               factor * vRelMag * vRelative[j] / cd : 0.0);
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// bool GetDragCoefficientPartial(Integer sat, Real *dAdCd)
+//------------------------------------------------------------------------------
+/**
+ * Retrieves the partial of the drag acceleration with respect to Cd.
+ *
+ * The partial is built with the STM and A-matrix data, so it reflects the
+ * most recent derivative call that filled either of them.
+ *
+ * @param sat   Index of the spacecraft in the drag state
+ * @param dAdCd 3-element array that receives da/dCd, in km/s^2
+ *
+ * @return true if the partial is available, false if not
+ */
+//------------------------------------------------------------------------------
+bool DragForce::GetDragCoefficientPartial(Integer sat, Real *dAdCd)
+{
+   if ((sat < 0) || ((UnsignedInt)(sat * 3 + 2) >= cdPartial.size()) ||
+       !(fillSTM || fillAMatrix))
+      return false;
+
+   for (Integer j = 0; j < 3; ++j)
+      dAdCd[j] = cdPartial[sat*3+j];
+
+   return true;
+}
+
+
 //------------------------------------------------------------------------------
 // wxString GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
@@ -1137,11 +1275,9 @@ wxString DragForce::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer DragForce::GetParameterID(const wxString &str) const
 {
-   for (int i = PhysicalModelParamCount; i < DragForceParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - PhysicalModelParamCount])
-         return i;
-   }
+   Integer id = PARAMETER_INDEX.Find(str);
+   if (id != -1)
+      return id;
    
    return PhysicalModel::GetParameterID(str);
 }
@@ -1243,6 +1379,9 @@ Real DragForce::GetRealParameter(const Integer id) const
    if (id == W_UPDATE_INTERVAL)
       return wUpdateInterval;
 
+   if (id == DENSITY_CACHE_TOLERANCE)
+      return densityCacheTolerance;
+
    return PhysicalModel::GetRealParameter(id);
 }
 
@@ -1381,6 +1520,23 @@ Real DragForce::SetRealParameter(const Integer id, const Real value)
       return wUpdateInterval;
    }
 
+   if (id == DENSITY_CACHE_TOLERANCE)
+   {
+      if (value < 0.0)
+      {
+         wxString buffer;
+         buffer << value;
+         throw ODEModelException(
+            wxT("The value of \"") + buffer + wxT("\" for field \"DensityCacheTolerance\"")
+            wxT(" on object \"") + instanceName + wxT("\" is not an allowed value.\n")
+            wxT("The allowed values are: [Real Number >= 0.0]. "));
+      }
+      densityCacheTolerance = value;
+      if (atmos && atmos->SupportsDensityCache())
+         atmos->SetDensityCacheTolerance(densityCacheTolerance);
+      return densityCacheTolerance;
+   }
+
    return PhysicalModel::SetRealParameter(id, value);
 }
 
@@ -1801,9 +1957,12 @@ bool DragForce::SupportsDerivative(Gmat::StateElementId id)
    if (id == Gmat::CARTESIAN_STATE)
       return true;
    
-//   if (id == Gmat::ORBIT_STATE_TRANSITION_MATRIX)
-//      return true;
+   if (id == Gmat::ORBIT_STATE_TRANSITION_MATRIX)
+      return true;
    
+   if (id == Gmat::ORBIT_A_MATRIX)
+      return true;
+
    return PhysicalModel::SupportsDerivative(id);
 }
 
@@ -1842,12 +2001,19 @@ bool DragForce::SetStart(Gmat::StateElementId id, Integer index,
          retval = true;
          break;
          
-//      case Gmat::ORBIT_STATE_TRANSITION_MATRIX:
-//         stmCount = quantity;
-//         stmIndex = index;
-//         fillSTM = true;
-//         retval = true;
-//         break;
+      case Gmat::ORBIT_STATE_TRANSITION_MATRIX:
+         stmCount = quantity;
+         stmStart = index;
+         fillSTM = true;
+         retval = true;
+         break;
+         
+      case Gmat::ORBIT_A_MATRIX:
+         aMatrixCount = quantity;
+         aMatrixStart = index;
+         fillAMatrix = true;
+         retval = true;
+         break;
          
       default:
          break;
@@ -1858,17 +2024,19 @@ bool DragForce::SetStart(Gmat::StateElementId id, Integer index,
 
 
 //------------------------------------------------------------------------------
-// void DragForce::GetDensity(Real *state)
+// void DragForce::GetDensity(Real *state, Real when, Real *gradient)
 //------------------------------------------------------------------------------
 /**
  * Accessor for the density calculation in the embedded AtmosphereModel.
  * 
- * @param state Cartesian position/velocity state specifying where the density
- *              is needed.
- * @param when  TAI Modified Julian epoch for the calculation
+ * @param state    Cartesian position/velocity state specifying where the
+ *                 density is needed.
+ * @param when     TAI Modified Julian epoch for the calculation
+ * @param gradient Optional array that receives the density gradients, 3
+ *                 elements per spacecraft
  */
 //------------------------------------------------------------------------------
-void DragForce::GetDensity(Real *state, Real when)
+void DragForce::GetDensity(Real *state, Real when, Real *gradient)
 {
    #ifdef DEBUG_DRAGFORCE_DENSITY
       dragdata << wxT("Entered DragForce::GetDensity()\n");
@@ -1878,7 +2046,11 @@ void DragForce::GetDensity(Real *state, Real when)
    if (!atmos)
    {
       for (Integer i = 0; i < satCount; ++i)
+      {
          density[i] = 4.0e-13;
+         if (gradient != NULL)
+            gradient[i*3] = gradient[i*3+1] = gradient[i*3+2] = 0.0;
+      }
    }
    else
    {
@@ -1903,7 +2075,10 @@ void DragForce::GetDensity(Real *state, Real when)
          dragdata << wxT("Calling atmos->Density() on ") << atmos->GetTypeName()
                   << wxT("\n");
       #endif
-      atmos->Density(state, density, when, satCount);
+      if (gradient != NULL)
+         atmos->DensityGradient(state, density, gradient, when, satCount);
+      else
+         atmos->Density(state, density, when, satCount);
       #ifdef DEBUG_DRAGFORCE_DENSITY
          dragdata << wxT("Returned from atmos->Density()\n");
       #endif
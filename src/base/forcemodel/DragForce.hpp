@@ -114,6 +114,7 @@ public:
    // Special access methods used by drag forces
    bool                 SetInternalAtmosphereModel(AtmosphereModel* atm);
    AtmosphereModel*     GetInternalAtmosphereModel();
+   bool                 GetDragCoefficientPartial(Integer sat, Real *dAdCd);
    
    // Methods used by the ODEModel to set the state indexes, etc
    virtual bool SupportsDerivative(Gmat::StateElementId id);
@@ -205,12 +206,20 @@ protected:
    CoordinateSystem     *internalCoordSystem;
    /// Index used to select Kp/Ap conversion method.  Default is a table lookup
    Integer              kpApConversion;
+   /// Relative error bound for the atmosphere's density cache (0.0 = off)
+   Real                 densityCacheTolerance;
+   /// Density gradients used for the partials, 3 elements per spacecraft
+   RealArray            densityGradient;
+   /// Partials of the drag acceleration with respect to Cd, 3 per spacecraft
+   RealArray            cdPartial;
 
 
    
    void                 BuildPrefactors();
    void                 TranslateOrigin(const Real *state, const Real now);
-   void                 GetDensity(Real *state, Real when = GmatTimeConstants::MJD_OF_J2000);
+   void                 GetDensity(Real *state, Real when = GmatTimeConstants::MJD_OF_J2000,
+                                   Real *gradient = NULL);
+   void                 FillDragPartials(Real now);
       
    Real                 CalculateAp(Real kp);
    
@@ -228,11 +237,14 @@ protected:
       FIXED_COORD_SYSTEM,
       W_UPDATE_INTERVAL,
       KP2AP_METHOD,
+      DENSITY_CACHE_TOLERANCE,
       DragForceParamCount
    };
    
    static const wxString 
       PARAMETER_TEXT[DragForceParamCount - PhysicalModelParamCount];
+   /// Hash index of the PARAMETER_TEXT labels, used by GetParameterID()
+   static const ParameterIndex PARAMETER_INDEX;
    static const Gmat::ParameterType 
       PARAMETER_TYPE[DragForceParamCount - PhysicalModelParamCount];
 };
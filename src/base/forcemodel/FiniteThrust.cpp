@@ -542,6 +542,7 @@ bool FiniteThrust::GetDerivatives(Real * state, Real dt, Integer order,
    Integer i6, mloc = -1;
    Integer i = 0, j = 0;
    SpaceObject *sat;
+   Real now = epoch + dt / GmatTimeConstants::SECS_PER_DAY;
    
    if (fillCartesian)
    {
@@ -592,7 +593,6 @@ bool FiniteThrust::GetDerivatives(Real * state, Real dt, Integer order,
                  fb != burns.end(); ++fb)
             {
                (*fb)->SetSpacecraftToManeuver((Spacecraft*)sat);
-               Real now = epoch + dt / GmatTimeConstants::SECS_PER_DAY;
                if ((*fb)->Fire(burnData, now)) 
                {
                   #ifdef DEBUG_FINITETHRUST_EXE
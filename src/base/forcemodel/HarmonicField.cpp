@@ -88,6 +88,10 @@ HarmonicField::PARAMETER_TEXT[HarmonicFieldParamCount - PhysicalModelParamCount]
    wxT("TargetCoordinateSystem"),
 };
 
+const ParameterIndex
+HarmonicField::PARAMETER_INDEX(PARAMETER_TEXT,
+      PhysicalModelParamCount, HarmonicFieldParamCount);
+
 const Gmat::ParameterType
 HarmonicField::PARAMETER_TYPE[HarmonicFieldParamCount - PhysicalModelParamCount] =
 {
@@ -430,11 +434,9 @@ Integer HarmonicField::GetParameterID(const wxString &str) const
    if (useStr == wxT("Model"))
       useStr = wxT("PotentialFile");
  
-   for (Integer i = PhysicalModelParamCount; i < HarmonicFieldParamCount; i++)
-   {
-      if (useStr == PARAMETER_TEXT[i - PhysicalModelParamCount])
-         return i;
-   }
+   Integer id = PARAMETER_INDEX.Find(useStr);
+   if (id != -1)
+      return id;
    return PhysicalModel::GetParameterID(str);
 }
 
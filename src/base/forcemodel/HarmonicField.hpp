@@ -135,6 +135,8 @@ protected:
 
    static const wxString PARAMETER_TEXT[
       HarmonicFieldParamCount - PhysicalModelParamCount];
+   /// Hash index of the PARAMETER_TEXT labels, used by GetParameterID()
+   static const ParameterIndex PARAMETER_INDEX;
 
    static const Gmat::ParameterType PARAMETER_TYPE[
       HarmonicFieldParamCount - PhysicalModelParamCount];
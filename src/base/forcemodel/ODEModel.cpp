@@ -57,11 +57,13 @@
 #include "TimeTypes.hpp"
 
 #include "GravityField.hpp"
-//#include wxT("PointMassForce.hpp")
+#include "PointMassForce.hpp"
+#include "SolarRadiationPressure.hpp"
 //#include wxT("Formation.hpp")      // for BuildState()
 
 #include <string.h> 
 #include <algorithm>    // for find()
+#include <wx/stopwatch.h>  // for wxGetLocalTimeMillis()
 
 
 //#define DEBUG_ODEMODEL
@@ -112,6 +114,9 @@ ODEModel::PARAMETER_TEXT[ODEModelParamCount - PhysicalModelParamCount] =
    wxT("RelativisticCorrection"),
    wxT("ErrorControl"),
    wxT("CoordinateSystemList"),
+   wxT("ProfileForces"),
+   wxT("ForceProfile"),
+   wxT("AdaptiveFidelity"),
    
    // owned object parameters
    wxT("Degree"),
@@ -120,6 +125,10 @@ ODEModel::PARAMETER_TEXT[ODEModelParamCount - PhysicalModelParamCount] =
    wxT("UserDefined")
 };
 
+const ParameterIndex
+ODEModel::PARAMETER_INDEX(PARAMETER_TEXT,
+      PhysicalModelParamCount, ODEModelParamCount);
+
 
 const Gmat::ParameterType
 ODEModel::PARAMETER_TYPE[ODEModelParamCount - PhysicalModelParamCount] =
@@ -132,6 +141,9 @@ ODEModel::PARAMETER_TYPE[ODEModelParamCount - PhysicalModelParamCount] =
    Gmat::ON_OFF_TYPE,       // wxT("RelativisticCorrection"),
    Gmat::ENUMERATION_TYPE,  // wxT("ErrorControl"),
    Gmat::OBJECTARRAY_TYPE,  // wxT("CoordinateSystemList")
+   Gmat::ON_OFF_TYPE,       // wxT("ProfileForces"),
+   Gmat::STRING_TYPE,       // wxT("ForceProfile"),
+   Gmat::ON_OFF_TYPE,       // wxT("AdaptiveFidelity"),
    
    // owned object parameters
    Gmat::INTEGER_TYPE,      // wxT("Degree"),
@@ -148,6 +160,30 @@ std::map<wxString, wxString> ODEModel::scriptAliases;
 // static methods
 //--------------------------------------------------------------------------------
 
+//------------------------------------------------------------------------------
+// wxLongLong ProfileClock()
+//------------------------------------------------------------------------------
+/**
+ * Reads the wall clock used by the force profiler.
+ *
+ * wxWidgets 2.9.3 and later read the clock to the microsecond.  Older versions
+ * read it to the millisecond, so calls shorter than that are timed in the
+ * aggregate: each call is charged the whole milliseconds that tick over during
+ * it, which averages to the true time over many calls.
+ *
+ * @return The clock reading, in microseconds
+ */
+//------------------------------------------------------------------------------
+static wxLongLong ProfileClock()
+{
+   #if wxCHECK_VERSION(2, 9, 3)
+      return wxGetUTCTimeUSec();
+   #else
+      return wxGetLocalTimeMillis() * 1000;
+   #endif
+}
+
+
 //------------------------------------------------------------------------------
 // void SetScriptAlias(const wxString& alias, const wxString& typeName)
 //------------------------------------------------------------------------------
@@ -236,7 +272,11 @@ ODEModel::ODEModel(const wxString &modelName, const wxString typeName) :
    j2kBody           (NULL),
    earthEq           (NULL),
    earthFixed        (NULL),
-   transientCount    (0)
+   transientCount    (0),
+   profileForces     (false),
+   adaptiveFidelity  (false),
+   fidelityStepCount (0),
+   boundaryStep      (0.0)
 {
    satIds[0] = satIds[1] = satIds[2] = satIds[3] = satIds[4] = 
    satIds[5] = satIds[6] = -1;
@@ -326,7 +366,11 @@ ODEModel::ODEModel(const ODEModel& fdf) :
    j2kBody                    (fdf.j2kBody),
    earthEq                    (fdf.earthEq),
    earthFixed                 (fdf.earthFixed),
-   transientCount             (fdf.transientCount)
+   transientCount             (fdf.transientCount),
+   profileForces              (fdf.profileForces),
+   adaptiveFidelity           (fdf.adaptiveFidelity),
+   fidelityStepCount          (0),
+   boundaryStep               (0.0)
 {
    #ifdef DEBUG_ODEMODEL
    MessageInterface::ShowMessage(wxT("ODEModel copy constructor entered\n"));
@@ -428,6 +472,11 @@ ODEModel& ODEModel::operator=(const ODEModel& fdf)
    earthFixed          = fdf.earthFixed; 
    forceMembersNotInitialized = fdf.forceMembersNotInitialized;
    transientCount      = fdf.transientCount;
+   profileForces       = fdf.profileForces;
+   forceProfile.clear();
+   adaptiveFidelity    = fdf.adaptiveFidelity;
+   fidelityStepCount   = 0;
+   boundaryStep        = 0.0;
 
    // Clear owned objects before clone
    ClearForceList();
@@ -599,6 +648,7 @@ void ODEModel::AddForce(PhysicalModel *pPhysicalModel)
       forceList.push_back(pPhysicalModel);
    }
    numForces = forceList.size();
+   UpdateSkippedForces();
    
    // Update owned object count
    ownedObjectCount = numForces;
@@ -626,9 +676,14 @@ void ODEModel::DeleteForce(const wxString &name)
       wxString pmName = (*force)->GetName();
       if (name == pmName)
       {
+         RestoreFidelity();
+         UnfusePointMasses();
+         forceProfile.clear();
+         derivativeRanges.clear();
          PhysicalModel* pm = *force;
          forceList.erase(force);
          numForces = forceList.size();
+         UpdateSkippedForces();
          
          if (!pm->IsTransient())
          {
@@ -665,9 +720,14 @@ void ODEModel::DeleteForce(PhysicalModel *pPhysicalModel)
    {
       if (*force == pPhysicalModel)
       {
+         RestoreFidelity();
+         UnfusePointMasses();
+         forceProfile.clear();
+         derivativeRanges.clear();
          PhysicalModel* pm = *force;
          forceList.erase(force);
          numForces = forceList.size();
+         UpdateSkippedForces();
          
          if (!pm->IsTransient())
          {
@@ -1018,6 +1078,16 @@ bool ODEModel::BuildModelFromMap()
    Gmat::StateElementId id = Gmat::UNKNOWN_STATE;
    GmatBase *currentObject = NULL;
 
+   // The derivative ranges are rebuilt with the model elements
+   derivativeRanges.clear();
+   DerivativeRange range;
+   for (std::vector<PhysicalModel *>::iterator i = forceList.begin();
+         i != forceList.end(); ++i)
+   {
+      range.force = *i;
+      derivativeRanges.push_back(range);
+   }
+
    dynamicProperties = false;
    dynamicsIndex.clear();
    dynamicObjects.clear();
@@ -1150,6 +1220,13 @@ bool ODEModel::BuildModelElement(Gmat::StateElementId id, Integer start,
    bool retval = false, tf;
    Integer modelsUsed = 0;
 
+   // Find the end of the block of state data for the element
+   const std::vector<ListItem*> *map = psm->GetStateMap();
+   Integer end = start;
+   while ((end < (Integer)map->size()) &&
+          ((Gmat::StateElementId)((*map)[end]->elementID) == id))
+      ++end;
+
    #ifdef DEBUG_BUILDING_MODELS
       MessageInterface::ShowMessage(wxT("Building ODEModel element; id = %d, ")
             wxT("index = %d, count = %d; force list has %d elements\n"), id, start,
@@ -1173,8 +1250,17 @@ bool ODEModel::BuildModelElement(Gmat::StateElementId id, Integer start,
                   wxT("though it registered support for derivatives of type %d\n"),
                   (*i)->GetTypeName().c_str(), id);
          else
+         {
             ++modelsUsed;
 
+            UnsignedInt index = i - forceList.begin();
+            if (index < derivativeRanges.size())
+            {
+               derivativeRanges[index].ranges.push_back(start);
+               derivativeRanges[index].ranges.push_back(end);
+            }
+         }
+
          if (retval == false)
             retval = tf;
       }
@@ -1380,6 +1466,14 @@ bool ODEModel::Initialize()
       }
    }
 
+   // Start at full fidelity, and check it on the first step
+   RestoreFidelity();
+   fidelityStepCount = FIDELITY_CHECK_STEPS;
+   boundaryStep      = 0.0;
+
+   // Evaluate the third body point masses together
+   FusePointMasses();
+
    #ifdef DEBUG_FORCE_EPOCHS
       wxString epfile = wxT("ForceEpochs.txt");
       if (instanceName != wxT(""))
@@ -1434,6 +1528,11 @@ void ODEModel::ClearForceList(bool deleteTransient)
       (wxT("ODEModel::ClearForceList() entered, there are %d forces\n"), forceList.size());
    #endif
    
+   RestoreFidelity();
+   UnfusePointMasses();
+   forceProfile.clear();
+   derivativeRanges.clear();
+
    // Delete the owned forces
    std::vector<PhysicalModel *>::iterator ppm = forceList.begin();
    PhysicalModel *pm;
@@ -1462,7 +1561,88 @@ void ODEModel::ClearForceList(bool deleteTransient)
       }
       ppm = forceList.begin();
    }
-   
+
+   UpdateSkippedForces();
+}
+
+
+//------------------------------------------------------------------------------
+// void FusePointMasses()
+//------------------------------------------------------------------------------
+/**
+ * Groups the third body point mass forces so they are evaluated together.
+ *
+ * The first third body PointMassForce in the force list evaluates every other
+ * third body, sharing the origin state and the pass over the spacecraft; the
+ * other third body forces are skipped during superposition.  The point mass
+ * at the force origin is left alone.  This method is called once the forces
+ * are initialized, so that their bodies are set.
+ */
+//------------------------------------------------------------------------------
+void ODEModel::FusePointMasses()
+{
+   UnfusePointMasses();
+
+   PointMassForce *leader = NULL;
+   for (std::vector<PhysicalModel *>::iterator i = forceList.begin();
+        i != forceList.end(); ++i)
+   {
+      if ((*i)->GetTypeName() != wxT("PointMassForce"))
+         continue;
+
+      PointMassForce *pmf = (PointMassForce*)(*i);
+      if ((pmf->GetBody() == NULL) ||
+          (pmf->GetBody() == pmf->GetForceOrigin()))
+         continue;
+
+      // Bodies dropped by the adaptive fidelity check stay out of the group
+      if (find(droppedForces.begin(), droppedForces.end(), pmf) !=
+          droppedForces.end())
+         continue;
+
+      if (leader == NULL)
+         leader = pmf;
+      else
+      {
+         leader->FusePointMass(pmf);
+         fusedForces.push_back(pmf);
+      }
+   }
+   UpdateSkippedForces();
+
+   #ifdef DEBUG_ODEMODEL_INIT
+      MessageInterface::ShowMessage(wxT("ODEModel::FusePointMasses() ")
+            wxT("evaluates %d third bodies with the %s point mass\n"),
+            fusedForces.size() + (leader == NULL ? 0 : 1),
+            (leader == NULL ? wxT("(none)") : leader->GetBodyName().c_str()));
+   #endif
+}
+
+
+//------------------------------------------------------------------------------
+// void UnfusePointMasses()
+//------------------------------------------------------------------------------
+/**
+ * Returns every point mass force to evaluating its own body.
+ *
+ * Called before forces are removed, so no force is left evaluating a body
+ * whose force is gone.
+ */
+//------------------------------------------------------------------------------
+void ODEModel::UnfusePointMasses()
+{
+   if (fusedForces.empty())
+      return;
+
+   for (std::vector<PhysicalModel *>::iterator i = forceList.begin();
+        i != forceList.end(); ++i)
+   {
+      if ((*i)->GetTypeName() == wxT("PointMassForce"))
+         ((PointMassForce*)(*i))->ClearFusedPointMasses();
+   }
+
+   fusedForces.clear();
+   UpdateSkippedForces();
 }
 
 
@@ -2125,6 +2305,16 @@ bool ODEModel::GetDerivatives(Real * state, Real dt, Integer order,
       MessageInterface::ShowMessage(wxT("%le]\n"), state[dimension-1]);
    #endif
   
+   // Fidelity changes are made at the start of an integration step, once
+   // IncrementTime() has counted enough accepted steps
+   if (adaptiveFidelity && (dt == 0.0) && !fillSTM && !fillAMatrix &&
+       (fidelityStepCount >= FIDELITY_CHECK_STEPS))
+   {
+      fidelityStepCount = 0;
+      if (!CheckFidelity(state, dt, order))
+         return false;
+   }
+
    PrepareDerivativeArray();
 
    const Real* ddt;
@@ -2142,7 +2332,18 @@ bool ODEModel::GetDerivatives(Real * state, Real dt, Integer order,
          MessageInterface::ShowMessage(wxT("   %s\n"), ((*i)->GetTypeName()).c_str());
       #endif
    
+      // Fused point masses are evaluated by their group's first point mass,
+      // and negligible forces are skipped until the next fidelity check
+      UnsignedInt forceIndex = i - forceList.begin();
+      if ((forceIndex < skippedForces.size()) && skippedForces[forceIndex])
+         continue;
+
       ddt = (*i)->GetDerivativeArray();
+
+      wxLongLong t1 = 0;
+      if (profileForces)
+         t1 = ProfileClock();
+
       if (!(*i)->GetDerivatives(state, dt, order))
       {
          #ifdef DEBUG_ODEMODEL_EXE
@@ -2152,6 +2353,30 @@ bool ODEModel::GetDerivatives(Real * state, Real dt, Integer order,
          return false;
 
       }
+
+      if (profileForces)
+      {
+         wxLongLong t2 = ProfileClock();
+         UnsignedInt index = i - forceList.begin();
+         if ((forceProfile.size() != forceList.size()) ||
+             (forceProfile[index].force != *i))
+            ResetForceProfile();
+
+         ForceProfileData &data = forceProfile[index];
+         ++data.calls;
+         data.microseconds += (t2 - t1).ToDouble();
+
+         // Acceleration components follow the velocity for first order
+         // derivatives, and lead the block for second order derivatives
+         Integer offset = (order == 1 ? 3 : 0);
+         for (Integer j = 0; j < cartesianCount; ++j)
+         {
+            const Real *accel = &ddt[cartesianStart + j * 6 + offset];
+            data.accelSum += sqrt(accel[0]*accel[0] + accel[1]*accel[1] +
+                                  accel[2]*accel[2]);
+            ++data.accelCount;
+         }
+      }
       
       #ifdef DEBUG_ODEMODEL_EXE
       for (Integer j = 0; j < dimension; ++j)
@@ -2164,14 +2389,24 @@ bool ODEModel::GetDerivatives(Real * state, Real dt, Integer order,
       #ifdef DEBUG_ODEMODEL_EXE
          MessageInterface::ShowMessage(wxT("  deriv = ["));
       #endif
-      for (Integer j = 0; j < dimension; ++j)
+      // Only add the parts of the state the force registered for
+      UnsignedInt index = i - forceList.begin();
+      if ((index < derivativeRanges.size()) &&
+          (derivativeRanges[index].force == *i))
       {
-         deriv[j] += ddt[j];
-         #ifdef DEBUG_ODEMODEL_EXE
-            MessageInterface::ShowMessage(wxT(" %16.14le "), ddt[j]);
-         #endif
+         const IntegerArray &ranges = derivativeRanges[index].ranges;
+         for (UnsignedInt r = 0; r < ranges.size(); r += 2)
+            for (Integer j = ranges[r]; j < ranges[r+1]; ++j)
+               deriv[j] += ddt[j];
+      }
+      else
+      {
+         for (Integer j = 0; j < dimension; ++j)
+            deriv[j] += ddt[j];
       }
       #ifdef DEBUG_ODEMODEL_EXE
+         for (Integer j = 0; j < dimension; ++j)
+            MessageInterface::ShowMessage(wxT(" %16.14le "), ddt[j]);
          MessageInterface::ShowMessage(wxT("]\n"));
       #endif
 
@@ -2495,6 +2730,97 @@ Real ODEModel::EstimateError(Real *diffs, Real *answer) const
 }
 
 
+//------------------------------------------------------------------------------
+// bool HasStepBoundaries()
+//------------------------------------------------------------------------------
+/**
+ * Checks the forces for discontinuities that integrators should step onto.
+ *
+ * @return true if any force in the model reports step boundaries.
+ */
+//------------------------------------------------------------------------------
+bool ODEModel::HasStepBoundaries()
+{
+   for (std::vector<PhysicalModel *>::iterator i = forceList.begin();
+         i != forceList.end(); ++i)
+      if ((*i)->HasStepBoundaries())
+         return true;
+
+   return false;
+}
+
+
+//------------------------------------------------------------------------------
+// Real FindStepBoundary(const Real *startState, const Real *endState, Real dt)
+//------------------------------------------------------------------------------
+/**
+ * Finds the earliest force discontinuity crossed during a candidate step.
+ *
+ * @param startState The propagation state at the start of the step
+ * @param endState   The candidate propagation state at the end of the step
+ * @param dt         The step size, in seconds
+ *
+ * @return The elapsed time to the first boundary, or dt if there is none.
+ */
+//------------------------------------------------------------------------------
+Real ODEModel::FindStepBoundary(const Real *startState, const Real *endState,
+      Real dt)
+{
+   Real boundary = dt, candidate;
+
+   for (std::vector<PhysicalModel *>::iterator i = forceList.begin();
+         i != forceList.end(); ++i)
+   {
+      if ((*i)->HasStepBoundaries())
+      {
+         candidate = (*i)->FindStepBoundary(startState, endState, dt);
+         if (fabs(candidate) < fabs(boundary))
+            boundary = candidate;
+      }
+   }
+
+   #ifdef DEBUG_STEP_BOUNDARIES
+      if (boundary != dt)
+         MessageInterface::ShowMessage(wxT("Step of %.12lf s ends on a force ")
+               wxT("boundary at %.12lf s\n"), dt, boundary);
+   #endif
+
+   // IncrementTime() checks whether the accepted step lands on the boundary
+   boundaryStep = (boundary != dt ? boundary : 0.0);
+
+   return boundary;
+}
+
+
+//------------------------------------------------------------------------------
+// void IncrementTime(Real dt)
+//------------------------------------------------------------------------------
+/**
+ * Advances the elapsed time after the integrator accepts a step.
+ *
+ * Accepted steps are counted for the adaptive fidelity check.  Forces change
+ * across a boundary, so a step that ends on one brings the check forward to
+ * the next step.
+ *
+ * @param dt The accepted step, in seconds
+ */
+//------------------------------------------------------------------------------
+void ODEModel::IncrementTime(Real dt)
+{
+   PhysicalModel::IncrementTime(dt);
+
+   if (adaptiveFidelity)
+   {
+      // The landing step is taken with exactly the boundary step size
+      if ((boundaryStep != 0.0) && (dt == boundaryStep))
+         fidelityStepCount = FIDELITY_CHECK_STEPS;
+      else
+         ++fidelityStepCount;
+   }
+   boundaryStep = 0.0;
+}
+
+
 //---------------------------------------------------------------------------
 // bool TakeAction(const wxString &action, const wxString &actionData = wxT(""))
 //---------------------------------------------------------------------------
@@ -2515,6 +2841,7 @@ bool ODEModel::TakeAction(const wxString &action, const wxString &actionData)
       {
          PhysicalModel *oldForce = *oldIter;
          forceList.erase(oldIter);
+         UpdateSkippedForces();
          
          #ifdef DEBUG_DEFAULT_FORCE
          MessageInterface::ShowMessage
@@ -2528,6 +2855,16 @@ bool ODEModel::TakeAction(const wxString &action, const wxString &actionData)
          delete oldForce;
       }
    }
+   else if (action == wxT("ResetForceProfile"))
+   {
+      ResetForceProfile();
+   }
+   else if (action == wxT("ReportForceProfile"))
+   {
+      if (profileForces)
+         MessageInterface::ShowMessage(wxT("%s"),
+               BuildForceProfileReport().c_str());
+   }
    
    return true;
 }
@@ -2899,13 +3236,9 @@ Integer ODEModel::GetParameterID(const wxString &str) const
    if (alias == wxT("Gravity"))
       alias = wxT("PrimaryBodies");
    
-   for (int i = PhysicalModelParamCount; i < ODEModelParamCount; i++)
-   {
-      if (alias == PARAMETER_TEXT[i - PhysicalModelParamCount])
-      {
-         return i;
-      }
-   }
+   Integer id = PARAMETER_INDEX.Find(alias);
+   if (id != -1)
+      return id;
    
    return PhysicalModel::GetParameterID(str);
 }
@@ -2938,7 +3271,7 @@ wxString ODEModel::GetParameterTypeString(const Integer id) const
 bool ODEModel::IsParameterReadOnly(const Integer id) const
 {
    if (id == COORDINATE_SYSTEM_LIST || id == DEGREE || id == ORDER ||
-       id == POTENTIAL_FILE)
+       id == POTENTIAL_FILE || id == FORCE_PROFILE)
       return true;
    
    return PhysicalModel::IsParameterReadOnly(id);
@@ -2951,6 +3284,8 @@ bool ODEModel::IsParameterReadOnly(const wxString &label) const
 {
    if (label == PARAMETER_TEXT[COORDINATE_SYSTEM_LIST-PhysicalModelParamCount])
       return true;
+   if (label == PARAMETER_TEXT[FORCE_PROFILE-PhysicalModelParamCount])
+      return true;
    
    return PhysicalModel::IsParameterReadOnly(label);
 }
@@ -3012,6 +3347,9 @@ wxString ODEModel::GetStringParameter(const Integer id) const
             return owner->GetStringParameter(actualId);
          }
          
+      case FORCE_PROFILE:
+         return ((ODEModel*)this)->BuildForceProfileReport();
+         
       default:
          return PhysicalModel::GetStringParameter(id);
    }
@@ -3128,6 +3466,10 @@ wxString ODEModel::GetOnOffParameter(const Integer id) const
             return wxT("Off");
          return wxT("On");
       }
+   case PROFILE_FORCES:
+      return (profileForces ? wxT("On") : wxT("Off"));
+   case ADAPTIVE_FIDELITY:
+      return (adaptiveFidelity ? wxT("On") : wxT("Off"));
    default:
       return PhysicalModel::GetOnOffParameter(id);
    }
@@ -3145,6 +3487,27 @@ bool ODEModel::SetOnOffParameter(const Integer id, const wxString &value)
       return true;
    case RELATIVISTIC_CORRECTION:
       return true;
+   case PROFILE_FORCES:
+      if (value == wxT("On"))
+         profileForces = true;
+      else if (value == wxT("Off"))
+         profileForces = false;
+      else
+         return false;
+      ResetForceProfile();
+      return true;
+   case ADAPTIVE_FIDELITY:
+      if (value == wxT("On"))
+         adaptiveFidelity = true;
+      else if (value == wxT("Off"))
+      {
+         adaptiveFidelity = false;
+         RestoreFidelity();
+         FusePointMasses();
+      }
+      else
+         return false;
+      return true;
    default:
       return PhysicalModel::SetOnOffParameter(id, value);
    }
@@ -3497,6 +3860,526 @@ wxString ODEModel::BuildForceNameString(PhysicalModel *force)
 }
 
 
+//------------------------------------------------------------------------------
+// void ResetForceProfile()
+//------------------------------------------------------------------------------
+/**
+ * Starts a new force profile, with one empty entry per force in the model.
+ *
+ * The Propagate command calls this, through TakeAction(), at the start of each
+ * propagation segment.
+ */
+//------------------------------------------------------------------------------
+void ODEModel::ResetForceProfile()
+{
+   forceProfile.clear();
+   if (!profileForces)
+      return;
+
+   ForceProfileData data;
+   data.calls      = 0;
+   data.microseconds = 0.0;
+   data.accelSum   = 0.0;
+   data.accelCount = 0;
+   for (std::vector<PhysicalModel *>::iterator i = forceList.begin();
+        i != forceList.end(); ++i)
+   {
+      data.force = *i;
+      forceProfile.push_back(data);
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// wxString BuildForceProfileReport()
+//------------------------------------------------------------------------------
+/**
+ * Builds a table of the profile data collected since the last reset.
+ *
+ * Each force is listed with its call count, the total and per call wall clock
+ * time spent in its GetDerivatives() method, and the mean magnitude of the
+ * acceleration it contributed to the spacecraft.  Third body point masses that
+ * are evaluated together are reported on the first point mass of the group.
+ *
+ * @return The report text
+ */
+//------------------------------------------------------------------------------
+wxString ODEModel::BuildForceProfileReport()
+{
+   wxString report = wxT("Force profile for ") + instanceName + wxT("\n");
+   if (!profileForces)
+      return report + wxT("   Profiling is off; set ProfileForces = On\n");
+
+   report += wxT("   Force                          Calls    Time (sec)  ")
+             wxT("  usec/call   Mean |accel| (km/s^2)\n");
+
+   Real totalTime = 0.0;
+   wxString line;
+   for (UnsignedInt i = 0; i < forceProfile.size(); ++i)
+   {
+      const ForceProfileData &data = forceProfile[i];
+      wxString label = BuildForceNameString(data.force);
+      bool skipped = (i < skippedForces.size()) &&
+            (forceList[i] == data.force) && skippedForces[i];
+      if (skipped &&
+          (find(fusedForces.begin(), fusedForces.end(), data.force) !=
+           fusedForces.end()))
+      {
+         line.Printf(wxT("   %-28s   (evaluated with the first point mass)\n"),
+               label.c_str());
+         report += line;
+         continue;
+      }
+      if (skipped && (data.calls == 0))
+      {
+         line.Printf(wxT("   %-28s   (dropped by the adaptive fidelity check)\n"),
+               label.c_str());
+         report += line;
+         continue;
+      }
+
+      line.Printf(wxT("   %-28s %7d  %12.6lf  %11.3lf   %.6le\n"),
+            label.c_str(), data.calls, 1.0e-6 * data.microseconds,
+            (data.calls > 0 ? data.microseconds / data.calls : 0.0),
+            (data.accelCount > 0 ? data.accelSum / data.accelCount : 0.0));
+      report += line;
+      totalTime += 1.0e-6 * data.microseconds;
+   }
+
+   line.Printf(wxT("   Total time in the forces: %.6lf sec\n"), totalTime);
+   report += line;
+
+   return report;
+}
+
+
+//------------------------------------------------------------------------------
+// bool CheckFidelity(Real *state, Real dt, Integer order)
+//------------------------------------------------------------------------------
+/**
+ * Decides which forces are too small to affect the integration.
+ *
+ * Every force is evaluated at full fidelity, separately, at the input state
+ * and at the perigee and apogee of each spacecraft's osculating orbit, so the
+ * decision holds for the worst case over the orbit rather than for the
+ * current point.  SRP is evaluated in full sun at every sample, so a force
+ * sampled in shadow is never dropped.  A force is negligible for a spacecraft
+ * at a sample when its acceleration is below 1% of the integrator accuracy
+ * times the total acceleration there, so that leaving it out changes each
+ * step by much less than the error the integrator accepts.  Forces that are
+ * negligible at every sample for every spacecraft are dropped from the
+ * superposition, and gravity fields are truncated to the lowest degree that
+ * meets the same test at every sample.
+ *
+ * The check is repeated every FIDELITY_CHECK_STEPS steps, and on the step
+ * after a force boundary like a shadow entry or exit is crossed, so forces
+ * come back, and fields regain degree, when they grow; every change is
+ * written to the message window.
+ *
+ * The check is not made when the STM or A-matrix is propagated, and only
+ * point masses other than the central body, SRP, drag and the relativistic
+ * correction are dropped.  Thrust and user defined forces are always
+ * evaluated.
+ *
+ * @param state The state at the start of the step
+ * @param dt    The time offset of the state (0.0 at the start of a step)
+ * @param order The order of the derivatives
+ *
+ * @return true if the forces were evaluated, false if one of them failed
+ */
+//------------------------------------------------------------------------------
+bool ODEModel::CheckFidelity(Real *state, Real dt, Integer order)
+{
+   Integer offset = (order == 1 ? 3 : 0);
+   Integer forceCount = forceList.size();
+
+   // Evaluate every force by itself, at full degree
+   std::vector<PhysicalModel *> wasDropped = droppedForces;
+   std::vector<HarmonicField *> wasTruncated = truncatedFields;
+   IntegerArray truncatedDegree;
+   for (UnsignedInt j = 0; j < truncatedFields.size(); ++j)
+   {
+      truncatedDegree.push_back(truncatedFields[j]->GetIntegerParameter(
+            truncatedFields[j]->GetParameterID(wxT("Degree"))));
+      truncatedFields[j]->SetDegreeOrder(fullDegree[j], fullOrder[j]);
+   }
+   droppedForces.clear();
+   truncatedFields.clear();
+   fullDegree.clear();
+   fullOrder.clear();
+   UnfusePointMasses();
+
+   RealArray samples;
+   Integer sampleCount = BuildFidelitySamples(state, samples);
+   Integer sampleSize = forceCount * cartesianCount * 3;
+
+   RealArray accel(sampleCount * sampleSize, 0.0);
+   std::vector<RealArray> threshold(sampleCount,
+         RealArray(cartesianCount, 0.0));
+   for (Integer s = 0; s < sampleCount; ++s)
+   {
+      Real *sampleState = &samples[s * dimension];
+      RealArray total(cartesianCount * 3, 0.0);
+      for (Integer k = 0; k < forceCount; ++k)
+      {
+         if (!GetFullSunDerivatives(forceList[k], sampleState, dt, order))
+         {
+            FusePointMasses();
+            return false;
+         }
+         const Real *ddt = forceList[k]->GetDerivativeArray();
+         for (Integer j = 0; j < cartesianCount; ++j)
+            for (Integer m = 0; m < 3; ++m)
+            {
+               accel[s * sampleSize + (k * cartesianCount + j) * 3 + m] =
+                     ddt[cartesianStart + j * 6 + offset + m];
+               total[j * 3 + m] += ddt[cartesianStart + j * 6 + offset + m];
+            }
+      }
+
+      for (Integer j = 0; j < cartesianCount; ++j)
+         threshold[s][j] = 0.01 * integrationAccuracy *
+               sqrt(total[j*3]*total[j*3] + total[j*3+1]*total[j*3+1] +
+                    total[j*3+2]*total[j*3+2]);
+   }
+
+   for (Integer k = 0; k < forceCount; ++k)
+   {
+      PhysicalModel *force = forceList[k];
+
+      if (CanDropForce(force))
+      {
+         bool negligible = true;
+         for (Integer s = 0; s < sampleCount; ++s)
+         {
+            const Real *fa = &accel[s * sampleSize + k * cartesianCount * 3];
+            for (Integer j = 0; j < cartesianCount; ++j)
+               if (sqrt(fa[j*3]*fa[j*3] + fa[j*3+1]*fa[j*3+1] +
+                        fa[j*3+2]*fa[j*3+2]) >= threshold[s][j])
+                  negligible = false;
+         }
+
+         if (negligible)
+         {
+            droppedForces.push_back(force);
+            if (find(wasDropped.begin(), wasDropped.end(), force) ==
+                wasDropped.end())
+               MessageInterface::ShowMessage(wxT("%s: dropping %s; its ")
+                     wxT("acceleration is below the integration accuracy\n"),
+                     instanceName.c_str(),
+                     BuildForceNameString(force).c_str());
+            continue;
+         }
+      }
+
+      if (force->GetTypeName() == wxT("GravityField"))
+      {
+         HarmonicField *field = (HarmonicField*)force;
+         Integer degree = field->GetIntegerParameter(
+               field->GetParameterID(wxT("Degree")));
+         Integer fieldOrder = field->GetIntegerParameter(
+               field->GetParameterID(wxT("Order")));
+         Integer newDegree = (degree < 2 ? degree : 2);
+         for (Integer s = 0; (s < sampleCount) && (newDegree < degree); ++s)
+         {
+            Integer sampleDegree = FindTruncatedDegree(field, degree,
+                  &samples[s * dimension], dt, order,
+                  &accel[s * sampleSize + k * cartesianCount * 3],
+                  threshold[s]);
+            if (sampleDegree > newDegree)
+               newDegree = sampleDegree;
+         }
+
+         Integer oldDegree = degree;
+         std::vector<HarmonicField *>::iterator old =
+               find(wasTruncated.begin(), wasTruncated.end(), field);
+         if (old != wasTruncated.end())
+            oldDegree = truncatedDegree[old - wasTruncated.begin()];
+
+         if (newDegree < degree)
+         {
+            truncatedFields.push_back(field);
+            fullDegree.push_back(degree);
+            fullOrder.push_back(fieldOrder);
+            field->SetDegreeOrder(newDegree,
+                  (fieldOrder < newDegree ? fieldOrder : newDegree));
+         }
+
+         if (newDegree != oldDegree)
+            MessageInterface::ShowMessage(wxT("%s: evaluating %s to degree ")
+                  wxT("%d of %d\n"), instanceName.c_str(),
+                  BuildForceNameString(force).c_str(), newDegree, degree);
+      }
+   }
+
+   // Report forces that are no longer negligible
+   for (std::vector<PhysicalModel *>::iterator i = wasDropped.begin();
+        i != wasDropped.end(); ++i)
+      if (find(droppedForces.begin(), droppedForces.end(), *i) ==
+          droppedForces.end())
+         MessageInterface::ShowMessage(wxT("%s: restoring %s\n"),
+               instanceName.c_str(), BuildForceNameString(*i).c_str());
+
+   FusePointMasses();
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// bool CanDropForce(PhysicalModel *force)
+//------------------------------------------------------------------------------
+/**
+ * Checks if the adaptive fidelity check may leave a force out.
+ *
+ * @param force The force that is checked
+ *
+ * @return true for forces that only contribute a small acceleration
+ */
+//------------------------------------------------------------------------------
+bool ODEModel::CanDropForce(PhysicalModel *force)
+{
+   if (force->IsTransient() || force->IsUserForce())
+      return false;
+
+   wxString forceType = force->GetTypeName();
+   if (forceType == wxT("PointMassForce"))
+      return ((force->GetBody() != NULL) &&
+              (force->GetBody() != force->GetForceOrigin()));
+
+   return ((forceType == wxT("SolarRadiationPressure")) ||
+           (forceType == wxT("DragForce")) ||
+           (forceType == wxT("RelativisticCorrection")));
+}
+
+
+//------------------------------------------------------------------------------
+// Integer BuildFidelitySamples(const Real *state, RealArray &samples)
+//------------------------------------------------------------------------------
+/**
+ * Builds the states the adaptive fidelity check evaluates the forces at.
+ *
+ * The first sample is the input state.  The second puts each spacecraft at
+ * the perigee of its osculating orbit, where drag and the gravity harmonics
+ * are largest, and the third at the apogee, where third body perturbations
+ * are largest.  Spacecraft on near circular orbits keep their current state;
+ * those on open orbits use their current state in place of the apogee.
+ *
+ * @param state   The propagation state
+ * @param samples The sample states, dimension elements each
+ *
+ * @return The number of samples
+ */
+//------------------------------------------------------------------------------
+Integer ODEModel::BuildFidelitySamples(const Real *state, RealArray &samples)
+{
+   Integer sampleCount = ((forceOrigin != NULL) && (cartesianCount > 0) ?
+         3 : 1);
+   samples.assign(sampleCount * dimension, 0.0);
+   for (Integer s = 0; s < sampleCount; ++s)
+      memcpy(&samples[s * dimension], state, dimension * sizeof(Real));
+   if (sampleCount == 1)
+      return sampleCount;
+
+   Real mu = forceOrigin->GetGravitationalConstant();
+   for (Integer j = 0; j < cartesianCount; ++j)
+   {
+      Integer i6 = cartesianStart + j * 6;
+      const Real *r = &state[i6], *v = &state[i6+3];
+
+      Real rMag = sqrt(r[0]*r[0] + r[1]*r[1] + r[2]*r[2]);
+      Real v2 = v[0]*v[0] + v[1]*v[1] + v[2]*v[2];
+      Real rv = r[0]*v[0] + r[1]*v[1] + r[2]*v[2];
+      Real am[3], ecc[3];
+      am[0] = r[1]*v[2] - r[2]*v[1];
+      am[1] = r[2]*v[0] - r[0]*v[2];
+      am[2] = r[0]*v[1] - r[1]*v[0];
+      for (Integer m = 0; m < 3; ++m)
+         ecc[m] = ((v2 - mu / rMag) * r[m] - rv * v[m]) / mu;
+      Real amMag = sqrt(am[0]*am[0] + am[1]*am[1] + am[2]*am[2]);
+      Real e = sqrt(ecc[0]*ecc[0] + ecc[1]*ecc[1] + ecc[2]*ecc[2]);
+
+      if ((rMag == 0.0) || (amMag == 0.0) || (e < 1.0e-6))
+         continue;
+
+      // Unit vectors toward perigee and along the velocity there
+      Real toPeri[3], along[3];
+      for (Integer m = 0; m < 3; ++m)
+         toPeri[m] = ecc[m] / e;
+      along[0] = (am[1]*toPeri[2] - am[2]*toPeri[1]) / amMag;
+      along[1] = (am[2]*toPeri[0] - am[0]*toPeri[2]) / amMag;
+      along[2] = (am[0]*toPeri[1] - am[1]*toPeri[0]) / amMag;
+
+      Real semilatus = amMag * amMag / mu;
+      Real rPeri = semilatus / (1.0 + e);
+      Real *peri = &samples[dimension + i6];
+      for (Integer m = 0; m < 3; ++m)
+      {
+         peri[m]   = rPeri * toPeri[m];
+         peri[m+3] = amMag / rPeri * along[m];
+      }
+
+      if (e < 1.0)
+      {
+         Real rApo = semilatus / (1.0 - e);
+         Real *apo = &samples[2 * dimension + i6];
+         for (Integer m = 0; m < 3; ++m)
+         {
+            apo[m]   = -rApo * toPeri[m];
+            apo[m+3] = -amMag / rApo * along[m];
+         }
+      }
+   }
+
+   return sampleCount;
+}
+
+
+//------------------------------------------------------------------------------
+// bool GetFullSunDerivatives(PhysicalModel *force, Real *state, Real dt,
+//       Integer order)
+//------------------------------------------------------------------------------
+/**
+ * Evaluates a force for the adaptive fidelity check, with SRP in full sun.
+ *
+ * @param force The force
+ * @param state The state used for the evaluation
+ * @param dt    The time offset of the state
+ * @param order The order of the derivatives
+ *
+ * @return true if the force was evaluated
+ */
+//------------------------------------------------------------------------------
+bool ODEModel::GetFullSunDerivatives(PhysicalModel *force, Real *state,
+      Real dt, Integer order)
+{
+   if (force->GetTypeName() != wxT("SolarRadiationPressure"))
+      return force->GetDerivatives(state, dt, order);
+
+   SolarRadiationPressure *srp = (SolarRadiationPressure*)force;
+   srp->SetFullSun(true);
+   bool retval = srp->GetDerivatives(state, dt, order);
+   srp->SetFullSun(false);
+
+   return retval;
+}
+
+
+//------------------------------------------------------------------------------
+// Integer FindTruncatedDegree(HarmonicField *field, Integer scriptedDegree,
+//       Real *state, Real dt, Integer order, const Real *fullAccel,
+//       const RealArray &threshold)
+//------------------------------------------------------------------------------
+/**
+ * Finds the lowest degree that reproduces a gravity field's acceleration to
+ * within the fidelity threshold.
+ *
+ * The degree is found by bisection, evaluating the field at trial degrees.
+ * The field is left at its scripted degree and order.
+ *
+ * @param field          The gravity field
+ * @param scriptedDegree The degree set for the field in the script
+ * @param state          The state used for the evaluations
+ * @param dt             The time offset of the state
+ * @param order          The order of the derivatives
+ * @param fullAccel      The field's accelerations at the scripted degree
+ * @param threshold      The largest acceptable difference, per spacecraft
+ *
+ * @return The lowest acceptable degree, no lower than 2
+ */
+//------------------------------------------------------------------------------
+Integer ODEModel::FindTruncatedDegree(HarmonicField *field,
+      Integer scriptedDegree, Real *state, Real dt, Integer order,
+      const Real *fullAccel, const RealArray &threshold)
+{
+   Integer scriptedOrder = field->GetIntegerParameter(
+         field->GetParameterID(wxT("Order")));
+   Integer offset = (order == 1 ? 3 : 0);
+   Integer low = 2, high = scriptedDegree;
+
+   while (low < high)
+   {
+      Integer trial = (low + high) / 2;
+      field->SetDegreeOrder(trial,
+            (scriptedOrder < trial ? scriptedOrder : trial));
+
+      bool acceptable = field->GetDerivatives(state, dt, order);
+      const Real *ddt = field->GetDerivativeArray();
+      for (Integer j = 0; (j < cartesianCount) && acceptable; ++j)
+      {
+         Real diff[3];
+         for (Integer m = 0; m < 3; ++m)
+            diff[m] = ddt[cartesianStart + j * 6 + offset + m] -
+                      fullAccel[j * 3 + m];
+         if (sqrt(diff[0]*diff[0] + diff[1]*diff[1] + diff[2]*diff[2]) >=
+             threshold[j])
+            acceptable = false;
+      }
+
+      if (acceptable)
+         high = trial;
+      else
+         low = trial + 1;
+   }
+
+   field->SetDegreeOrder(scriptedDegree, scriptedOrder);
+   return (high < scriptedDegree ? high : scriptedDegree);
+}
+
+
+//------------------------------------------------------------------------------
+// void RestoreFidelity()
+//------------------------------------------------------------------------------
+/**
+ * Returns every force to full fidelity.
+ *
+ * Dropped forces are evaluated again and truncated gravity fields get their
+ * scripted degree and order back.  Callers that want the point masses grouped
+ * again call FusePointMasses() afterwards.
+ */
+//------------------------------------------------------------------------------
+void ODEModel::RestoreFidelity()
+{
+   for (UnsignedInt j = 0; j < truncatedFields.size(); ++j)
+      truncatedFields[j]->SetDegreeOrder(fullDegree[j], fullOrder[j]);
+
+   #ifdef DEBUG_ODEMODEL_INIT
+      if (!droppedForces.empty() || !truncatedFields.empty())
+         MessageInterface::ShowMessage(wxT("ODEModel::RestoreFidelity() ")
+               wxT("restored %d forces and %d gravity fields\n"),
+               droppedForces.size(), truncatedFields.size());
+   #endif
+
+   droppedForces.clear();
+   truncatedFields.clear();
+   fullDegree.clear();
+   fullOrder.clear();
+   UpdateSkippedForces();
+}
+
+
+//------------------------------------------------------------------------------
+// void UpdateSkippedForces()
+//------------------------------------------------------------------------------
+/**
+ * Rebuilds the flags marking the fused and dropped forces.
+ *
+ * Called whenever the force list, the point mass groups or the dropped forces
+ * change, so the superposition loop checks a flag rather than searching the
+ * lists for every force on every call.
+ */
+//------------------------------------------------------------------------------
+void ODEModel::UpdateSkippedForces()
+{
+   skippedForces.assign(forceList.size(), false);
+   for (UnsignedInt i = 0; i < forceList.size(); ++i)
+      skippedForces[i] =
+            (find(fusedForces.begin(), fusedForces.end(), forceList[i]) !=
+             fusedForces.end()) ||
+            (find(droppedForces.begin(), droppedForces.end(), forceList[i]) !=
+             droppedForces.end());
+}
+
+
 //------------------------------------------------------------------------------
 // void MoveToOrigin(Real newEpoch)
 //------------------------------------------------------------------------------
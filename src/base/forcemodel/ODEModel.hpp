@@ -72,6 +72,7 @@
 
 
 class PropagationStateManager;
+class HarmonicField;
 
 
 
@@ -113,6 +114,9 @@ public:
    virtual bool GetDerivatives(Real * state, Real dt = 0.0, Integer order = 1, 
          const Integer id = -1);
    virtual Real EstimateError(Real *diffs, Real *answer) const;
+   virtual bool HasStepBoundaries();
+   virtual Real FindStepBoundary(const Real *startState, const Real *endState,
+         Real dt);
       
    void AddForce(PhysicalModel *pPhysicalModel);
    
@@ -138,7 +142,7 @@ public:
 //   void ClearSpacecraft();
 //   bool AddSpaceObject(SpaceObject *so);
 
-//   virtual void IncrementTime(Real dt);
+   virtual void IncrementTime(Real dt);
 //   virtual void SetTime(Real t);
    
    // Take action method inherited from GmatBase
@@ -228,6 +232,10 @@ protected:
    StringArray forceTypeNames;
    /// Array of the forces
    std::vector<PhysicalModel *> forceList;
+   /// Third body point masses evaluated by another point mass force
+   std::vector<PhysicalModel *> fusedForces;
+   /// Flags, in force list order, for forces left out of the superposition
+   std::vector<bool> skippedForces;
 //   /// User defined forces
 //   std::vector<PhysicalModel *> userForces;
    
@@ -287,6 +295,8 @@ protected:
    
    wxString         BuildForceNameString(PhysicalModel *force);
    void                ClearForceList(bool deleteTransient = false);
+   void                FusePointMasses();
+   void                UnfusePointMasses();
    void                ClearInternalCoordinateSystems();
    void                SetInternalCoordinateSystem(const wxString csId,
                                                    PhysicalModel *currentPm);
@@ -329,6 +339,70 @@ private:
 protected:
    Integer transientCount;
 
+   /// State vector ranges that a force fills, as [start, end) pairs
+   struct DerivativeRange
+   {
+      PhysicalModel *force;
+      IntegerArray ranges;
+   };
+
+   /// Derivative ranges for the forces, in force list order
+   std::vector<DerivativeRange>
+                             derivativeRanges;
+
+   /// Call count, time and acceleration size accumulated for one force
+   struct ForceProfileData
+   {
+      PhysicalModel *force;
+      Integer calls;
+      Real microseconds;
+      Real accelSum;
+      Integer accelCount;
+   };
+
+   /// Flag used to turn on the per-force profiling
+   bool                      profileForces;
+   /// Profile data for the current propagation segment, in force list order
+   std::vector<ForceProfileData>
+                             forceProfile;
+
+   void                      ResetForceProfile();
+   wxString                  BuildForceProfileReport();
+
+   /// Flag used to turn on adaptive force fidelity
+   bool                      adaptiveFidelity;
+   /// Integration steps accepted since the last fidelity check
+   Integer                   fidelityStepCount;
+   /// Length of the last candidate step that ends on a force boundary, or 0
+   Real                      boundaryStep;
+   /// Forces left out of the superposition because they are negligible
+   std::vector<PhysicalModel *>
+                             droppedForces;
+   /// Gravity fields running below their scripted degree
+   std::vector<HarmonicField *>
+                             truncatedFields;
+   /// Scripted degree of the truncated fields
+   IntegerArray              fullDegree;
+   /// Scripted order of the truncated fields
+   IntegerArray              fullOrder;
+
+   /// Number of integration steps between fidelity checks
+   static const Integer      FIDELITY_CHECK_STEPS = 20;
+
+   bool                      CheckFidelity(Real *state, Real dt, Integer order);
+   bool                      CanDropForce(PhysicalModel *force);
+   Integer                   BuildFidelitySamples(const Real *state,
+                                   RealArray &samples);
+   bool                      GetFullSunDerivatives(PhysicalModel *force,
+                                   Real *state, Real dt, Integer order);
+   Integer                   FindTruncatedDegree(HarmonicField *field,
+                                   Integer scriptedDegree, Real *state,
+                                   Real dt, Integer order,
+                                   const Real *fullAccel,
+                                   const RealArray &threshold);
+   void                      RestoreFidelity();
+   void                      UpdateSkippedForces();
+
    bool                      BuildModelElement(Gmat::StateElementId id, 
                                                Integer start, 
                                                Integer objectCount);
@@ -351,6 +425,9 @@ protected:
       RELATIVISTIC_CORRECTION,
       ERROR_CONTROL,
       COORDINATE_SYSTEM_LIST,
+      PROFILE_FORCES,
+      FORCE_PROFILE,
+      ADAPTIVE_FIDELITY,
       
       // owned object parameters
       DEGREE,
@@ -391,6 +468,8 @@ protected:
    
    static const wxString 
       PARAMETER_TEXT[ODEModelParamCount - PhysicalModelParamCount];
+   /// Hash index of the PARAMETER_TEXT labels, used by GetParameterID()
+   static const ParameterIndex PARAMETER_INDEX;
    static const Gmat::ParameterType 
       PARAMETER_TYPE[ODEModelParamCount - PhysicalModelParamCount];
    
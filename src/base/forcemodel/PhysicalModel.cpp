@@ -118,6 +118,10 @@ PhysicalModel::PARAMETER_TEXT[PhysicalModelParamCount - GmatBaseParamCount] =
    wxT("DerivativeID"),
 };
 
+const ParameterIndex
+PhysicalModel::PARAMETER_INDEX(PARAMETER_TEXT,
+      GmatBaseParamCount, PhysicalModelParamCount);
+
 const Gmat::ParameterType
 PhysicalModel::PARAMETER_TYPE[PhysicalModelParamCount - GmatBaseParamCount] =
 {
@@ -161,6 +165,7 @@ PhysicalModel::PhysicalModel(Gmat::ObjectType id, const wxString &typeStr,
    prevElapsedTime             (0.0),
    deriv                       (NULL),
    relativeErrorThreshold      (0.10),
+   integrationAccuracy         (1.0e-11),
    solarSystem                 (NULL),
    fillCartesian               (true),
    cartesianStart              (0),
@@ -245,6 +250,7 @@ PhysicalModel::PhysicalModel(const PhysicalModel& pm) :
    derivativeIds               (pm.derivativeIds),
    derivativeNames             (pm.derivativeNames),
    relativeErrorThreshold      (pm.relativeErrorThreshold),
+   integrationAccuracy         (pm.integrationAccuracy),
    solarSystem                 (pm.solarSystem),
    fillCartesian               (pm.fillCartesian),
    cartesianStart              (pm.cartesianStart),
@@ -317,6 +323,7 @@ PhysicalModel& PhysicalModel::operator=(const PhysicalModel& pm)
    elapsedTime = pm.elapsedTime;
    prevElapsedTime = pm.prevElapsedTime;
    relativeErrorThreshold = pm.relativeErrorThreshold;
+   integrationAccuracy = pm.integrationAccuracy;
    solarSystem = pm.solarSystem;
    
    fillCartesian  = pm.fillCartesian;
@@ -402,6 +409,20 @@ CelestialBody* PhysicalModel::GetBody()
    return body;
 }
 
+//------------------------------------------------------------------------------
+// CelestialBody* GetForceOrigin()
+//------------------------------------------------------------------------------
+/**
+ * Retrieves the body at the origin of the propagation state.
+ *
+ * @return The origin, or NULL if it has not been set
+ */
+//------------------------------------------------------------------------------
+CelestialBody* PhysicalModel::GetForceOrigin()
+{
+   return forceOrigin;
+}
+
 //------------------------------------------------------------------------------
 // CelestialBody* GetBodyName()
 //------------------------------------------------------------------------------
@@ -596,6 +617,38 @@ bool PhysicalModel::SetErrorThreshold(const Real thold)
    return true;
 }
 
+//------------------------------------------------------------------------------
+// Real PhysicalModel::GetIntegrationAccuracy() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the accuracy requested by the integrator that uses this model
+ */
+//------------------------------------------------------------------------------
+Real PhysicalModel::GetIntegrationAccuracy() const
+{
+   return integrationAccuracy;
+}
+
+//------------------------------------------------------------------------------
+// bool PhysicalModel::SetIntegrationAccuracy(const Real accuracy)
+//------------------------------------------------------------------------------
+/**
+ * Sets the accuracy requested by the integrator that uses this model
+ *
+ * Models can use this value to judge which contributions are too small to
+ * affect the integration.
+ *
+ * @param accuracy      The integrator's accuracy setting
+ */
+//------------------------------------------------------------------------------
+bool PhysicalModel::SetIntegrationAccuracy(const Real accuracy)
+{
+   if (accuracy <= 0.0)
+      return false;
+   integrationAccuracy = accuracy;
+   return true;
+}
+
 //------------------------------------------------------------------------------
 // Integer PhysicalModel::GetDimension()
 //------------------------------------------------------------------------------
@@ -708,6 +761,46 @@ const Real* PhysicalModel::GetDerivativeArray()
    return deriv;
 }
 
+//------------------------------------------------------------------------------
+// Integer GetCartesianStart() const
+//------------------------------------------------------------------------------
+/**
+ * Accessor for the index of the first Cartesian state element
+ *
+ * Integrators that work in element sets other than Cartesian use this index,
+ * together with GetCartesianCount(), to locate the orbit states in the
+ * propagation vector.
+ */
+//------------------------------------------------------------------------------
+Integer PhysicalModel::GetCartesianStart() const
+{
+   return cartesianStart;
+}
+
+//------------------------------------------------------------------------------
+// Integer GetCartesianCount() const
+//------------------------------------------------------------------------------
+/**
+ * Accessor for the number of 6-element Cartesian states being propagated
+ */
+//------------------------------------------------------------------------------
+Integer PhysicalModel::GetCartesianCount() const
+{
+   return cartesianCount;
+}
+
+//------------------------------------------------------------------------------
+// Integer GetStmCount() const
+//------------------------------------------------------------------------------
+/**
+ * Accessor for the number of state transition matrices being propagated
+ */
+//------------------------------------------------------------------------------
+Integer PhysicalModel::GetStmCount() const
+{
+   return stmCount;
+}
+
 //------------------------------------------------------------------------------
 // void PhysicalModel::IncrementTime(Real dt)
 //------------------------------------------------------------------------------
@@ -1135,6 +1228,45 @@ bool PhysicalModel::SetStart(Gmat::StateElementId id, Integer index,
    return false;
 }
 
+//------------------------------------------------------------------------------
+// bool HasStepBoundaries()
+//------------------------------------------------------------------------------
+/**
+ * Identifies models that have discontinuities integrators should step onto.
+ *
+ * Models whose derivatives change abruptly at predictable places (shadow
+ * entry and exit for solar radiation pressure, for example) override this
+ * method and FindStepBoundary() so that adaptive integrators can end a step
+ * on the discontinuity rather than rejecting steps across it.
+ *
+ * @return true if FindStepBoundary() should be called, false otherwise.
+ */
+//------------------------------------------------------------------------------
+bool PhysicalModel::HasStepBoundaries()
+{
+   return false;
+}
+
+//------------------------------------------------------------------------------
+// Real FindStepBoundary(const Real *startState, const Real *endState, Real dt)
+//------------------------------------------------------------------------------
+/**
+ * Locates the first discontinuity crossed during a candidate step.
+ *
+ * @param startState The propagation state at the start of the step
+ * @param endState   The candidate propagation state at the end of the step
+ * @param dt         The step size, in seconds
+ *
+ * @return The elapsed time from the start of the step to the first boundary,
+ *         or dt if the step does not cross a boundary.
+ */
+//------------------------------------------------------------------------------
+Real PhysicalModel::FindStepBoundary(const Real *startState,
+      const Real *endState, Real dt)
+{
+   return dt;
+}
+
 //---------------------------------
 // inherited methods from GmatBase
 //---------------------------------
@@ -1163,11 +1295,9 @@ wxString PhysicalModel::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer PhysicalModel::GetParameterID(const wxString &str) const
 {
-   for (int i = GmatBaseParamCount; i < PhysicalModelParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - GmatBaseParamCount])
-         return i;
-   }
+   Integer id = PARAMETER_INDEX.Find(str);
+   if (id != -1)
+      return id;
    return GmatBase::GetParameterID(str);
 }
 
@@ -137,11 +137,15 @@ public:
    virtual bool Initialize();
 
    virtual CelestialBody* GetBody();
+   virtual CelestialBody* GetForceOrigin();
    virtual wxString    GetBodyName();
    virtual Integer        GetDimension();
    virtual Real *         GetState();
    virtual Real*          GetJ2KState();
    const Real *           GetDerivativeArray();
+   Integer                GetCartesianStart() const;
+   Integer                GetCartesianCount() const;
+   Integer                GetStmCount() const;
 
    virtual bool SetBody(const wxString& theBody);
    virtual void SetBodyName(const wxString& theBody);
@@ -153,6 +157,8 @@ public:
 
    Real GetErrorThreshold() const;
    bool SetErrorThreshold(const Real thold = 0.10);
+   Real GetIntegrationAccuracy() const;
+   bool SetIntegrationAccuracy(const Real accuracy);
 
    virtual void IncrementTime(Real dt);
    virtual Real GetTime();
@@ -164,6 +170,11 @@ public:
    virtual bool GetComponentMap(Integer * map, Integer order = 1, 
          Integer id = -1) const;
 
+   // Support for integrators that end steps on force discontinuities
+   virtual bool HasStepBoundaries();
+   virtual Real FindStepBoundary(const Real *startState, const Real *endState,
+         Real dt);
+
    // Support for extra derivative calcs -- the STM contribution, for example
    virtual const IntegerArray& GetSupportedDerivativeIds();
    virtual const StringArray&  GetSupportedDerivativeNames();
@@ -255,6 +266,8 @@ protected:
    StringArray derivativeNames;
    /// Threshold for switching between relative and absolute error control
    Real relativeErrorThreshold;
+   /// Accuracy requested by the integrator that uses the model
+   Real integrationAccuracy;
    /// Pointer to the solar system model used as a data provider for the forces
    SolarSystem *solarSystem;
    
@@ -291,6 +304,8 @@ protected:
 
    static const wxString 
       PARAMETER_TEXT[PhysicalModelParamCount - GmatBaseParamCount];
+   /// Hash index of the PARAMETER_TEXT labels, used by GetParameterID()
+   static const ParameterIndex PARAMETER_INDEX;
    static const Gmat::ParameterType 
       PARAMETER_TYPE[PhysicalModelParamCount - GmatBaseParamCount];
 };
@@ -87,6 +87,10 @@ PointMassForce::PARAMETER_TEXT[PointMassParamCount - PhysicalModelParamCount] =
    wxT("PrimaryBody"),
 };
 
+const ParameterIndex
+PointMassForce::PARAMETER_INDEX(PARAMETER_TEXT,
+      PhysicalModelParamCount, PointMassParamCount);
+
 const Gmat::ParameterType
 PointMassForce::PARAMETER_TYPE[PointMassParamCount - PhysicalModelParamCount] =
 {
@@ -112,7 +116,10 @@ PointMassForce::PointMassForce(const wxString &name) :
    mu                     (GmatSolarSystemDefaults::PLANET_MU[GmatSolarSystemDefaults::EARTH]),
    estimationMethod       (1.0),
    isPrimaryBody          (true),
-   satCount               (0)
+   satCount               (0),
+   fusedIntoGroup         (false),
+   bodyPositions          (3, 0.0),
+   bodyMu                 (1, 0.0)
 {
    parameterCount = PointMassParamCount;
    dimension = 6 * satCount;
@@ -157,7 +164,10 @@ PointMassForce::PointMassForce(const PointMassForce& pmf) :
    orig                   (pmf.orig),
    rv                     (pmf.rv),
    now                    (pmf.now),
-   satCount               (pmf.satCount)
+   satCount               (pmf.satCount),
+   fusedIntoGroup         (false),
+   bodyPositions          (3, 0.0),
+   bodyMu                 (1, 0.0)
 {
    parameterCount = PointMassParamCount;
    dimension = pmf.dimension;
@@ -194,6 +204,9 @@ PointMassForce& PointMassForce::operator= (const PointMassForce& pmf)
    now              = pmf.now;
    satCount         = pmf.satCount;
 
+   // Fused groups are rebuilt by the owning ODEModel
+   ClearFusedPointMasses();
+
    return *this;
 }
 
@@ -349,7 +362,29 @@ bool PointMassForce::GetDerivatives(Real * state, Real dt, Integer order,
       }
       else
          a_indirect[0] = a_indirect[1] = a_indirect[2] = 0.0;
-   
+
+      // Load the body table; fused third bodies share the origin state
+      Integer bodyCount = 1 + fusedBodies.size();
+      bodyPositions[0] = rv[0];
+      bodyPositions[1] = rv[1];
+      bodyPositions[2] = rv[2];
+      bodyMu[0] = mu;
+      for (Integer b = 1; b < bodyCount; ++b)
+      {
+         const Rvector6 &frv = fusedBodies[b-1]->GetState(now);
+         Real *bp = &bodyPositions[b*3];
+         bp[0] = frv[0] - orv[0];
+         bp[1] = frv[1] - orv[1];
+         bp[2] = frv[2] - orv[2];
+
+         Real rb3 = bp[0]*bp[0] + bp[1]*bp[1] + bp[2]*bp[2];
+         rb3 = sqrt(rb3 * rb3 * rb3);
+         mu_rbb = bodyMu[b] / rb3;
+         a_indirect[0] += mu_rbb * bp[0];
+         a_indirect[1] += mu_rbb * bp[1];
+         a_indirect[2] += mu_rbb * bp[2];
+      }
+
       #ifdef DEBUG_FORCE_ORIGIN
          MessageInterface::ShowMessage(
             wxT("Epoch:  %16.11lf\n  Origin:  [%s]\n  J2KBod:  [%s]\n"),
@@ -383,40 +418,47 @@ bool PointMassForce::GetDerivatives(Real * state, Real dt, Integer order,
       
       if (fillCartesian)
       {
+         Real accel[3];
          for (Integer i = 0; i < satCount; i++) 
          {
             i6 = cartesianStart + i * 6;
             
-            relativePosition[0] = rv[0] - state[ i6 ];
-            relativePosition[1] = rv[1] - state[i6+1];
-            relativePosition[2] = rv[2] - state[i6+2];
+            accel[0] = -a_indirect[0];
+            accel[1] = -a_indirect[1];
+            accel[2] = -a_indirect[2];
+
+            for (Integer b = 0; b < bodyCount; ++b)
+            {
+               const Real *bp = &bodyPositions[b*3];
+               relativePosition[0] = bp[0] - state[ i6 ];
+               relativePosition[1] = bp[1] - state[i6+1];
+               relativePosition[2] = bp[2] - state[i6+2];
       
-            r3 = relativePosition[0]*relativePosition[0] + 
-                 relativePosition[1]*relativePosition[1] + 
-                 relativePosition[2]*relativePosition[2];
+               r3 = relativePosition[0]*relativePosition[0] + 
+                    relativePosition[1]*relativePosition[1] + 
+                    relativePosition[2]*relativePosition[2];
             
-            radius = sqrt(r3);
-            r3 *= radius;
-            mu_r = mu / r3;
+               radius = sqrt(r3);
+               r3 *= radius;
+               mu_r = bodyMu[b] / r3;
+
+               accel[0] += relativePosition[0] * mu_r;
+               accel[1] += relativePosition[1] * mu_r;
+               accel[2] += relativePosition[2] * mu_r;
+            }
       
             #ifdef DEBUG_INDIRECT_TERM
-               MessageInterface::ShowMessage(wxT("   Raw acc for sp %d:  "), i);
-               MessageInterface::ShowMessage(wxT("[%16le %16le %16le]\n"),
-                     relativePosition[0] * mu_r, relativePosition[1] * mu_r,
-                     relativePosition[2] * mu_r);
-               MessageInterface::ShowMessage(wxT("   Corrected acc =     [%16le ")
-                     wxT("%16le %16le]\n"),
-                     relativePosition[0] * mu_r - a_indirect[0],
-                     relativePosition[1] * mu_r - a_indirect[1],
-                     relativePosition[2] * mu_r - a_indirect[2]);
+               MessageInterface::ShowMessage(wxT("   Corrected acc for sp %d = ")
+                     wxT("[%16le %16le %16le]\n"), i, accel[0], accel[1],
+                     accel[2]);
             #endif
 
             if (order == 1) 
             {
                // Do dv/dt first, in case deriv = state
-               deriv[3 + i6] = relativePosition[0] * mu_r - a_indirect[0];
-               deriv[4 + i6] = relativePosition[1] * mu_r - a_indirect[1];
-               deriv[5 + i6] = relativePosition[2] * mu_r - a_indirect[2];
+               deriv[3 + i6] = accel[0];
+               deriv[4 + i6] = accel[1];
+               deriv[5 + i6] = accel[2];
                // dr/dt = v, but only fill this piece for the central body
                if (rbb3 == 0.0)
                {
@@ -431,9 +473,9 @@ bool PointMassForce::GetDerivatives(Real * state, Real dt, Integer order,
             else 
             {
                // Feed accelerations to corresponding components directly for RKN
-               deriv[ i6 ] = relativePosition[0] * mu_r - a_indirect[0]; 
-               deriv[i6+1] = relativePosition[1] * mu_r - a_indirect[1]; 
-               deriv[i6+2] = relativePosition[2] * mu_r - a_indirect[2]; 
+               deriv[ i6 ] = accel[0]; 
+               deriv[i6+1] = accel[1]; 
+               deriv[i6+2] = accel[2]; 
                deriv[i6+3] = 0.0; 
                deriv[i6+4] = 0.0; 
                deriv[i6+5] = 0.0; 
@@ -469,18 +511,6 @@ bool PointMassForce::GetDerivatives(Real * state, Real dt, Integer order,
                i6 = a6;
             associate = theState->GetAssociateIndex(i6);
             
-            relativePosition[0] = rv[0] - state[ associate ];
-            relativePosition[1] = rv[1] - state[associate+1];
-            relativePosition[2] = rv[2] - state[associate+2];
-      
-            r3 = relativePosition[0]*relativePosition[0] + 
-                 relativePosition[1]*relativePosition[1] + 
-                 relativePosition[2]*relativePosition[2];
-            
-            radius = sqrt(r3);
-            r3 *= radius;
-            mu_r = mu / r3;
-            
             // Calculate A-tilde
             
             // A = D = 0
@@ -506,33 +536,41 @@ bool PointMassForce::GetDerivatives(Real * state, Real dt, Integer order,
                aTilde[11] = aTilde[15] = aTilde[16] = 0.0;
             }
                
-            // Math spec, equ 6.69, broken into separate pieces
-            aTilde[18] = - mu_r + 3.0 * mu_r / (radius*radius) * 
-                             relativePosition[0] * relativePosition[0];
-            
-            aTilde[19] = 3.0 * mu_r / (radius*radius) * 
-                             relativePosition[0] * relativePosition[1];
-            
-            aTilde[20] = 3.0 * mu_r / (radius*radius) * 
-                             relativePosition[0] * relativePosition[2];
-            
-            aTilde[24] = 3.0 * mu_r / (radius*radius) * 
-                             relativePosition[1] * relativePosition[0];
-            
-            aTilde[25] = - mu_r + 3.0 * mu_r / (radius*radius) * 
-                             relativePosition[1] * relativePosition[1];
-            
-            aTilde[26] = 3.0 * mu_r / (radius*radius) * 
-                             relativePosition[1] * relativePosition[2];
-            
-            aTilde[30] = 3.0 * mu_r / (radius*radius) * 
-                             relativePosition[2] * relativePosition[0];
-            
-            aTilde[31] = 3.0 * mu_r / (radius*radius) * 
-                             relativePosition[2] * relativePosition[1];
+            aTilde[18] = aTilde[19] = aTilde[20] =
+            aTilde[24] = aTilde[25] = aTilde[26] =
+            aTilde[30] = aTilde[31] = aTilde[32] = 0.0;
+
+            // Math spec, equ 6.69, broken into separate pieces and summed
+            // over the evaluated bodies
+            for (Integer b = 0; b < bodyCount; ++b)
+            {
+               const Real *bp = &bodyPositions[b*3];
+               relativePosition[0] = bp[0] - state[ associate ];
+               relativePosition[1] = bp[1] - state[associate+1];
+               relativePosition[2] = bp[2] - state[associate+2];
+      
+               r3 = relativePosition[0]*relativePosition[0] + 
+                    relativePosition[1]*relativePosition[1] + 
+                    relativePosition[2]*relativePosition[2];
             
-            aTilde[32] = - mu_r + 3.0 * mu_r / (radius*radius) * 
-                             relativePosition[2] * relativePosition[2];
+               radius = sqrt(r3);
+               r3 *= radius;
+               mu_r = bodyMu[b] / r3;
+               Real mu_r5 = 3.0 * mu_r / (radius*radius);
+
+               aTilde[18] += - mu_r + mu_r5 * 
+                                relativePosition[0] * relativePosition[0];
+               aTilde[19] += mu_r5 * relativePosition[0] * relativePosition[1];
+               aTilde[20] += mu_r5 * relativePosition[0] * relativePosition[2];
+               aTilde[24] += mu_r5 * relativePosition[1] * relativePosition[0];
+               aTilde[25] += - mu_r + mu_r5 * 
+                                relativePosition[1] * relativePosition[1];
+               aTilde[26] += mu_r5 * relativePosition[1] * relativePosition[2];
+               aTilde[30] += mu_r5 * relativePosition[2] * relativePosition[0];
+               aTilde[31] += mu_r5 * relativePosition[2] * relativePosition[1];
+               aTilde[32] += - mu_r + mu_r5 * 
+                                relativePosition[2] * relativePosition[2];
+            }
 
 // Moved to ODEModel so upper half of STM and A-Matrix are correctly managed
 //            // Now Phi_dot = A_tilde Phi
@@ -710,11 +748,9 @@ wxString PointMassForce::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer PointMassForce::GetParameterID(const wxString &str) const
 {
-   for (Integer i = PhysicalModelParamCount; i < PointMassParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - PhysicalModelParamCount])
-         return i;
-   }
+   Integer id = PARAMETER_INDEX.Find(str);
+   if (id != -1)
+      return id;
    return PhysicalModel::GetParameterID(str);
 }
 
@@ -1000,6 +1036,67 @@ bool PointMassForce::SetStart(Gmat::StateElementId id, Integer index,
 }
 
 
+//------------------------------------------------------------------------------
+// void FusePointMass(PointMassForce *member)
+//------------------------------------------------------------------------------
+/**
+ * Adds another third body to the bodies evaluated by this force.
+ *
+ * Third bodies evaluated together share the force origin state and a single
+ * pass over the spacecraft, and the ODEModel sums one derivative array in
+ * place of one per body.  The member force is flagged so that the ODEModel
+ * skips it during superposition.  Both forces must be initialized, so that
+ * their bodies and gravitational constants are set.
+ *
+ * @param member The force whose body is evaluated here
+ */
+//------------------------------------------------------------------------------
+void PointMassForce::FusePointMass(PointMassForce *member)
+{
+   if ((member == NULL) || (member == this))
+      return;
+
+   #ifdef DEBUG_FUSED_POINT_MASSES
+      MessageInterface::ShowMessage(wxT("Evaluating %s with the %s point ")
+            wxT("mass\n"), member->bodyName.c_str(), bodyName.c_str());
+   #endif
+
+   fusedBodies.push_back(member->body);
+   bodyMu.push_back(member->mu);
+   bodyPositions.resize(3 * bodyMu.size(), 0.0);
+   member->fusedIntoGroup = true;
+}
+
+//------------------------------------------------------------------------------
+// void ClearFusedPointMasses()
+//------------------------------------------------------------------------------
+/**
+ * Returns the force to evaluating only its own body.
+ */
+//------------------------------------------------------------------------------
+void PointMassForce::ClearFusedPointMasses()
+{
+   fusedBodies.clear();
+   fusedIntoGroup = false;
+   bodyPositions.assign(3, 0.0);
+   bodyMu.assign(1, 0.0);
+}
+
+//------------------------------------------------------------------------------
+// bool IsFusedIntoGroup() const
+//------------------------------------------------------------------------------
+/**
+ * Checks if another point mass force evaluates this force's body.
+ *
+ * @return true if the force is evaluated by another force
+ */
+//------------------------------------------------------------------------------
+bool PointMassForce::IsFusedIntoGroup() const
+{
+   return fusedIntoGroup;
+}
+
+
 //---------------------------------
 // protected methods
 //---------------------------------
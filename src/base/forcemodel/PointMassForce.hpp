@@ -115,6 +115,11 @@ public:
    virtual bool SetStart(Gmat::StateElementId id, Integer index, 
                          Integer quantity);
 
+   // Methods used by the ODEModel to evaluate third bodies together
+   void FusePointMass(PointMassForce *member);
+   void ClearFusedPointMasses();
+   bool IsFusedIntoGroup() const;
+
 protected:
    // Parameter IDs
    enum
@@ -134,6 +139,8 @@ protected:
    };
 
    static const wxString PARAMETER_TEXT[PointMassParamCount - PhysicalModelParamCount];
+   /// Hash index of the PARAMETER_TEXT labels, used by GetParameterID()
+   static const ParameterIndex PARAMETER_INDEX;
    static const Gmat::ParameterType PARAMETER_TYPE[PointMassParamCount - PhysicalModelParamCount];
 
    /// Gravitational constant for the central body (\f$G*M\f$)
@@ -150,6 +157,15 @@ protected:
    A1Mjd now;
    Integer satCount;
 //   Integer cartIndex;
+
+   /// Third bodies evaluated by this force in addition to its own body
+   std::vector<CelestialBody*> fusedBodies;
+   /// Flag indicating that another force evaluates this body
+   bool fusedIntoGroup;
+   /// Origin-relative positions of the evaluated bodies, 3 per body
+   RealArray bodyPositions;
+   /// Gravitational constants of the evaluated bodies
+   RealArray bodyMu;
    
    // for Debug
    void ShowBodyState(const wxString &header, Real time, Rvector6 &rv);
@@ -44,6 +44,10 @@ const wxString RelativisticCorrection::PARAMETER_TEXT[RelativisticCorrectionPara
       wxT("Radius"),
       wxT("Mu"),
 };
+
+const ParameterIndex
+RelativisticCorrection::PARAMETER_INDEX(PARAMETER_TEXT,
+      PhysicalModelParamCount, RelativisticCorrectionParamCount);
 const Gmat::ParameterType RelativisticCorrection::PARAMETER_TYPE[RelativisticCorrectionParamCount - PhysicalModelParamCount] =
 {
       Gmat::REAL_TYPE,
@@ -533,11 +537,9 @@ wxString RelativisticCorrection::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer RelativisticCorrection::GetParameterID(const wxString &str) const
 {
-   for (Integer i = PhysicalModelParamCount; i < RelativisticCorrectionParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - PhysicalModelParamCount])
-         return i;
-   }
+   Integer id = PARAMETER_INDEX.Find(str);
+   if (id != -1)
+      return id;
    return PhysicalModel::GetParameterID(str);
 }
 
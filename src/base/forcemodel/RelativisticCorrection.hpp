@@ -120,6 +120,8 @@ private:
    };
 
    static const wxString PARAMETER_TEXT[RelativisticCorrectionParamCount - PhysicalModelParamCount];
+   /// Hash index of the PARAMETER_TEXT labels, used by GetParameterID()
+   static const ParameterIndex PARAMETER_INDEX;
    static const Gmat::ParameterType PARAMETER_TYPE[RelativisticCorrectionParamCount - PhysicalModelParamCount];
 
 };
@@ -83,6 +83,10 @@ SolarRadiationPressure::PARAMETER_TEXT[SRPParamCount - PhysicalModelParamCount]
     wxT("PercentSun"),
 };
 
+const ParameterIndex
+SolarRadiationPressure::PARAMETER_INDEX(PARAMETER_TEXT,
+      USE_ANALYTIC, SRPParamCount);
+
 const Gmat::ParameterType
 SolarRadiationPressure::PARAMETER_TYPE[SRPParamCount - PhysicalModelParamCount] =
 {
@@ -131,6 +135,7 @@ SolarRadiationPressure::SolarRadiationPressure(const wxString &name) :
    sunDistance         (149597870.691),
    nominalSun          (149597870.691),
    bodyIsTheSun        (false),
+   fullSun             (false),
    psunrad             (0.0),
    pcbrad              (0.0),
    percentSun          (1.0),
@@ -170,6 +175,7 @@ SolarRadiationPressure::SolarRadiationPressure(const SolarRadiationPressure &srp
    sunDistance         (srp.sunDistance),
    nominalSun          (srp.nominalSun),
    bodyIsTheSun        (srp.bodyIsTheSun),
+   fullSun             (false),
    psunrad             (srp.psunrad),
    pcbrad              (srp.pcbrad),
    percentSun          (srp.percentSun),
@@ -211,6 +217,7 @@ SolarRadiationPressure& SolarRadiationPressure::operator=(const SolarRadiationPr
       sunDistance  = srp.sunDistance;
       nominalSun   = srp.nominalSun;
       bodyIsTheSun = srp.bodyIsTheSun;
+      fullSun      = false;
       psunrad      = srp.psunrad;
       pcbrad       = srp.pcbrad;
       percentSun   = srp.percentSun;
@@ -279,11 +286,9 @@ wxString SolarRadiationPressure::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer SolarRadiationPressure::GetParameterID(const wxString &str) const
 {
-   for (int i = USE_ANALYTIC; i < SRPParamCount; i++)
-   {
-      if (str == SolarRadiationPressure::PARAMETER_TEXT[i - PhysicalModelParamCount])
-         return i;
-   }
+   Integer id = PARAMETER_INDEX.Find(str);
+   if (id != -1)
+      return id;
    return PhysicalModel::GetParameterID(str);
 }
 
@@ -755,7 +760,7 @@ bool SolarRadiationPressure::GetDerivatives(Real *state, Real dt, Integer order,
          #endif
         
          // Test shadow condition for current spacecraft (only if body isn't Sol)
-         if (!bodyIsTheSun)
+         if (!bodyIsTheSun && !fullSun)
          {
             psunrad = asin(sunRadius / sunDistance);
             FindShadowState(inSunlight, inShadow, &state[i6]);
@@ -1197,6 +1202,207 @@ Real SolarRadiationPressure::ShadowFunction(Real * state)
 }
 
 
+//------------------------------------------------------------------------------
+// void ShadowBoundaries(const Real *position, const Real *sunVector,
+//                       Real *boundary)
+//------------------------------------------------------------------------------
+/**
+ * Evaluates continuous functions that change sign at the shadow boundaries.
+ *
+ * boundary[0] is the distance outside of the penumbral cone and boundary[1]
+ * the distance outside of the umbral cone (the cylinder, for the cylindrical
+ * model), using the geometry in FindShadowState().  Both are positive on the
+ * sunlit side of the central body.
+ *
+ * @param <position>  Spacecraft position relative to the central body
+ * @param <sunVector> Vector from the central body to the Sun
+ * @param <boundary>  2-element array receiving the boundary functions
+ */
+//------------------------------------------------------------------------------
+void SolarRadiationPressure::ShadowBoundaries(const Real *position,
+      const Real *sunVector, Real *boundary)
+{
+   Real mag = sqrt(sunVector[0]*sunVector[0] + sunVector[1]*sunVector[1] +
+                   sunVector[2]*sunVector[2]);
+
+   Real unitsun[3];
+   unitsun[0] = sunVector[0] / mag;
+   unitsun[1] = sunVector[1] / mag;
+   unitsun[2] = sunVector[2] / mag;
+
+   Real s0 = -position[0]*unitsun[0] - position[1]*unitsun[1] -
+              position[2]*unitsun[2];
+   Real s2 = position[0]*position[0] + position[1]*position[1] +
+             position[2]*position[2];
+
+   if (s0 < 0.0)
+   {
+      // Sunny side of central body is always fully lit
+      boundary[0] = boundary[1] = sqrt(s2);
+      return;
+   }
+
+   Real lsc = sqrt(s2 - s0*s0);
+
+   if (shadowModel == CYLINDRICAL_MODEL)
+   {
+      boundary[0] = boundary[1] = lsc - bodyRadius;
+      return;
+   }
+
+   Real sinf1 = (sunRadius + bodyRadius) / mag;
+   Real sinf2 = (sunRadius - bodyRadius) / mag;
+   Real tanf1 = sqrt(sinf1*sinf1 / (1.0 - sinf1*sinf1));
+   Real tanf2 = sqrt(sinf2*sinf2 / (1.0 - sinf2*sinf2));
+
+   boundary[0] = lsc - (s0 + bodyRadius / sinf1) * tanf1;
+   boundary[1] = lsc - fabs((bodyRadius / sinf2 - s0) * tanf2);
+}
+
+
+//------------------------------------------------------------------------------
+// void SetFullSun(bool ignoreShadows)
+//------------------------------------------------------------------------------
+/**
+ * Turns shadowing off, so the force is evaluated as if in full sun.
+ *
+ * The ODEModel's adaptive fidelity check uses this to find the largest
+ * acceleration SRP can apply, whatever the spacecraft's current lighting.
+ *
+ * @param ignoreShadows true to ignore shadows, false to restore them
+ */
+//------------------------------------------------------------------------------
+void SolarRadiationPressure::SetFullSun(bool ignoreShadows)
+{
+   fullSun = ignoreShadows;
+}
+
+
+//------------------------------------------------------------------------------
+// bool HasStepBoundaries()
+//------------------------------------------------------------------------------
+/**
+ * Reports that shadow entry and exit are discontinuities in the SRP force.
+ *
+ * @return true when a shadow model is active for a body other than the Sun
+ */
+//------------------------------------------------------------------------------
+bool SolarRadiationPressure::HasStepBoundaries()
+{
+   #ifdef IGNORE_SHADOWS
+      return false;
+   #endif
+
+   return (initialized && fillCartesian && !bodyIsTheSun &&
+           ((shadowModel == CYLINDRICAL_MODEL) ||
+            (shadowModel == CONICAL_MODEL)));
+}
+
+
+//------------------------------------------------------------------------------
+// Real FindStepBoundary(const Real *startState, const Real *endState, Real dt)
+//------------------------------------------------------------------------------
+/**
+ * Predicts the first penumbra or umbra crossing inside a candidate step.
+ *
+ * The spacecraft positions are interpolated across the step with cubic
+ * Hermite polynomials built from the start and end states, and the Sun
+ * vector is interpolated linearly.  Sign changes in the boundary functions
+ * are then refined with the Illinois variant of regula falsi.
+ *
+ * @param <startState> The propagation state at the start of the step
+ * @param <endState>   The candidate propagation state at the end of the step
+ * @param <dt>         The step size, in seconds
+ *
+ * @return The elapsed time to the first boundary, or dt if there is none
+ */
+//------------------------------------------------------------------------------
+Real SolarRadiationPressure::FindStepBoundary(const Real *startState,
+      const Real *endState, Real dt)
+{
+   if (!theSun || !body || (dt == 0.0))
+      return dt;
+
+   Real sunStart[3], sunEnd[3];
+   Rvector6 sunState = theSun->GetState(epoch);
+   Rvector6 bodyState = body->GetState(epoch);
+   for (Integer j = 0; j < 3; ++j)
+      sunStart[j] = sunState[j] - bodyState[j];
+   sunState = theSun->GetState(epoch + dt / GmatTimeConstants::SECS_PER_DAY);
+   bodyState = body->GetState(epoch + dt / GmatTimeConstants::SECS_PER_DAY);
+   for (Integer j = 0; j < 3; ++j)
+      sunEnd[j] = sunState[j] - bodyState[j];
+
+   Real boundary = dt, gStart[2], gEnd[2];
+   Integer i6;
+
+   for (Integer i = 0; i < satCount; ++i)
+   {
+      i6 = cartesianStart + i*6;
+      ShadowBoundaries(&startState[i6], sunStart, gStart);
+      ShadowBoundaries(&endState[i6], sunEnd, gEnd);
+
+      for (Integer k = 0; k < 2; ++k)
+      {
+         if (gStart[k] * gEnd[k] >= 0.0)
+            continue;
+
+         // Bracketed root: Illinois regula falsi in s = t / dt
+         Real sa = 0.0, sb = 1.0, ga = gStart[k], gb = gEnd[k], s = 0.0;
+         Real g[2], pos[3], sunVec[3], h00, h10, h01, h11;
+         Integer side = 0;
+         for (Integer iter = 0; iter < 50; ++iter)
+         {
+            s = (sa * gb - sb * ga) / (gb - ga);
+
+            h00 = (2.0*s - 3.0)*s*s + 1.0;
+            h10 = ((s - 2.0)*s + 1.0)*s;
+            h01 = (3.0 - 2.0*s)*s*s;
+            h11 = (s - 1.0)*s*s;
+            for (Integer j = 0; j < 3; ++j)
+            {
+               pos[j] = h00 * startState[i6+j] + h10 * dt * startState[i6+3+j] +
+                        h01 * endState[i6+j] + h11 * dt * endState[i6+3+j];
+               sunVec[j] = sunStart[j] + s * (sunEnd[j] - sunStart[j]);
+            }
+            ShadowBoundaries(pos, sunVec, g);
+
+            if (fabs((sb - sa) * dt) < 1.0e-6 || g[k] == 0.0)
+               break;
+
+            if (g[k] * ga > 0.0)
+            {
+               sa = s;
+               ga = g[k];
+               if (side == -1)
+                  gb *= 0.5;
+               side = -1;
+            }
+            else
+            {
+               sb = s;
+               gb = g[k];
+               if (side == 1)
+                  ga *= 0.5;
+               side = 1;
+            }
+         }
+
+         if (fabs(s * dt) < fabs(boundary))
+            boundary = s * dt;
+      }
+   }
+
+   #ifdef DEBUG_SRP_BOUNDARIES
+      if (boundary != dt)
+         MessageInterface::ShowMessage(wxT("SRP shadow boundary found %.9lf s ")
+               wxT("into a %.9lf s step\n"), boundary, dt);
+   #endif
+
+   return boundary;
+}
+
+
 //------------------------------------------------------------------------------
 // void SetSatelliteParameter(const Integer i, const wxString parmName, 
 //                            const Real parm)
@@ -111,6 +111,13 @@ public:
    virtual bool SetStart(Gmat::StateElementId id, Integer index, 
                          Integer quantity);
 
+   // Shadow entry and exit boundaries for the integrators
+   virtual bool HasStepBoundaries();
+   virtual Real FindStepBoundary(const Real *startState, const Real *endState,
+         Real dt);
+
+   void SetFullSun(bool ignoreShadows);
+
 protected:
    // Parameter IDs
    enum
@@ -170,6 +177,8 @@ protected:
    Real nominalSun;
    /// Flag used to detect if the central body is Sol
    bool bodyIsTheSun;
+   /// Flag used to evaluate the force as if the spacecraft were in full sun
+   bool fullSun;
 
    // Conical shadow model parameters that are used in multiple methods
    /// Conical model: projected sun radius
@@ -205,6 +214,8 @@ protected:
 
    void FindShadowState(bool &lit, bool &dark, Real *state);
    Real ShadowFunction(Real *state);
+   void ShadowBoundaries(const Real *position, const Real *sunVector,
+         Real *boundary);
 
 private:
 
@@ -231,6 +242,8 @@ private:
    };
    
    static const wxString PARAMETER_TEXT[SRPParamCount - PhysicalModelParamCount];
+   /// Hash index of the PARAMETER_TEXT labels, used by GetParameterID()
+   static const ParameterIndex PARAMETER_INDEX;
    static const Gmat::ParameterType PARAMETER_TYPE[SRPParamCount - PhysicalModelParamCount];
 
 };
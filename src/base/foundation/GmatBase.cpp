@@ -78,6 +78,9 @@ const wxString GmatBase::PARAMETER_LABEL[GmatBaseParamCount] =
             wxT("Covariance"),
       };
 
+const ParameterIndex
+GmatBase::PARAMETER_INDEX(PARAMETER_LABEL, 0, GmatBaseParamCount);
+
 
 
 
@@ -1209,11 +1212,9 @@ wxString GmatBase::GetParameterUnit(const Integer id) const
 //---------------------------------------------------------------------------
 Integer GmatBase::GetParameterID(const wxString &str) const
 {
-   for (Integer i = 0; i < GmatBaseParamCount; ++i)
-      if (str == PARAMETER_LABEL[i])
-      {
-         return i;
-      }
+   Integer id = PARAMETER_INDEX.Find(str);
+   if (id != -1)
+      return id;
    
    throw GmatBaseException
       (wxT("GmatBase::GetParameterID() The object named \"") + GetName() +
@@ -34,6 +34,7 @@
 #include "Rvector.hpp"
 #include "Rmatrix.hpp"
 #include "Covariance.hpp"
+#include "ParameterIndex.hpp"
 
 #include <algorithm>                    // Required by GCC 4.3 for find
 
@@ -458,6 +459,8 @@ protected:
    static const Gmat::ParameterType PARAMETER_TYPE[GmatBaseParamCount];
    /// Spacecraft parameter labels
    static const wxString PARAMETER_LABEL[GmatBaseParamCount];
+   /// Hash index of the PARAMETER_LABEL labels, used by GetParameterID()
+   static const ParameterIndex PARAMETER_INDEX;
 
 
    /// count of the number of GmatBase objects currently instantiated
@@ -0,0 +1,133 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                              ParameterIndex
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool.
+//
+// Copyright (c) 2002-2011 United States Government as represented by the
+// Administrator of The National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Created: 2026/10/18
+//
+/**
+ * Implementation of the hashed parameter label index used by GetParameterID().
+ */
+//------------------------------------------------------------------------------
+
+
+#include "ParameterIndex.hpp"
+
+
+//------------------------------------------------------------------------------
+// ParameterIndex(const wxString *labels, Integer firstId, Integer endId)
+//------------------------------------------------------------------------------
+/**
+ * Builds the index.
+ *
+ * When a label appears more than once, the lowest ID is kept, matching the
+ * linear searches this index replaces.
+ *
+ * @param <labels>  The parameter labels, starting with the label for firstId
+ * @param <firstId> ID of the first label
+ * @param <endId>   One past the ID of the last label
+ */
+//------------------------------------------------------------------------------
+ParameterIndex::ParameterIndex(const wxString *labels, Integer firstId,
+                               Integer endId) :
+   labels      (labels),
+   firstId     (firstId),
+   mask        (0)
+{
+   Integer count = endId - firstId;
+   if (count <= 0)
+      return;
+   
+   // Keep the table at most half full
+   UnsignedInt size = 4;
+   while (size < (UnsignedInt)(2 * count))
+      size <<= 1;
+   mask = size - 1;
+   slots.assign(size, -1);
+   
+   for (Integer i = 0; i < count; ++i)
+   {
+      UnsignedInt slot = Hash(labels[i]) & mask;
+      bool duplicate = false;
+      while (slots[slot] != -1)
+      {
+         if (labels[slots[slot]] == labels[i])
+         {
+            duplicate = true;
+            break;
+         }
+         slot = (slot + 1) & mask;
+      }
+      if (!duplicate)
+         slots[slot] = i;
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// ~ParameterIndex()
+//------------------------------------------------------------------------------
+/**
+ * Destructor.
+ */
+//------------------------------------------------------------------------------
+ParameterIndex::~ParameterIndex()
+{
+}
+
+
+//------------------------------------------------------------------------------
+// Integer Find(const wxString &label) const
+//------------------------------------------------------------------------------
+/**
+ * Looks up a parameter label.
+ *
+ * @param <label> The label
+ *
+ * @return The parameter ID, or -1 if the label is not in the index
+ */
+//------------------------------------------------------------------------------
+Integer ParameterIndex::Find(const wxString &label) const
+{
+   if (slots.empty())
+      return -1;
+   
+   UnsignedInt slot = Hash(label) & mask;
+   while (slots[slot] != -1)
+   {
+      if (labels[slots[slot]] == label)
+         return firstId + slots[slot];
+      slot = (slot + 1) & mask;
+   }
+   
+   return -1;
+}
+
+
+//------------------------------------------------------------------------------
+// UnsignedInt Hash(const wxString &label)
+//------------------------------------------------------------------------------
+/**
+ * Computes the FNV-1a hash of a label.
+ *
+ * @param <label> The label
+ *
+ * @return The hash value
+ */
+//------------------------------------------------------------------------------
+UnsignedInt ParameterIndex::Hash(const wxString &label)
+{
+   UnsignedInt hash = 2166136261u;
+   const wxChar *chars = label.c_str();
+   for (size_t i = 0; i < label.length(); ++i)
+   {
+      hash ^= (UnsignedInt)chars[i];
+      hash *= 16777619u;
+   }
+   return hash;
+}
@@ -0,0 +1,62 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                              ParameterIndex
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool.
+//
+// Copyright (c) 2002-2011 United States Government as represented by the
+// Administrator of The National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Created: 2026/10/18
+//
+/**
+ * Declaration of the hashed parameter label index used by GetParameterID().
+ */
+//------------------------------------------------------------------------------
+
+
+#ifndef ParameterIndex_hpp
+#define ParameterIndex_hpp
+
+#include "gmatdefs.hpp"
+
+/**
+ * Hash index of the parameter labels defined at one level of a class
+ * hierarchy.
+ *
+ * Each class that overrides GetParameterID() declares a static
+ * PARAMETER_INDEX over its PARAMETER_TEXT array and defines it right after the
+ * array, so the index is built during static initialization, before any
+ * threads are started, and is only read afterwards.  Like the label arrays it
+ * points into, it must not be used from other static initializers.  Lookups
+ * hash the label and compare it against at most a few labels instead of the
+ * whole array.  Labels not found at this level are passed on to the parent
+ * class as before, so aliases and special cases in the overrides keep working.
+ */
+class GMAT_API ParameterIndex
+{
+public:
+   ParameterIndex(const wxString *labels, Integer firstId, Integer endId);
+   ~ParameterIndex();
+   
+   Integer Find(const wxString &label) const;
+   
+private:
+   /// The parameter labels; labels[0] is the label for firstId
+   const wxString *labels;
+   /// ID of the first label
+   Integer         firstId;
+   /// Open addressed hash table of label offsets; -1 marks an empty slot
+   IntegerArray    slots;
+   /// Table size - 1; the table size is a power of 2
+   UnsignedInt     mask;
+   
+   static UnsignedInt Hash(const wxString &label);
+   
+   // Not implemented: the index points into static label arrays
+   ParameterIndex(const ParameterIndex&);
+   ParameterIndex& operator=(const ParameterIndex&);
+};
+
+#endif // ParameterIndex_hpp
@@ -68,6 +68,10 @@ SpacePoint::PARAMETER_TEXT[SpacePointParamCount - GmatBaseParamCount] =
    wxT("FrameSpiceKernelName"),
 };
 
+const ParameterIndex
+SpacePoint::PARAMETER_INDEX(PARAMETER_TEXT,
+      GmatBaseParamCount, SpacePointParamCount);
+
 const Gmat::ParameterType
 SpacePoint::PARAMETER_TYPE[SpacePointParamCount - GmatBaseParamCount] =
 {
@@ -120,7 +124,11 @@ j2000BodyName  (wxT("Earth")),
 naifId         (UNDEFINED_NAIF_ID),
 naifIdRefFrame (UNDEFINED_NAIF_ID),
 spiceSetupDone (false),
-hasAttitude    (false)
+hasAttitude    (false),
+stateCacheValid         (false),
+cachedStateEpoch        (-1.0),
+stateCacheVersion       (0),
+cachedDependencyVersion (0)
 {
    objectTypes.push_back(Gmat::SPACE_POINT);
    objectTypeNames.push_back(wxT("SpacePoint"));
@@ -153,7 +161,11 @@ orbitSpiceKernelNames    (sp.orbitSpiceKernelNames),
 attitudeSpiceKernelNames (sp.attitudeSpiceKernelNames),
 scClockSpiceKernelNames  (sp.scClockSpiceKernelNames),
 frameSpiceKernelNames    (sp.frameSpiceKernelNames),
-hasAttitude              (false)
+hasAttitude              (false),
+stateCacheValid          (false),
+cachedStateEpoch         (-1.0),
+stateCacheVersion        (0),
+cachedDependencyVersion  (0)
 {
 }
 
@@ -188,6 +200,8 @@ const SpacePoint& SpacePoint::operator=(const SpacePoint &sp)
    default_naifId           = sp.default_naifId;
    hasAttitude              = false;
    
+   InvalidateStateCache();
+   
    return *this;
 }
 //---------------------------------------------------------------------------
@@ -268,6 +282,7 @@ SpacePoint* SpacePoint::GetJ2000Body() const
 bool SpacePoint::SetJ2000BodyName(const wxString &toName)
 {
    j2000BodyName = toName;
+   InvalidateStateCache();
    return true;
 }
 
@@ -283,6 +298,7 @@ void SpacePoint::SetJ2000Body(SpacePoint* toBody)
    #endif
    
    j2000Body = toBody;
+   InvalidateStateCache();
 
    #ifdef DEBUG_J2000_STATE
       if (j2000Body)
@@ -454,6 +470,97 @@ const Rvector3 SpacePoint::GetMJ2000Acceleration(const A1Mjd &atTime)
    return Rvector3(0.0,0.0,0.0);
 }
 
+//------------------------------------------------------------------------------
+// void InvalidateStateCache()
+//------------------------------------------------------------------------------
+/**
+ * Discards the memoized MJ2000 state.
+ *
+ * Derived classes call this when something that feeds the state computation
+ * changes at a fixed epoch (bodies, ephemeris source, configuration).  The
+ * version bump also invalidates every point whose cached state was built
+ * from this one.
+ */
+//------------------------------------------------------------------------------
+void SpacePoint::InvalidateStateCache()
+{
+   stateCacheValid = false;
+   ++stateCacheVersion;
+}
+
+//------------------------------------------------------------------------------
+// UnsignedInt GetStateCacheVersion()
+//------------------------------------------------------------------------------
+/**
+ * Returns a counter that changes whenever the state of this point, or of
+ * any point it is computed from, may have changed at a fixed epoch.
+ *
+ * Every counter only increases, so the sum over the dependency graph changes
+ * whenever any node in it is invalidated.
+ */
+//------------------------------------------------------------------------------
+UnsignedInt SpacePoint::GetStateCacheVersion()
+{
+   return stateCacheVersion + GetDependencyStateVersion();
+}
+
+//------------------------------------------------------------------------------
+// bool GetCachedMJ2000State(const A1Mjd &atTime, Rvector6 &state)
+//------------------------------------------------------------------------------
+/**
+ * Retrieves the memoized MJ2000 state.
+ *
+ * @param <atTime> Time for which the state is requested.
+ * @param <state>  The memoized state, if there is one for atTime.
+ *
+ * @return true if the memoized state is current for atTime.
+ */
+//------------------------------------------------------------------------------
+bool SpacePoint::GetCachedMJ2000State(const A1Mjd &atTime, Rvector6 &state)
+{
+   if (!stateCacheValid || (atTime.Get() != cachedStateEpoch))
+      return false;
+   
+   if (GetDependencyStateVersion() != cachedDependencyVersion)
+   {
+      stateCacheValid = false;
+      return false;
+   }
+   
+   state = cachedState;
+   return true;
+}
+
+//------------------------------------------------------------------------------
+// void SetCachedMJ2000State(const A1Mjd &atTime, const Rvector6 &state)
+//------------------------------------------------------------------------------
+/**
+ * Memoizes the MJ2000 state computed for atTime, along with the versions of
+ * the points it was computed from.
+ */
+//------------------------------------------------------------------------------
+void SpacePoint::SetCachedMJ2000State(const A1Mjd &atTime,
+                                      const Rvector6 &state)
+{
+   cachedState             = state;
+   cachedStateEpoch        = atTime.Get();
+   cachedDependencyVersion = GetDependencyStateVersion();
+   stateCacheValid         = true;
+}
+
+//------------------------------------------------------------------------------
+// UnsignedInt GetDependencyStateVersion()
+//------------------------------------------------------------------------------
+/**
+ * Returns the sum of the state cache versions of the points this point's
+ * state is computed from.  A SpacePoint has no such dependencies by default.
+ */
+//------------------------------------------------------------------------------
+UnsignedInt SpacePoint::GetDependencyStateVersion()
+{
+   return 0;
+}
+
 void SpacePoint::RemoveSpiceKernelName(const wxString &kernelType,
                                        const wxString &fileName)
 {
@@ -521,11 +628,9 @@ wxString SpacePoint::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer SpacePoint::GetParameterID(const wxString &str) const
 {
-   for (Integer i = GmatBaseParamCount; i < SpacePointParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - GmatBaseParamCount])
-         return i;
-   }
+   Integer id = PARAMETER_INDEX.Find(str);
+   if (id != -1)
+      return id;
    
    return GmatBase::GetParameterID(str);
 }
@@ -123,6 +123,10 @@ public:
    
    virtual const Rvector3 GetMJ2000Acceleration(const A1Mjd &atTime);
 
+   // Epoch-tagged memoization of the MJ2000 state
+   virtual void           InvalidateStateCache();
+   UnsignedInt            GetStateCacheVersion();
+
    virtual void           RemoveSpiceKernelName(const wxString &kernelType,
                                                 const wxString &fileName);
 
@@ -193,6 +197,8 @@ protected:
    };
    
    static const wxString PARAMETER_TEXT[SpacePointParamCount - GmatBaseParamCount];
+   /// Hash index of the PARAMETER_TEXT labels, used by GetParameterID()
+   static const ParameterIndex PARAMETER_INDEX;
    
    static const Gmat::ParameterType PARAMETER_TYPE[SpacePointParamCount - GmatBaseParamCount];
    
@@ -238,5 +244,22 @@ protected:
    /// Current rotation matrix (from inertial to body)
    bool      hasAttitude;
    Rmatrix33 cosineMat;
+   
+   /// Flag indicating that cachedState holds the state at cachedStateEpoch
+   bool        stateCacheValid;
+   /// Epoch (A1Mjd) of the memoized MJ2000 state
+   Real        cachedStateEpoch;
+   /// Memoized MJ2000 state
+   Rvector6    cachedState;
+   /// Counter incremented whenever the state computation changes
+   UnsignedInt stateCacheVersion;
+   /// Version sum of the points this state was built from, when it was cached
+   UnsignedInt cachedDependencyVersion;
+   
+   bool                GetCachedMJ2000State(const A1Mjd &atTime,
+                                            Rvector6 &state);
+   void                SetCachedMJ2000State(const A1Mjd &atTime,
+                                            const Rvector6 &state);
+   virtual UnsignedInt GetDependencyStateVersion();
 };
 #endif // SpacePoint_hpp
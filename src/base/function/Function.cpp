@@ -54,6 +54,9 @@ Function::PARAMETER_TEXT[FunctionParamCount - GmatBaseParamCount] =
    wxT("Output")
 };
 
+const ParameterIndex
+Function::PARAMETER_INDEX(PARAMETER_TEXT, FUNCTION_PATH, FunctionParamCount);
+
 const Gmat::ParameterType
 Function::PARAMETER_TYPE[FunctionParamCount - GmatBaseParamCount] =
 {
@@ -701,11 +704,9 @@ wxString Function::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer Function::GetParameterID(const wxString &str) const
 {
-   for (Integer i = FUNCTION_PATH; i < FunctionParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - GmatBaseParamCount])
-         return i;
-   }
+   Integer id = PARAMETER_INDEX.Find(str);
+   if (id != -1)
+      return id;
    
    return GmatBase::GetParameterID(str);
 }
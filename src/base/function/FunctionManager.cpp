@@ -130,6 +130,7 @@ FunctionManager::~FunctionManager()
    
    DeleteObjectMap(functionObjectStore, wxT("FOS in Destructor"));
    functionObjectStore = NULL;
+   ClearObjectStorePool();
    ClearInOutWrappers();
 }
 
@@ -670,6 +671,22 @@ bool FunctionManager::SetPassedInput(Integer index, GmatBase *obj, bool &inputAd
       (wxT("   adding formal input '%s' to function object store\n"), formalInput.c_str());
    #endif
    
+   // Reuse the formal input object left from the previous call
+   ObjectMap::iterator fosi = functionObjectStore->find(formalInput);
+   if (fosi != functionObjectStore->end() && fosi->second != NULL &&
+       (fosi->second)->GetTypeName() == obj->GetTypeName())
+   {
+      (fosi->second)->Copy(obj);
+      (fosi->second)->SetName(formalInput);
+      
+      #ifdef DEBUG_INPUT
+      MessageInterface::ShowMessage
+         (wxT("FunctionManager::SetPassedInput() returning true, reused '%s'\n"),
+          formalInput.c_str());
+      #endif
+      return true;
+   }
+   
    // Add formalInput to function object store
    GmatBase *objFOS = obj->Clone();   
    objFOS->SetName(formalInput);
@@ -1552,23 +1569,30 @@ void FunctionManager::RefreshFormalInputObjects()
                throw FunctionException(errMsg2);
             }
             createdOthers[passedName] = obj;
-            fosObj = obj->Clone();
-            fosObj->SetName(formalName);
-            #ifdef DEBUG_MEMORY
-            MemoryTracker::Instance()->Add
-               (fosObj, formalName, wxT("FunctionManager::RefreshFormalInputObjects()"),
-                wxT("obj->Clone()"));
-            #endif
             
-            if (oldFosObj)
+            // The formal input object is reused and refreshed by Copy() below;
+            // it is only replaced when the input type changed
+            if (oldFosObj == NULL || oldFosObj->GetTypeName() != obj->GetTypeName())
             {
+               fosObj = obj->Clone();
+               fosObj->SetName(formalName);
                #ifdef DEBUG_MEMORY
-               MemoryTracker::Instance()->Remove
-                  (oldFosObj, oldFosObj->GetName(),
-                   wxT("FunctionManager::RefreshFormalInputObjects()"), wxT("deleting oldFosObj"));
+               MemoryTracker::Instance()->Add
+                  (fosObj, formalName, wxT("FunctionManager::RefreshFormalInputObjects()"),
+                   wxT("obj->Clone()"));
                #endif
-               delete oldFosObj;
-               oldFosObj = NULL;
+               (*functionObjectStore)[formalName] = fosObj;
+               
+               if (oldFosObj)
+               {
+                  #ifdef DEBUG_MEMORY
+                  MemoryTracker::Instance()->Remove
+                     (oldFosObj, oldFosObj->GetName(),
+                      wxT("FunctionManager::RefreshFormalInputObjects()"), wxT("deleting oldFosObj"));
+                  #endif
+                  delete oldFosObj;
+                  oldFosObj = NULL;
+               }
             }
             
             if (oldObj)
@@ -1946,11 +1970,13 @@ bool FunctionManager::HandleCallStack()
       // Unsubscribe subscribers since function run is completed
       UnsubscribeSubscribers(functionObjectStore);
       
-      // delete cloned object store
+      // Return cloned object stores to the pool so that the next call can
+      // refresh them instead of cloning the whole FOS again
       Integer numClones = clonedObjectStores.size();
       for (Integer i=0; i<numClones; i++)
       {
-         DeleteObjectMap(clonedObjectStores[i], wxT("clonedOS in Finalize"));
+         UnsubscribeSubscribers(clonedObjectStores[i]);
+         objectStorePool.push_back(clonedObjectStores[i]);
          clonedObjectStores[i] = NULL;
       }
       clonedObjectStores.clear();
@@ -2039,15 +2065,25 @@ ObjectMap* FunctionManager::PushToStack()
    ShowObjectMap(functionObjectStore, wxT("FOS at beg. of PushToStack"));
    #endif
    
-   // Clone the FOS
-   ObjectMap *clonedObjMap = new ObjectMap();
+   // Refresh a pooled clone of the FOS if there is one; otherwise clone it
+   ObjectMap *clonedObjMap = NULL;
+   if (!objectStorePool.empty())
+   {
+      clonedObjMap = objectStorePool.back();
+      objectStorePool.pop_back();
+      RefreshObjectMap(functionObjectStore, clonedObjMap);
+   }
+   else
+   {
+      clonedObjMap = new ObjectMap();
+      #ifdef DEBUG_MEMORY
+      MemoryTracker::Instance()->Add
+         (clonedObjMap, wxT("clonedObjMap"), fName + wxT(":FunctionManager::PushToStack()"),
+          wxT("*clonedObjMap = new ObjectMap"));
+      #endif
+      CloneObjectMap(functionObjectStore, clonedObjMap);
+   }
    clonedObjectStores.push_back(clonedObjMap);
-   #ifdef DEBUG_MEMORY
-   MemoryTracker::Instance()->Add
-      (clonedObjMap, wxT("clonedObjMap"), fName + wxT(":FunctionManager::PushToStack()"),
-       wxT("*clonedObjMap = new ObjectMap"));
-   #endif
-   CloneObjectMap(functionObjectStore, clonedObjMap);
    
    // Put the FOS onto the stack
    callStack.push(functionObjectStore);
@@ -2215,6 +2251,7 @@ void FunctionManager::Cleanup()
       clonedObjectStores[i] = NULL;
    }
    clonedObjectStores.clear();
+   ClearObjectStorePool();
    
    #ifdef DEBUG_CLEANUP
    MessageInterface::ShowMessage(wxT("==> FunctionManager::Cleanup() exiting\n"));
@@ -2503,6 +2540,107 @@ bool FunctionManager::CloneObjectMap(ObjectMap *orig, ObjectMap *cloned)
    return true;
 }
 
+//------------------------------------------------------------------------------
+// bool RefreshObjectMap(ObjectMap *orig, ObjectMap *pooled)
+//------------------------------------------------------------------------------
+/**
+ * Makes a pooled object store a copy of orig, reusing its objects.
+ *
+ * Objects with the same name and type are refreshed with Copy(); the others
+ * (and subscribers, which are registered with the Publisher) are cloned as in
+ * CloneObjectMap().  Pooled objects that are not reused are deleted.
+ *
+ * @param <orig>   The object store to copy
+ * @param <pooled> The pooled object store that receives the copy
+ *
+ * @return true on success, false if either map is NULL
+ */
+//------------------------------------------------------------------------------
+bool FunctionManager::RefreshObjectMap(ObjectMap *orig, ObjectMap *pooled)
+{
+   if (orig == NULL || pooled == NULL)
+      return false;
+   
+   ObjectMap refreshed, stale;
+   ObjectMap::iterator omi, pmi;
+   
+   for (omi = orig->begin(); omi != orig->end(); ++omi)
+   {
+      wxString strInMap = omi->first;
+      GmatBase *objInMap = omi->second;
+      
+      if (strInMap == wxT(""))
+         continue;
+      
+      GmatBase *pooledObj = NULL;
+      pmi = pooled->find(strInMap);
+      if (pmi != pooled->end())
+      {
+         pooledObj = pmi->second;
+         pooled->erase(pmi);
+      }
+      
+      if (pooledObj != NULL && !objInMap->IsOfType(Gmat::SUBSCRIBER) &&
+          pooledObj->GetTypeName() == objInMap->GetTypeName())
+      {
+         try
+         {
+            pooledObj->Copy(objInMap);
+            refreshed.insert(std::make_pair(strInMap, pooledObj));
+            continue;
+         }
+         catch (BaseException &)
+         {
+            // Types that cannot be copied are cloned
+         }
+      }
+      
+      if (pooledObj != NULL)
+         stale.insert(std::make_pair(strInMap, pooledObj));
+      
+      #ifdef DEBUG_FM_STACK
+         MessageInterface::ShowMessage(
+            wxT("PushToStack::Inserting clone of object \"%s\" into pooled object map\n"),
+            strInMap.c_str());
+      #endif
+      
+      GmatBase *clonedObj = objInMap->Clone();
+      #ifdef DEBUG_MEMORY
+      MemoryTracker::Instance()->Add
+         (clonedObj, strInMap, wxT("FunctionManager::RefreshObjectMap()"),
+          wxT("clonedObj = objInMap->Clone()"));
+      #endif
+      refreshed.insert(std::make_pair(strInMap, clonedObj));
+   }
+   
+   // Whatever is left in the pooled map is not in orig any more
+   for (pmi = pooled->begin(); pmi != pooled->end(); ++pmi)
+      stale.insert(*pmi);
+   EmptyObjectMap(&stale, wxT("stale pooled objects"));
+   
+   pooled->swap(refreshed);
+   
+   return true;
+}
+
+//------------------------------------------------------------------------------
+// void ClearObjectStorePool()
+//------------------------------------------------------------------------------
+/**
+ * Deletes the pooled object stores.
+ */
+//------------------------------------------------------------------------------
+void FunctionManager::ClearObjectStorePool()
+{
+   Integer numPooled = objectStorePool.size();
+   for (Integer i=0; i<numPooled; i++)
+   {
+      DeleteObjectMap(objectStorePool[i], wxT("pooled OS"));
+      objectStorePool[i] = NULL;
+   }
+   objectStorePool.clear();
+}
+
 //------------------------------------------------------------------------------
 // bool CopyObjectMap(ObjectMap *from, ObjectMap *to)
 //------------------------------------------------------------------------------
@@ -107,6 +107,8 @@ protected:
    ObjectMap            combinedObjectStore;
    /// Object stores cloned when push to stack
    std::vector<ObjectMap *> clonedObjectStores;
+   /// Cloned object stores released after a call, reused by PushToStack
+   std::vector<ObjectMap *> objectStorePool;
    /// Solar System, set by the local Sandbox, to pass to the function
    SolarSystem          *solarSys;
    /// transient forces to pass to the function
@@ -181,6 +183,8 @@ protected:
    bool                 DeleteObjectMap(ObjectMap *om, const wxString &mapID = wxT(""));
    bool                 ClearInOutWrappers();
    bool                 CloneObjectMap(ObjectMap *orig, ObjectMap *cloned);
+   bool                 RefreshObjectMap(ObjectMap *orig, ObjectMap *pooled);
+   void                 ClearObjectStorePool();
    bool                 CopyObjectMap(ObjectMap *from, ObjectMap *to);
    bool                 IsOnStack(ObjectMap *om);
    
@@ -50,6 +50,10 @@ FuelTank::PARAMETER_TEXT[FuelTankParamCount - HardwareParamCount] =
    wxT("PressureRegulated"),  // deprecated
 };
 
+const ParameterIndex
+FuelTank::PARAMETER_INDEX(PARAMETER_TEXT,
+      HardwareParamCount, FuelTankParamCount);
+
 /// Types of the parameters used by fuel tanks.
 const Gmat::ParameterType
 FuelTank::PARAMETER_TYPE[FuelTankParamCount - HardwareParamCount] =
@@ -239,11 +243,9 @@ wxString FuelTank::GetParameterUnit(const Integer id) const
 //------------------------------------------------------------------------------
 Integer FuelTank::GetParameterID(const wxString &str) const
 {
-   for (Integer i = HardwareParamCount; i < FuelTankParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - HardwareParamCount])
-         return i;
-   }
+   Integer id = PARAMETER_INDEX.Find(str);
+   if (id != -1)
+      return id;
    
    return Hardware::GetParameterID(str);
 }
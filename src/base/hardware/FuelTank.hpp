@@ -142,6 +142,8 @@ public:
    /// Parameter labels
    static const wxString 
       PARAMETER_TEXT[FuelTankParamCount - HardwareParamCount];
+   /// Hash index of the PARAMETER_TEXT labels, used by GetParameterID()
+   static const ParameterIndex PARAMETER_INDEX;
    /// Parameter types
    static const Gmat::ParameterType 
       PARAMETER_TYPE[FuelTankParamCount - HardwareParamCount];
@@ -38,6 +38,10 @@ Hardware::PARAMETER_TEXT[HardwareParamCount - GmatBaseParamCount] =
    wxT("Z_Direction")
 };
 
+const ParameterIndex
+Hardware::PARAMETER_INDEX(PARAMETER_TEXT,
+      GmatBaseParamCount, HardwareParamCount);
+
 
 /// Types of the parameters used by all hardware elements.
 const Gmat::ParameterType
@@ -187,11 +191,9 @@ wxString Hardware::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer Hardware::GetParameterID(const wxString &str) const
 {
-   for (Integer i = GmatBaseParamCount; i < HardwareParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - GmatBaseParamCount])
-         return i;
-   }
+   Integer id = PARAMETER_INDEX.Find(str);
+   if (id != -1)
+      return id;
    
    return GmatBase::GetParameterID(str);
 }
@@ -89,6 +89,8 @@ protected:
    /// Hardware Parameter labels
    static const wxString 
                         PARAMETER_TEXT[HardwareParamCount - GmatBaseParamCount];
+   /// Hash index of the PARAMETER_TEXT labels, used by GetParameterID()
+   static const ParameterIndex PARAMETER_INDEX;
    /// Hardware Parameter types
    static const Gmat::ParameterType 
                         PARAMETER_TYPE[HardwareParamCount - GmatBaseParamCount];
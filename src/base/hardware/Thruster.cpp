@@ -79,6 +79,10 @@ Thruster::PARAMETER_TEXT[ThrusterParamCount - HardwareParamCount] =
    wxT("K_UNITS"),
 };
 
+const ParameterIndex
+Thruster::PARAMETER_INDEX(PARAMETER_TEXT,
+      HardwareParamCount, ThrusterParamCount);
+
 /// Types of the parameters used by thrusters.
 const Gmat::ParameterType
 Thruster::PARAMETER_TYPE[ThrusterParamCount - HardwareParamCount] =
@@ -149,7 +153,15 @@ Thruster::Thruster(wxString nomme) :
    usingLocalCoordSys   (true),
    isMJ2000EqAxes       (false),
    isSpacecraftBodyAxes (false),
-   initialized          (false)
+   initialized          (false),
+   directionEpoch       (-1.0),
+   frameRotationValid   (false),
+   thrustCacheValid     (false),
+   cachedPressure       (0.0),
+   cachedTemperatureRatio (0.0),
+   pressureID           (-1),
+   temperatureID        (-1),
+   refTemperatureID     (-1)
 {
    objectTypes.push_back(Gmat::THRUSTER);
    objectTypeNames.push_back(wxT("Thruster"));
@@ -293,6 +305,14 @@ Thruster::Thruster(const Thruster& th) :
    isMJ2000EqAxes       (th.isMJ2000EqAxes),
    isSpacecraftBodyAxes (th.isSpacecraftBodyAxes),
    initialized          (false),
+   directionEpoch       (-1.0),
+   frameRotationValid   (false),
+   thrustCacheValid     (false),
+   cachedPressure       (0.0),
+   cachedTemperatureRatio (0.0),
+   pressureID           (-1),
+   temperatureID        (-1),
+   refTemperatureID     (-1),
    tankNames            (th.tankNames)
 {
    #ifdef DEBUG_THRUSTER_CONSTRUCTOR
@@ -394,6 +414,7 @@ Thruster& Thruster::operator=(const Thruster& th)
    
    localAxesLabels     = th.localAxesLabels;
    tankNames           = th.tankNames;
+   ResetThrustCaches();
    
    // copy tanks
    tanks               = th.tanks;
@@ -478,11 +499,9 @@ wxString Thruster::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer Thruster::GetParameterID(const wxString &str) const
 {
-   for (Integer i = HardwareParamCount; i < ThrusterParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - HardwareParamCount])
-         return i;
-   }
+   Integer id = PARAMETER_INDEX.Find(str);
+   if (id != -1)
+      return id;
    
    if (str == wxT("ThrustDirection1"))
       return DIRECTION_X;
@@ -690,6 +709,8 @@ Real Thruster::SetRealParameter(const Integer id, const Real value)
        GetName().c_str(), id, value);
    #endif
    
+   ResetThrustCaches();
+   
    switch (id) 
    {
       // Thrust coefficients
@@ -946,6 +967,8 @@ bool Thruster::SetStringParameter(const Integer id, const wxString &value)
        GetName().c_str(), id, value.c_str());
    #endif
    
+   ResetThrustCaches();
+   
    switch (id)
    {
    case COORDINATE_SYSTEM:
@@ -1040,6 +1063,8 @@ wxString Thruster::GetStringParameter(const Integer id,
 bool Thruster::SetStringParameter(const Integer id, const wxString &value,
                                   const Integer index)
 {
+   ResetThrustCaches();
+   
    switch (id)
    {
    case TANK:
@@ -1137,6 +1162,8 @@ bool Thruster::GetBooleanParameter(const Integer id) const
 //---------------------------------------------------------------------------
 bool Thruster::SetBooleanParameter(const Integer id, const bool value)
 {
+   ResetThrustCaches();
+   
    if (id == THRUSTER_FIRING) {
       #ifdef DEBUG_THRUSTER
          MessageInterface::ShowMessage(
@@ -1357,6 +1384,8 @@ bool Thruster::SetRefObject(GmatBase *obj, const Gmat::ObjectType type,
    if (obj == NULL)
       return false;
    
+   ResetThrustCaches();
+   
    if (type == Gmat::COORDINATE_SYSTEM && obj->GetType() == Gmat::COORDINATE_SYSTEM)
    {
       if (coordSystemName == name)
@@ -1572,6 +1601,8 @@ bool Thruster::Initialize()
    if (!retval)
       return false;
    
+   ResetThrustCaches();
+   
    if (!usingLocalCoordSys)
    {
       if (coordSystem == NULL)
@@ -1700,6 +1731,7 @@ bool Thruster::CalculateThrustAndIsp()
    {
       thrust  = 0.0;
       impulse = 0.0;
+      thrustCacheValid = false;
    }
    else 
    {
@@ -1708,13 +1740,22 @@ bool Thruster::CalculateThrustAndIsp()
                                  wxT("\" does not have a fuel tank"));
 
       // Require that the tanks all be at the same pressure and temperature
-      Integer pressID = tanks[0]->GetParameterID(wxT("Pressure"));
-      Integer tempID = tanks[0]->GetParameterID(wxT("Temperature"));
-      Integer refTempID = tanks[0]->GetParameterID(wxT("RefTemperature"));
+      if (pressureID == -1)
+      {
+         pressureID = tanks[0]->GetParameterID(wxT("Pressure"));
+         temperatureID = tanks[0]->GetParameterID(wxT("Temperature"));
+         refTemperatureID = tanks[0]->GetParameterID(wxT("RefTemperature"));
+      }
 
-      pressure = tanks[0]->GetRealParameter(pressID);
-      temperatureRatio = tanks[0]->GetRealParameter(tempID) /
-                         tanks[0]->GetRealParameter(refTempID);
+      pressure = tanks[0]->GetRealParameter(pressureID);
+      temperatureRatio = tanks[0]->GetRealParameter(temperatureID) /
+                         tanks[0]->GetRealParameter(refTemperatureID);
+
+      // The polynomials only depend on the tank state, so reuse the last
+      // evaluation when it has not changed
+      if (thrustCacheValid && (pressure == cachedPressure) &&
+          (temperatureRatio == cachedTemperatureRatio))
+         return true;
 
       thrust = cCoefficients[2];
       impulse = kCoefficients[2];
@@ -1752,6 +1793,10 @@ bool Thruster::CalculateThrustAndIsp()
       // Now add the temperature independent pieces
       thrust  += cCoefficients[0] + cCoefficients[1] * pressure;
       impulse += kCoefficients[0] + kCoefficients[1] * pressure;
+
+      cachedPressure = pressure;
+      cachedTemperatureRatio = temperatureRatio;
+      thrustCacheValid = true;
    }
    
    return true;
@@ -1839,6 +1884,7 @@ bool Thruster::SetSpacecraft(Spacecraft *sat)
    // If spcecraft is different
    if (spacecraft != sat)
    {
+      ResetThrustCaches();
       spacecraft = sat;
       satName = spacecraft->GetName();
       
@@ -2009,6 +2055,16 @@ void Thruster::ConvertDirectionToInertial(Real *dir, Real *dirInertial, Real epo
       // set coincident to true
       coordSystem->ToMJ2000Eq(epoch, inDir, outDir, true);
       
+      try
+      {
+         coordSystem->GetLastRotationMatrix(frameRotation);
+         frameRotationValid = true;
+      }
+      catch (BaseException &)
+      {
+         frameRotationValid = false;
+      }
+      
       #ifdef DEBUG_BURN_CONVERT_ROTMAT
       Rmatrix33 rotMat = coordSystem->GetLastRotationMatrix();
       MessageInterface::ShowMessage
@@ -2028,6 +2084,10 @@ void Thruster::ConvertDirectionToInertial(Real *dir, Real *dirInertial, Real epo
          dirInertial[0] = dir[0];
          dirInertial[1] = dir[1];
          dirInertial[2] = dir[2];
+         
+         for (Integer i = 0; i < 9; ++i)
+            frameRotation[i] = ((i % 4) == 0 ? 1.0 : 0.0);
+         frameRotationValid = true;
       }
       else if (isSpacecraftBodyAxes)
       {
@@ -2041,12 +2101,28 @@ void Thruster::ConvertDirectionToInertial(Real *dir, Real *dirInertial, Real epo
          outDir = inDir * rotMat;
          for (Integer i=0; i<3; i++)
             dirInertial[i] = outDir[i];
+         
+         // outDir = inDir * rotMat is inertialToBody applied to inDir
+         for (Integer i = 0; i < 3; ++i)
+            for (Integer j = 0; j < 3; ++j)
+               frameRotation[i*3+j] = inertialToBody(i, j);
+         frameRotationValid = true;
       }
       else
       {         
          // Now rotate to MJ2000Eq axes
          localCoordSystem->ToMJ2000Eq(epoch, inDir, outDir, true);
          
+         try
+         {
+            localCoordSystem->GetLastRotationMatrix(frameRotation);
+            frameRotationValid = true;
+         }
+         catch (BaseException &)
+         {
+            frameRotationValid = false;
+         }
+         
          dirInertial[0] = outDir[0];
          dirInertial[1] = outDir[1];
          dirInertial[2] = outDir[2];
@@ -2069,7 +2145,131 @@ void Thruster::ConvertDirectionToInertial(Real *dir, Real *dirInertial, Real epo
 //---------------------------------------------------------------------------
 void Thruster::ComputeInertialDirection(Real epoch)
 {
+   if (DirectionIsCurrent(epoch))
+      return;
+
+   frameRotationValid = false;
    ConvertDirectionToInertial(direction, inertialDirection, epoch);
+   SaveDirectionKey(epoch);
+}
+
+
+//---------------------------------------------------------------------------
+// bool DirectionIsCurrent(Real epoch)
+//---------------------------------------------------------------------------
+/**
+ * Checks if the cached inertial direction is valid for the epoch.
+ *
+ * The thrust frames can depend on the spacecraft state as well as the epoch
+ * (VNB and LVLH, for example), so the cached direction is keyed on both.
+ *
+ * @param epoch The epoch of the request
+ *
+ * @return true if inertialDirection can be used as is
+ */
+//---------------------------------------------------------------------------
+bool Thruster::DirectionIsCurrent(Real epoch)
+{
+   if (directionEpoch != epoch)
+      return false;
+
+   if (spacecraft != NULL)
+   {
+      Real *scState = spacecraft->GetState().GetState();
+      for (Integer i = 0; i < 6; ++i)
+         if (scState[i] != directionState[i])
+            return false;
+   }
+
+   return true;
+}
+
+
+//---------------------------------------------------------------------------
+// void SaveDirectionKey(Real epoch)
+//---------------------------------------------------------------------------
+/**
+ * Records the epoch and spacecraft state used for inertialDirection.
+ *
+ * @param epoch The epoch of the conversion
+ */
+//---------------------------------------------------------------------------
+void Thruster::SaveDirectionKey(Real epoch)
+{
+   directionEpoch = epoch;
+
+   if (spacecraft != NULL)
+   {
+      Real *scState = spacecraft->GetState().GetState();
+      for (Integer i = 0; i < 6; ++i)
+         directionState[i] = scState[i];
+   }
+}
+
+
+//---------------------------------------------------------------------------
+// wxString GetFrameKey() const
+//---------------------------------------------------------------------------
+/**
+ * Builds a label identifying the thrust frame.
+ *
+ * Thrusters on the same spacecraft with the same key share the rotation to
+ * MJ2000Eq, so it only needs to be computed once per epoch.
+ *
+ * @return The frame label
+ */
+//---------------------------------------------------------------------------
+wxString Thruster::GetFrameKey() const
+{
+   if (!usingLocalCoordSys)
+      return coordSystemName;
+
+   return wxT("Local:") + localOriginName + wxT(":") + localAxesName;
+}
+
+
+//---------------------------------------------------------------------------
+// void ApplyFrameRotation(const Real *rotation, Real epoch)
+//---------------------------------------------------------------------------
+/**
+ * Sets the inertial direction from a rotation computed by another thruster
+ * that uses the same thrust frame.
+ *
+ * @param rotation Row-major rotation from the thrust frame to MJ2000Eq
+ * @param epoch    The epoch of the rotation
+ */
+//---------------------------------------------------------------------------
+void Thruster::ApplyFrameRotation(const Real *rotation, Real epoch)
+{
+   if (DirectionIsCurrent(epoch))
+      return;
+
+   for (Integer i = 0; i < 3; ++i)
+      inertialDirection[i] = rotation[i*3]   * direction[0] +
+                             rotation[i*3+1] * direction[1] +
+                             rotation[i*3+2] * direction[2];
+
+   memcpy(frameRotation, rotation, 9 * sizeof(Real));
+   frameRotationValid = true;
+   SaveDirectionKey(epoch);
+}
+
+
+//---------------------------------------------------------------------------
+// void ResetThrustCaches()
+//---------------------------------------------------------------------------
+/**
+ * Discards the cached inertial direction and thrust/Isp evaluation.
+ */
+//---------------------------------------------------------------------------
+void Thruster::ResetThrustCaches()
+{
+   directionEpoch     = -1.0;
+   frameRotationValid = false;
+   thrustCacheValid   = false;
+   pressureID         = -1;
+   temperatureID      = -1;
+   refTemperatureID   = -1;
 }
 
 
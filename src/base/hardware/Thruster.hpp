@@ -148,6 +148,26 @@ protected:
    Real                       mDot;
    /// Thrust direction projected into the inertial coordinate system
    Real                       inertialDirection[3];
+   /// Epoch of the cached inertialDirection; -1.0 when it must be recomputed
+   Real                       directionEpoch;
+   /// Spacecraft state used for the cached inertialDirection
+   Real                       directionState[6];
+   /// Rotation from the thrust frame to MJ2000Eq (row-major)
+   Real                       frameRotation[9];
+   /// Flag indicating that frameRotation holds the last rotation used
+   bool                       frameRotationValid;
+   /// Flag indicating that thrust and impulse match the cached tank state
+   bool                       thrustCacheValid;
+   /// Tank pressure used for the cached thrust and impulse
+   Real                       cachedPressure;
+   /// Temperature ratio used for the cached thrust and impulse
+   Real                       cachedTemperatureRatio;
+   /// Tank pressure parameter ID
+   Integer                    pressureID;
+   /// Tank temperature parameter ID
+   Integer                    temperatureID;
+   /// Tank reference temperature parameter ID
+   Integer                    refTemperatureID;
    /// Array of thrust coefficients
    Real                       cCoefficients[COEFFICIENT_COUNT];
    /// Array of specific impulse coefficients
@@ -206,6 +226,8 @@ protected:
    /// Thruster parameter labels
    static const wxString
                         PARAMETER_TEXT[ThrusterParamCount - HardwareParamCount];
+   /// Hash index of the PARAMETER_TEXT labels, used by GetParameterID()
+   static const ParameterIndex PARAMETER_INDEX;
    /// Thruster parameter types
    static const Gmat::ParameterType
                         PARAMETER_TYPE[ThrusterParamCount - HardwareParamCount];
@@ -217,6 +239,11 @@ protected:
    void                 ConvertDirectionToInertial(Real *dv, Real *dvInertial,
                                                    Real epoch);
    void                 ComputeInertialDirection(Real epoch);
+   bool                 DirectionIsCurrent(Real epoch);
+   void                 SaveDirectionKey(Real epoch);
+   wxString             GetFrameKey() const;
+   void                 ApplyFrameRotation(const Real *rotation, Real epoch);
+   void                 ResetThrustCaches();
    void                 WriteDeprecatedMessage(const wxString &oldProp,
                                                const wxString &newProp) const;
    
@@ -0,0 +1,90 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                           HermiteInterpolation
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool.
+//
+// Copyright (c) 2002-2011 United States Government as represented by the
+// Administrator of The National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Created: 2026/10/18
+//
+/**
+ * Implements the Hermite interpolation of Cartesian states from positions and
+ * velocities at a set of nodes.
+ */
+//------------------------------------------------------------------------------
+
+
+#include "HermiteInterpolation.hpp"
+#include "InterpolatorException.hpp"
+
+
+//------------------------------------------------------------------------------
+// void HermiteState(Integer nodeCount, const Real *times, const Real *states,
+//                   Integer stride, Real time, Real state[6])
+//------------------------------------------------------------------------------
+/**
+ * Interpolates a Cartesian state from the states at a set of nodes.
+ *
+ * The position is the Hermite polynomial matching the node positions and
+ * velocities, built from divided differences on the doubled nodes and
+ * evaluated in Newton form; the velocity is its derivative.  The times are
+ * usually measured from the first node, in seconds, to keep the divided
+ * differences well conditioned.
+ *
+ * @param <nodeCount> Number of nodes, at most MAX_HERMITE_NODES
+ * @param <times>     Time of each node, in seconds
+ * @param <states>    Position and velocity of the first node; each node's
+ *                    state starts stride Reals after the previous one
+ * @param <stride>    Number of Reals from one node's state to the next
+ * @param <time>      Time of the requested state, in the units of times
+ * @param <state>     Output; the interpolated position and velocity
+ */
+//------------------------------------------------------------------------------
+void GmatInterpolationUtil::HermiteState(Integer nodeCount, const Real *times,
+      const Real *states, Integer stride, Real time, Real state[6])
+{
+   if ((nodeCount < 1) || (nodeCount > MAX_HERMITE_NODES))
+      throw InterpolatorException(wxT("Hermite interpolation was given too ")
+            wxT("few or too many nodes"));
+   
+   Integer nodes = 2 * nodeCount;
+   Real z[2 * MAX_HERMITE_NODES];
+   Real coef[2 * MAX_HERMITE_NODES];
+   
+   for (Integer j = 0; j < nodes; ++j)
+      z[j] = times[j/2];
+   
+   for (Integer axis = 0; axis < 3; ++axis)
+   {
+      // Divided differences on the doubled nodes, computed in place
+      for (Integer j = 0; j < nodes; ++j)
+         coef[j] = states[(j/2) * stride + axis];
+      
+      for (Integer j = nodes - 1; j >= 1; --j)
+      {
+         if (j % 2 == 1)
+            coef[j] = states[(j/2) * stride + 3 + axis];
+         else
+            coef[j] = (coef[j] - coef[j-1]) / (z[j] - z[j-1]);
+      }
+      
+      for (Integer order = 2; order < nodes; ++order)
+         for (Integer j = nodes - 1; j >= order; --j)
+            coef[j] = (coef[j] - coef[j-1]) / (z[j] - z[j-order]);
+      
+      // Evaluate the Newton form and its derivative
+      Real value = coef[nodes-1];
+      Real rate = 0.0;
+      for (Integer j = nodes - 2; j >= 0; --j)
+      {
+         rate  = rate * (time - z[j]) + value;
+         value = value * (time - z[j]) + coef[j];
+      }
+      
+      state[axis]   = value;
+      state[axis+3] = rate;
+   }
+}
@@ -0,0 +1,35 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                           HermiteInterpolation
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool.
+//
+// Copyright (c) 2002-2011 United States Government as represented by the
+// Administrator of The National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Created: 2026/10/18
+//
+/**
+ * Declares the Hermite interpolation of Cartesian states from positions and
+ * velocities at a set of nodes.
+ */
+//------------------------------------------------------------------------------
+
+
+#ifndef HermiteInterpolation_hpp
+#define HermiteInterpolation_hpp
+
+#include "gmatdefs.hpp"
+
+namespace GmatInterpolationUtil
+{
+   /// Largest number of nodes passed to HermiteState()
+   const Integer MAX_HERMITE_NODES = 16;
+   
+   void GMAT_API HermiteState(Integer nodeCount, const Real *times,
+                              const Real *states, Integer stride, Real time,
+                              Real state[6]);
+}
+
+#endif // HermiteInterpolation_hpp
@@ -24,7 +24,10 @@
 #include "FunctionRunner.hpp"
 #include "StringUtil.hpp"            // for GetArrayIndex()
 #include "InterpreterException.hpp"
+#include "ElementWrapper.hpp"
+#include "RealUtilities.hpp"
 #include "MessageInterface.hpp"
+#include <cmath>                     // for atan2()
 
 //#define DEBUG_MATH_TREE 1
 //#define DEBUG_MATH_TREE_INIT 1
@@ -32,6 +35,7 @@
 //#define DEBUG_MATH_WRAPPERS
 //#define DEBUG_RENAME
 //#define DEBUG_FUNCTION
+//#define DEBUG_MATH_TREE_COMPILE
 
 //#ifndef DEBUG_MEMORY
 //#define DEBUG_MEMORY
@@ -50,7 +54,9 @@
 //------------------------------------------------------------------------------
 MathTree::MathTree(const wxString &typeStr, const wxString &nomme) :
    GmatBase(Gmat::MATH_TREE, typeStr, nomme),
-   theTopNode(NULL)
+   theTopNode(NULL),
+   theWrapperMap(NULL),
+   isCompiled(false)
 {
 }
 
@@ -103,7 +109,9 @@ MathTree::MathTree(const MathTree &mt) :
    GmatBase           (mt),
    theTopNode         (mt.theTopNode),
    theObjectMap       (NULL),
-   theGlobalObjectMap (NULL)
+   theGlobalObjectMap (NULL),
+   theWrapperMap      (NULL),
+   isCompiled         (false)
 {
 }
 
@@ -129,6 +137,7 @@ MathTree& MathTree::operator=(const MathTree &mt)
    theTopNode         = mt.theTopNode;
    theObjectMap       = NULL;
    theGlobalObjectMap = NULL;
+   ClearProgram();
    
    return *this;
 }
@@ -241,6 +250,7 @@ MathNode* MathTree::GetTopNode()
 void MathTree::SetTopNode(MathNode *node)
 {
    theTopNode = node;
+   ClearProgram();
 }
 
 
@@ -249,6 +259,9 @@ void MathTree::SetTopNode(MathNode *node)
 //------------------------------------------------------------------------------
 void MathTree::SetMathWrappers(std::map<wxString, ElementWrapper*> *wrapperMap)
 {
+   // The program holds wrapper pointers, so it must be compiled again
+   ClearProgram();
+   
    if (theTopNode == NULL)
       return;
    
@@ -274,6 +287,13 @@ Real MathTree::Evaluate()
       (wxT("MathTree::Evaluate() theTopNode=%s, %s\n"), theTopNode->GetTypeName().c_str(),
        theTopNode->GetName().c_str());
    #endif
+   
+   if (isCompiled && !program.back().isMatrix)
+   {
+      RunProgram();
+      return registers.back();
+   }
+   
    return theTopNode->Evaluate();
 }
 
@@ -288,6 +308,13 @@ Rmatrix MathTree::MatrixEvaluate()
       (wxT("MathTree::MatrixEvaluate() theTopNode=%s, %s\n"), theTopNode->GetTypeName().c_str(),
        theTopNode->GetName().c_str());
    #endif
+   
+   if (isCompiled && program.back().isMatrix)
+   {
+      RunProgram();
+      return matrixRegisters.back();
+   }
+   
    return theTopNode->MatrixEvaluate();
 }
 
@@ -352,6 +379,102 @@ void MathTree::GetOutputInfo(Integer &type, Integer &rowCount, Integer &colCount
 }
 
 
+//------------------------------------------------------------------------------
+// bool Compile()
+//------------------------------------------------------------------------------
+/**
+ * Lowers the tree into a linear program of scalar and matrix operations.
+ *
+ * Each node becomes one instruction that writes its own preallocated register,
+ * with the children evaluated first.  Real results go to the scalar registers
+ * and Rmatrix results to matrix registers sized from the node output info, so
+ * array equations run without building temporary trees of values.  Subtrees
+ * built only from numbers are folded into a single constant, and parameters
+ * and arrays are read directly from their ElementWrappers.  Once compiled,
+ * Evaluate() and MatrixEvaluate() run the program without visiting the nodes.
+ *
+ * Matrix operations are compiled for the operand combinations the math nodes
+ * evaluate directly; anything else, along with function calls and function
+ * inputs, stays on the node evaluation so the nodes report any errors.  Call
+ * this after Initialize() and after the math wrappers are set.
+ *
+ * @return true if the tree was compiled, false if the nodes are still used
+ */
+//------------------------------------------------------------------------------
+bool MathTree::Compile()
+{
+   ClearProgram();
+   
+   if (theTopNode == NULL || theWrapperMap == NULL)
+      return false;
+   
+   if (CompileNode(theTopNode) < 0)
+   {
+      #ifdef DEBUG_MATH_TREE_COMPILE
+      MessageInterface::ShowMessage
+         (wxT("MathTree::Compile() %s, %s cannot be compiled; using the nodes\n"),
+          theTopNode->GetTypeName().c_str(), theTopNode->GetName().c_str());
+      #endif
+      ClearProgram();
+      return false;
+   }
+   
+   registers.assign(program.size(), 0.0);
+   for (UnsignedInt i = 0; i < program.size(); ++i)
+      matrixRegisters.push_back(Rmatrix(program[i].rows, program[i].cols));
+   isCompiled = true;
+   
+   #ifdef DEBUG_MATH_TREE_COMPILE
+   MessageInterface::ShowMessage
+      (wxT("MathTree::Compile() %s, %s compiled to %d instructions\n"),
+       theTopNode->GetTypeName().c_str(), theTopNode->GetName().c_str(),
+       program.size());
+   #endif
+   
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// bool IsCompiled()
+//------------------------------------------------------------------------------
+bool MathTree::IsCompiled()
+{
+   return isCompiled;
+}
+
+
+//------------------------------------------------------------------------------
+// bool IsCompiledReal()
+//------------------------------------------------------------------------------
+/**
+ * Checks for a compiled program that produces a Real.
+ *
+ * @return true if Evaluate() runs the program
+ */
+//------------------------------------------------------------------------------
+bool MathTree::IsCompiledReal()
+{
+   return (isCompiled && !program.back().isMatrix);
+}
+
+
+//------------------------------------------------------------------------------
+// void ClearProgram()
+//------------------------------------------------------------------------------
+/**
+ * Discards the compiled program so that Evaluate() walks the nodes again.
+ */
+//------------------------------------------------------------------------------
+void MathTree::ClearProgram()
+{
+   program.clear();
+   registers.clear();
+   matrixRegisters.clear();
+   isCompiled = false;
+}
+
+
 //------------------------------------------------------------------------------
 //  void SetObjectMap(ObjectMap *map)
 //------------------------------------------------------------------------------
@@ -544,6 +667,8 @@ bool MathTree::RenameRefObject(const Gmat::ObjectType type,
        newName.c_str());
    #endif
    
+   ClearProgram();
+   
    if (theTopNode)
       RenameParameter(theTopNode, type, oldName, newName);
    
@@ -1149,3 +1274,416 @@ void MathTree::DeleteNode(MathNode *node)
       DeleteNode(right);
 }
 
+
+//------------------------------------------------------------------------------
+// Integer CompileNode(MathNode *node)
+//------------------------------------------------------------------------------
+/**
+ * Appends the instructions for a node and its children to the program.
+ *
+ * @param <node> The node to compile
+ *
+ * @return the register holding the node's value, or -1 if the node cannot be
+ *         compiled
+ */
+//------------------------------------------------------------------------------
+Integer MathTree::CompileNode(MathNode *node)
+{
+   if (node == NULL)
+      return -1;
+   
+   Integer type, rowCount, colCount;
+   node->GetOutputInfo(type, rowCount, colCount);
+   if (type != Gmat::REAL_TYPE && type != Gmat::RMATRIX_TYPE)
+      return -1;
+   
+   // Matrix registers are sized here, so the size must be known
+   if (type == Gmat::RMATRIX_TYPE && (rowCount < 1 || colCount < 1))
+      return -1;
+   
+   MathInstruction inst;
+   inst.opCode     = LOAD_CONSTANT;
+   inst.left       = -1;
+   inst.right      = -1;
+   inst.value      = 0.0;
+   inst.wrapper    = NULL;
+   inst.isMatrix   = (type == Gmat::RMATRIX_TYPE);
+   inst.usesMatrix = inst.isMatrix;
+   inst.rows       = (inst.isMatrix ? rowCount : 1);
+   inst.cols       = (inst.isMatrix ? colCount : 1);
+   
+   if (!node->IsFunction())
+   {
+      if (node->IsFunctionInput())
+         return -1;
+      
+      if (node->IsNumber())
+      {
+         if (inst.isMatrix)
+            return -1;
+         inst.value = node->GetRealValue();
+      }
+      else
+      {
+         Integer elementType = node->GetElementType();
+         if (elementType != Gmat::REAL_TYPE && elementType != Gmat::RMATRIX_TYPE)
+            return -1;
+         if (inst.isMatrix && elementType != Gmat::RMATRIX_TYPE)
+            return -1;
+         
+         wxString refName = node->GetRefObjectName(Gmat::PARAMETER);
+         WrapperMap::iterator ewi = theWrapperMap->find(refName);
+         if (refName == wxT("") || ewi == theWrapperMap->end() ||
+             ewi->second == NULL)
+            return -1;
+         
+         inst.opCode  = (inst.isMatrix ? LOAD_ARRAY : LOAD_WRAPPER);
+         inst.wrapper = ewi->second;
+      }
+      
+      program.push_back(inst);
+      return (Integer)program.size() - 1;
+   }
+   
+   bool isBinary = false;
+   inst.opCode = GetOpCode(node->GetTypeName(), isBinary);
+   if (inst.opCode == OP_UNKNOWN)
+      return -1;
+   
+   MathNode *left = node->GetLeft();
+   MathNode *right = node->GetRight();
+   
+   // Unary plus has no left node
+   if (inst.opCode == OP_ADD && left == NULL)
+      return CompileNode(right);
+   
+   inst.left = CompileNode(left);
+   if (inst.left < 0)
+      return -1;
+   
+   if (isBinary)
+   {
+      inst.right = CompileNode(right);
+      if (inst.right < 0)
+         return -1;
+   }
+   
+   if (program[inst.left].isMatrix ||
+       (isBinary && program[inst.right].isMatrix))
+      inst.usesMatrix = true;
+   
+   if (inst.usesMatrix && !CheckOperands(inst))
+      return -1;
+   
+   // Fold operations on constants; the operands are the last instructions
+   bool leftConstant = (program[inst.left].opCode == LOAD_CONSTANT);
+   bool rightConstant = (!isBinary ||
+                         program[inst.right].opCode == LOAD_CONSTANT);
+   if (leftConstant && rightConstant)
+   {
+      try
+      {
+         Real value = ApplyOperation(inst.opCode, program[inst.left].value,
+               (isBinary ? program[inst.right].value : 0.0));
+         program.resize(inst.left);
+         
+         inst.opCode = LOAD_CONSTANT;
+         inst.left   = -1;
+         inst.right  = -1;
+         inst.value  = value;
+      }
+      catch (BaseException &)
+      {
+         // Leave the operation in the program so the error is raised when
+         // the equation is evaluated
+      }
+   }
+   
+   program.push_back(inst);
+   return (Integer)program.size() - 1;
+}
+
+
+//------------------------------------------------------------------------------
+// Integer GetOpCode(const wxString &typeName, bool &isBinary)
+//------------------------------------------------------------------------------
+/**
+ * Maps a math function type to the compiled operation.
+ *
+ * @param <typeName> Type name of the function node
+ * @param <isBinary> Set to true if the operation uses the right node
+ *
+ * @return the operation, or OP_UNKNOWN if the function is not compiled
+ */
+//------------------------------------------------------------------------------
+Integer MathTree::GetOpCode(const wxString &typeName, bool &isBinary)
+{
+   isBinary = true;
+   
+   if (typeName == wxT("Add"))         return OP_ADD;
+   if (typeName == wxT("Subtract"))    return OP_SUBTRACT;
+   if (typeName == wxT("Multiply"))    return OP_MULTIPLY;
+   if (typeName == wxT("Divide"))      return OP_DIVIDE;
+   if (typeName == wxT("Power"))       return OP_POWER;
+   if (typeName == wxT("Atan2"))       return OP_ATAN2;
+   
+   isBinary = false;
+   
+   if (typeName == wxT("Negate"))      return OP_NEGATE;
+   if (typeName == wxT("Sin"))         return OP_SIN;
+   if (typeName == wxT("Cos"))         return OP_COS;
+   if (typeName == wxT("Tan"))         return OP_TAN;
+   if (typeName == wxT("Asin"))        return OP_ASIN;
+   if (typeName == wxT("Acos"))        return OP_ACOS;
+   if (typeName == wxT("Atan"))        return OP_ATAN;
+   if (typeName == wxT("Sinh"))        return OP_SINH;
+   if (typeName == wxT("Cosh"))        return OP_COSH;
+   if (typeName == wxT("Tanh"))        return OP_TANH;
+   if (typeName == wxT("Asinh"))       return OP_ASINH;
+   if (typeName == wxT("Acosh"))       return OP_ACOSH;
+   if (typeName == wxT("Exp"))         return OP_EXP;
+   if (typeName == wxT("Log"))         return OP_LOG;
+   if (typeName == wxT("Log10"))       return OP_LOG10;
+   if (typeName == wxT("Sqrt"))        return OP_SQRT;
+   if (typeName == wxT("Abs"))         return OP_ABS;
+   if (typeName == wxT("DegToRad"))    return OP_DEG_TO_RAD;
+   if (typeName == wxT("RadToDeg"))    return OP_RAD_TO_DEG;
+   if (typeName == wxT("Transpose"))   return OP_TRANSPOSE;
+   if (typeName == wxT("Inverse"))     return OP_INVERSE;
+   if (typeName == wxT("Norm"))        return OP_NORM;
+   if (typeName == wxT("Determinant")) return OP_DETERMINANT;
+   
+   return OP_UNKNOWN;
+}
+
+
+//------------------------------------------------------------------------------
+// bool CheckOperands(const MathInstruction &inst)
+//------------------------------------------------------------------------------
+/**
+ * Checks that a matrix operation has operands the math nodes evaluate directly.
+ *
+ * Combinations that are not listed here, like a scalar added to a matrix, are
+ * left to the nodes.
+ *
+ * @param <inst> The instruction, with its operands already in the program
+ *
+ * @return true if the operation can be compiled
+ */
+//------------------------------------------------------------------------------
+bool MathTree::CheckOperands(const MathInstruction &inst)
+{
+   const MathInstruction &left = program[inst.left];
+   bool leftMatrix = left.isMatrix;
+   bool rightMatrix = (inst.right >= 0 && program[inst.right].isMatrix);
+   
+   if (inst.isMatrix)
+   {
+      switch (inst.opCode)
+      {
+      case OP_ADD:
+      case OP_SUBTRACT:
+         return (leftMatrix && rightMatrix);
+      case OP_MULTIPLY:
+      case OP_DIVIDE:
+         return (leftMatrix || rightMatrix);
+      case OP_NEGATE:
+      case OP_TRANSPOSE:
+      case OP_INVERSE:
+         return leftMatrix;
+      default:
+         return false;
+      }
+   }
+   
+   // Matrix operands giving a Real
+   switch (inst.opCode)
+   {
+   case OP_MULTIPLY:
+      // Row vector times column vector
+      return (leftMatrix && rightMatrix &&
+              left.rows == program[inst.right].cols);
+   case OP_TRANSPOSE:
+      return (leftMatrix && left.rows == 1 && left.cols == 1);
+   case OP_NORM:
+      return (leftMatrix && (left.rows == 1 || left.cols == 1));
+   case OP_DETERMINANT:
+      return leftMatrix;
+   default:
+      return false;
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// Real ApplyOperation(Integer opCode, Real left, Real right)
+//------------------------------------------------------------------------------
+/**
+ * Evaluates one arithmetic operation the same way the math nodes do.
+ *
+ * @param <opCode> The operation
+ * @param <left>   The left (or only) operand
+ * @param <right>  The right operand of binary operations
+ *
+ * @return the result of the operation
+ */
+//------------------------------------------------------------------------------
+Real MathTree::ApplyOperation(Integer opCode, Real left, Real right)
+{
+   switch (opCode)
+   {
+   case OP_ADD:         return left + right;
+   case OP_SUBTRACT:    return left - right;
+   case OP_MULTIPLY:    return left * right;
+   case OP_DIVIDE:      return left / right;
+   case OP_POWER:       return GmatMathUtil::Pow(left, right);
+   case OP_ATAN2:       return atan2(left, right);
+   case OP_NEGATE:      return left * -1;
+   case OP_SIN:         return GmatMathUtil::Sin(left);
+   case OP_COS:         return GmatMathUtil::Cos(left);
+   case OP_TAN:         return GmatMathUtil::Tan(left);
+   case OP_ASIN:        return GmatMathUtil::ASin(left);
+   case OP_ACOS:        return GmatMathUtil::ACos(left);
+   case OP_ATAN:        return GmatMathUtil::ATan(left);
+   case OP_SINH:        return GmatMathUtil::Sinh(left);
+   case OP_COSH:        return GmatMathUtil::Cosh(left);
+   case OP_TANH:        return GmatMathUtil::Tanh(left);
+   case OP_ASINH:       return GmatMathUtil::ASinh(left);
+   case OP_ACOSH:       return GmatMathUtil::ACosh(left);
+   case OP_EXP:         return GmatMathUtil::Exp(left);
+   case OP_LOG:         return GmatMathUtil::Log(left);
+   case OP_LOG10:       return GmatMathUtil::Log10(left);
+   case OP_SQRT:        return GmatMathUtil::Sqrt(left);
+   case OP_ABS:         return GmatMathUtil::Abs(left);
+   case OP_DEG_TO_RAD:  return GmatMathUtil::DegToRad(left);
+   case OP_RAD_TO_DEG:  return GmatMathUtil::RadToDeg(left);
+   case OP_TRANSPOSE:   return left;
+   case OP_INVERSE:     return GmatMathUtil::Pow(left, -1.0);
+   case OP_NORM:        return GmatMathUtil::Abs(left);
+   case OP_DETERMINANT: return left;
+   default:
+      break;
+   }
+   
+   throw InterpreterException(wxT("MathTree cannot evaluate unknown compiled ")
+                              wxT("operation"));
+}
+
+
+//------------------------------------------------------------------------------
+// void ApplyMatrixOperation(Integer index)
+//------------------------------------------------------------------------------
+/**
+ * Evaluates an operation on matrix registers the same way the math nodes do.
+ *
+ * @param <index> The instruction; its result is written to its own register
+ */
+//------------------------------------------------------------------------------
+void MathTree::ApplyMatrixOperation(Integer index)
+{
+   const MathInstruction &inst = program[index];
+   const MathInstruction &left = program[inst.left];
+   bool rightMatrix = (inst.right >= 0 && program[inst.right].isMatrix);
+   
+   switch (inst.opCode)
+   {
+   case OP_ADD:
+      matrixRegisters[index] = matrixRegisters[inst.left] +
+            matrixRegisters[inst.right];
+      return;
+   case OP_SUBTRACT:
+      matrixRegisters[index] = matrixRegisters[inst.left] -
+            matrixRegisters[inst.right];
+      return;
+   case OP_MULTIPLY:
+      if (!inst.isMatrix)
+         registers[index] = (matrixRegisters[inst.left] *
+               matrixRegisters[inst.right]).GetElement(0, 0);
+      else if (left.isMatrix && rightMatrix)
+         matrixRegisters[index] = matrixRegisters[inst.left] *
+               matrixRegisters[inst.right];
+      else if (left.isMatrix)
+         matrixRegisters[index] = matrixRegisters[inst.left] *
+               registers[inst.right];
+      else
+         matrixRegisters[index] = registers[inst.left] *
+               matrixRegisters[inst.right];
+      return;
+   case OP_DIVIDE:
+      if (left.isMatrix && rightMatrix)
+         matrixRegisters[index] = matrixRegisters[inst.left] /
+               matrixRegisters[inst.right];
+      else if (left.isMatrix)
+         matrixRegisters[index] = matrixRegisters[inst.left] /
+               registers[inst.right];
+      else
+         matrixRegisters[index] = registers[inst.left] /
+               matrixRegisters[inst.right];
+      return;
+   case OP_NEGATE:
+      matrixRegisters[index] = matrixRegisters[inst.left] * -1;
+      return;
+   case OP_TRANSPOSE:
+      if (inst.isMatrix)
+         matrixRegisters[index] = matrixRegisters[inst.left].Transpose();
+      else
+         registers[index] = matrixRegisters[inst.left](0, 0);
+      return;
+   case OP_INVERSE:
+      matrixRegisters[index] = matrixRegisters[inst.left].Inverse();
+      return;
+   case OP_NORM:
+      if (left.rows == 1)
+         registers[index] = matrixRegisters[inst.left].GetRow(0).Norm();
+      else
+         registers[index] = matrixRegisters[inst.left].GetColumn(0).Norm();
+      return;
+   case OP_DETERMINANT:
+      registers[index] = matrixRegisters[inst.left].Determinant();
+      return;
+   default:
+      break;
+   }
+   
+   throw InterpreterException(wxT("MathTree cannot evaluate unknown compiled ")
+                              wxT("matrix operation"));
+}
+
+
+//------------------------------------------------------------------------------
+// void RunProgram()
+//------------------------------------------------------------------------------
+/**
+ * Runs the compiled program in the preallocated registers.
+ *
+ * The last register holds the top node's value.
+ */
+//------------------------------------------------------------------------------
+void MathTree::RunProgram()
+{
+   Integer count = (Integer)program.size();
+   
+   for (Integer i = 0; i < count; ++i)
+   {
+      const MathInstruction &inst = program[i];
+      switch (inst.opCode)
+      {
+      case LOAD_CONSTANT:
+         registers[i] = inst.value;
+         break;
+      case LOAD_WRAPPER:
+         registers[i] = inst.wrapper->EvaluateReal();
+         break;
+      case LOAD_ARRAY:
+         matrixRegisters[i] = inst.wrapper->EvaluateArray();
+         break;
+      default:
+         if (inst.usesMatrix)
+            ApplyMatrixOperation(i);
+         else
+            registers[i] = ApplyOperation(inst.opCode, registers[inst.left],
+                  (inst.right < 0 ? 0.0 : registers[inst.right]));
+         break;
+      }
+   }
+}
@@ -64,6 +64,12 @@ public:
    void                 GetOutputInfo(Integer &type, Integer &rowCount,
                                       Integer &colCount);
    
+   // for the compiled evaluator
+   bool                 Compile();
+   bool                 IsCompiled();
+   bool                 IsCompiledReal();
+   void                 ClearProgram();
+   
    // for setting objects to FunctionRunner
    void                 SetObjectMap(ObjectMap *map);
    void                 SetGlobalObjectMap(ObjectMap *map);
@@ -99,6 +105,77 @@ protected:
    std::vector<Function*> theFunctions;
    std::vector<MathNode*> nodesToDelete;
    
+   /// Operations of the compiled evaluator
+   enum MathOpCode
+   {
+      LOAD_CONSTANT,
+      LOAD_WRAPPER,
+      LOAD_ARRAY,
+      OP_ADD,
+      OP_SUBTRACT,
+      OP_MULTIPLY,
+      OP_DIVIDE,
+      OP_POWER,
+      OP_ATAN2,
+      OP_NEGATE,
+      OP_SIN,
+      OP_COS,
+      OP_TAN,
+      OP_ASIN,
+      OP_ACOS,
+      OP_ATAN,
+      OP_SINH,
+      OP_COSH,
+      OP_TANH,
+      OP_ASINH,
+      OP_ACOSH,
+      OP_EXP,
+      OP_LOG,
+      OP_LOG10,
+      OP_SQRT,
+      OP_ABS,
+      OP_DEG_TO_RAD,
+      OP_RAD_TO_DEG,
+      OP_TRANSPOSE,
+      OP_INVERSE,
+      OP_NORM,
+      OP_DETERMINANT,
+      OP_UNKNOWN
+   };
+   
+   /// One step of the compiled program; the result goes to its own register
+   struct MathInstruction
+   {
+      Integer        opCode;
+      Integer        left;
+      Integer        right;
+      Real           value;
+      ElementWrapper *wrapper;
+      /// True if the result is a matrix, held in the matrix register
+      bool           isMatrix;
+      /// True if the result or an operand is a matrix
+      bool           usesMatrix;
+      /// Size of the result
+      Integer        rows;
+      Integer        cols;
+   };
+   
+   /// Linear program lowered from the tree by Compile()
+   std::vector<MathInstruction> program;
+   /// Scalar registers, one per instruction, sized when the tree is compiled
+   RealArray   registers;
+   /// Matrix registers, one per instruction, sized when the tree is compiled
+   std::vector<Rmatrix> matrixRegisters;
+   /// Flag indicating that Evaluate() runs the program instead of the nodes
+   bool        isCompiled;
+   
+   Integer CompileNode(MathNode *node);
+   bool    CheckOperands(const MathInstruction &inst);
+   Integer GetOpCode(const wxString &typeName, bool &isBinary);
+   Real    ApplyOperation(Integer opCode, Real left, Real right);
+   void    ApplyMatrixOperation(Integer index);
+   void    RunProgram();
+   
    bool InitializeParameter(MathNode *node);
    void FinalizeFunctionRunner(MathNode *node);
    void SetMathElementWrappers(MathNode *node);
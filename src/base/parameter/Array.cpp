@@ -45,7 +45,10 @@ Array::PARAMETER_TEXT[ArrayParamCount - ParameterParamCount] =
    wxT("ColValue"),
    wxT("InitialValue"),
    wxT("InitialValueType"),
-}; 
+};
+
+const ParameterIndex
+Array::PARAMETER_INDEX(PARAMETER_TEXT, ParameterParamCount, ArrayParamCount);
 
 const Gmat::ParameterType
 Array::PARAMETER_TYPE[ArrayParamCount - ParameterParamCount] =
@@ -304,11 +307,9 @@ wxString Array::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer Array::GetParameterID(const wxString &str) const
 {
-   for (int i=ParameterParamCount; i<ArrayParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - ParameterParamCount])
-         return i;
-   }
+   Integer id = PARAMETER_INDEX.Find(str);
+   if (id != -1)
+      return id;
    
    return Parameter::GetParameterID(str);
 }
@@ -141,6 +141,8 @@ protected:
       PARAMETER_TYPE[ArrayParamCount - ParameterParamCount];
    static const wxString
       PARAMETER_TEXT[ArrayParamCount - ParameterParamCount];
+   /// Hash index of the PARAMETER_TEXT labels, used by GetParameterID()
+   static const ParameterIndex PARAMETER_INDEX;
     
 private:
 
@@ -54,6 +54,9 @@ using namespace GmatMathUtil;
 
 CoordinateConverter OrbitData::mCoordConverter = CoordinateConverter();
 
+OrbitData::ElementCache OrbitData::elementCache[ELEMENT_CACHE_SIZE];
+Integer OrbitData::nextElementCache = 0;
+
 const wxString
 OrbitData::VALID_OBJECT_TYPE_LIST[OrbitDataObjectCount] =
 {
@@ -121,6 +124,7 @@ OrbitData::OrbitData(const wxString &name)
    mOutCoordSystem = NULL;
 
    firstTimeEpochWarning = false;
+   mCacheElements = false;
 }
 
 
@@ -157,6 +161,7 @@ OrbitData::OrbitData(const OrbitData &data)
    mOutCoordSystem = data.mOutCoordSystem;
 
    firstTimeEpochWarning = data.firstTimeEpochWarning;
+   mCacheElements = data.mCacheElements;
 }
 
 
@@ -195,6 +200,7 @@ OrbitData& OrbitData::operator= (const OrbitData &right)
    stateTypeId = right.stateTypeId;
    
    firstTimeEpochWarning = right.firstTimeEpochWarning;
+   mCacheElements = right.mCacheElements;
 
    return *this;
 }
@@ -316,6 +322,14 @@ Rvector6 OrbitData::GetCartState()
    if (mSpacecraft == NULL || mSolarSystem == NULL)
       InitializeRefObjects();
    
+   ElementCache *cache = GetElementCache();
+   if ((cache != NULL) && cache->hasCartState)
+   {
+      mCartEpoch = cache->epoch;
+      mCartState = cache->cartState;
+      return mCartState;
+   }
+   
    mCartEpoch = mSpacecraft->GetEpoch();
    mCartState.Set(mSpacecraft->GetState().GetState());
    
@@ -328,7 +342,14 @@ Rvector6 OrbitData::GetCartState()
    // if origin dependent parameter, the relative position/velocity is computed in
    // the parameter calculation, so just return prop state.
    if (mOriginDep)
+   {
+      if (cache != NULL)
+      {
+         cache->cartState = mCartState;
+         cache->hasCartState = true;
+      }
       return mCartState;
+   }
    
    if (mInternalCoordSystem == NULL || mOutCoordSystem == NULL)
    {
@@ -421,6 +442,12 @@ Rvector6 OrbitData::GetCartState()
       }
    }
    
+   if (cache != NULL)
+   {
+      cache->cartState = mCartState;
+      cache->hasCartState = true;
+   }
+   
    return mCartState;
 }
 
@@ -477,10 +504,23 @@ Rvector6 OrbitData::GetSphRaDecState()
    if (mSpacecraft == NULL || mSolarSystem == NULL)
       InitializeRefObjects();
    
+   ElementCache *cache = GetElementCache();
+   if ((cache != NULL) && cache->hasSphRaDecState)
+   {
+      mSphRaDecState = cache->sphRaDecState;
+      return mSphRaDecState;
+   }
+   
    // Call GetCartState() to convert to parameter coord system first
    Rvector6 state = GetCartState();
 //   mSphRaDecState = CartesianToSphericalRADEC(state);
    mSphRaDecState = stateConverter.FromCartesian(state, wxT("SphericalRADEC"));
+   
+   if (cache != NULL)
+   {
+      cache->sphRaDecState = mSphRaDecState;
+      cache->hasSphRaDecState = true;
+   }
 
    #ifdef DEBUG_ORBITDATA_STATE
    MessageInterface::ShowMessage
@@ -500,11 +540,23 @@ Rvector6 OrbitData::GetSphAzFpaState()
    if (mSpacecraft == NULL || mSolarSystem == NULL)
       InitializeRefObjects();
    
+   ElementCache *cache = GetElementCache();
+   if ((cache != NULL) && cache->hasSphAzFpaState)
+   {
+      mSphAzFpaState = cache->sphAzFpaState;
+      return mSphAzFpaState;
+   }
+   
    // Call GetCartState() to convert to parameter coord system first
    Rvector6 state = GetCartState();
    //   mSphAzFpaState = CartesianToSphericalAZFPA(state);
    mSphAzFpaState = stateConverter.FromCartesian(state, wxT("SphericalAZFPA"));
 
+   if (cache != NULL)
+   {
+      cache->sphAzFpaState = mSphAzFpaState;
+      cache->hasSphAzFpaState = true;
+   }
    
    return mSphAzFpaState;
 }
@@ -518,12 +570,22 @@ Rvector6 OrbitData::GetEquinState()
    if (mSpacecraft == NULL || mSolarSystem == NULL)
       InitializeRefObjects();
    
+   ElementCache *cache = GetElementCache();
+   if ((cache != NULL) && cache->hasEquinState)
+      return cache->equinState;
+   
    // Call GetCartState() to convert to parameter coord system first
    Rvector6 state = GetCartState();
 //   Rvector6 mEquinState = CartesianToEquinoctial(state, mGravConst);
    stateConverter.SetMu(mGravConst);
    Rvector6 mEquinState = stateConverter.FromCartesian(state, wxT("Equinoctial"));
    
+   if (cache != NULL)
+   {
+      cache->equinState = mEquinState;
+      cache->hasEquinState = true;
+   }
+   
    return mEquinState;
 }
 
@@ -563,12 +625,12 @@ Real OrbitData::GetKepReal(Integer item)
    MessageInterface::ShowMessage(wxT("OrbitData::GetKepReal() item=%d\n"), item);
    #endif
    
-   Rvector6 state = GetCartState();
-
-   if (mOriginDep && mOrigin->GetName() != wxT("Earth"))
-   {
-      state = state - mOrigin->GetMJ2000State(mCartEpoch);
-   }
+   ElementCache *cache = GetElementCache();
+   bool cacheItem = (cache != NULL) && (item >= SMA) && (item <= RADN);
+   if (cacheItem && (cache->kepRealSet & (1u << item)))
+      return cache->kepReal[item];
+   
+   Rvector6 state = GetElementCartState();
    
    Rvector3 pos(state[0], state[1], state[2]);
    Rvector3 vel(state[3], state[4], state[5]);   
@@ -580,46 +642,65 @@ Real OrbitData::GetKepReal(Integer item)
           wxT(") position vector is zero. pos: ") + pos.ToString() + wxT(" vel: ") +
           vel.ToString());
    
+   Real value;
    switch (item)
    {
    case SMA:
-      return Keplerian::CartesianToSMA(mGravConst, pos, vel);
+      value = Keplerian::CartesianToSMA(mGravConst, pos, vel);
+      break;
    case ECC:
-      return Keplerian::CartesianToECC(mGravConst, pos, vel);
+      value = Keplerian::CartesianToECC(mGravConst, pos, vel);
+      break;
    case INC:
-      return Keplerian::CartesianToINC(mGravConst, pos, vel);
+      value = Keplerian::CartesianToINC(mGravConst, pos, vel);
+      break;
    case TA:
-      return Keplerian::CartesianToTA(mGravConst, pos, vel);
+      value = Keplerian::CartesianToTA(mGravConst, pos, vel);
+      break;
    case EA:
-      return Keplerian::CartesianToEA(mGravConst, pos, vel);
+      value = Keplerian::CartesianToEA(mGravConst, pos, vel);
+      break;
    case MA:
    {
       #ifdef DEBUG_MA
       MessageInterface::ShowMessage(wxT("In OrbitData, computing MA -------\n"));
       #endif
-      return Keplerian::CartesianToMA(mGravConst, pos, vel);
+      value = Keplerian::CartesianToMA(mGravConst, pos, vel);
+      break;
    }
    case HA:
    {
       #ifdef DEBUG_HA
       MessageInterface::ShowMessage(wxT("In OrbitData, computing HA -------\n"));
       #endif
-      return Keplerian::CartesianToHA(mGravConst, pos, vel);
+      value = Keplerian::CartesianToHA(mGravConst, pos, vel);
+      break;
    }
    case RAAN:
-      return Keplerian::CartesianToRAAN(mGravConst, pos, vel);
+      value = Keplerian::CartesianToRAAN(mGravConst, pos, vel);
+      break;
    case RADN:
       {
          Real raanDeg = Keplerian::CartesianToRAAN(mGravConst, pos, vel);
-         return AngleUtil::PutAngleInDegRange(raanDeg + 180, 0.0, 360.0);
+         value = AngleUtil::PutAngleInDegRange(raanDeg + 180, 0.0, 360.0);
+         break;
       }
    case AOP:
-      return Keplerian::CartesianToAOP(mGravConst, pos, vel);
+      value = Keplerian::CartesianToAOP(mGravConst, pos, vel);
+      break;
       
    default:
       throw ParameterException(wxT("OrbitData::GetKepReal() Unknown parameter id: ") +
                                GmatRealUtil::ToString(item));
    }
+   
+   if (cacheItem)
+   {
+      cache->kepReal[item] = value;
+      cache->kepRealSet |= (1u << item);
+   }
+   
+   return value;
 }
 
 
@@ -636,15 +717,22 @@ Real OrbitData::GetOtherKepReal(Integer item)
    MessageInterface::ShowMessage(wxT("OrbitData::GetOtherKepReal() item=%d\n"), item);
    #endif
    
-   Rvector6 state = GetCartState();
+   ElementCache *cache = GetElementCache();
+   bool cacheItem = (cache != NULL) && (item >= MM) && (item <= ENERGY);
+   if (cacheItem && (cache->otherKepRealSet & (1u << (item - MM))))
+      return cache->otherKepReal[item - MM];
    
-   if (mOriginDep && mOrigin->GetName() != wxT("Earth"))
+   Rvector6 state = GetElementCartState();
+   
+   Real value = GmatCalcUtil::CalculateKeplerianData(VALID_OTHER_KEPLERIAN_PARAM_NAMES[item-MM], state, mGravConst);
+   
+   if (cacheItem)
    {
-      state = state - mOrigin->GetMJ2000State(mCartEpoch);
+      cache->otherKepReal[item - MM] = value;
+      cache->otherKepRealSet |= (1u << (item - MM));
    }
    
-   return GmatCalcUtil::CalculateKeplerianData(VALID_OTHER_KEPLERIAN_PARAM_NAMES[item-MM], state, mGravConst);
-   
+   return value;
 }
 
 
@@ -794,12 +882,7 @@ Real OrbitData::GetEquinReal(Integer item)
    MessageInterface::ShowMessage(wxT("OrbitData::GetEquinReal() item=%d\n"), item);
    #endif
    
-   Rvector6 state = GetCartState();
-
-   if (mOriginDep && mOrigin->GetName() != wxT("Earth"))
-   {
-      state = state - mOrigin->GetMJ2000State(mCartEpoch);
-   }
+   Rvector6 state = GetElementCartState();
    
    Rvector3 pos(state[0], state[1], state[2]);
    Rvector3 vel(state[3], state[4], state[5]);   
@@ -1054,6 +1137,121 @@ Real OrbitData::GetPositionMagnitude(SpacePoint *origin)
 }
 
 
+//------------------------------------------------------------------------------
+// Rvector6 GetElementCartState()
+//------------------------------------------------------------------------------
+/**
+ * Retrieves the Cartesian state used to compute orbit elements.
+ *
+ * For origin dependent parameters with an origin other than the Earth, this
+ * is the state relative to the origin.
+ *
+ * @return Cartesian state for the element computations.
+ */
+//------------------------------------------------------------------------------
+Rvector6 OrbitData::GetElementCartState()
+{
+   ElementCache *cache = GetElementCache();
+   if ((cache != NULL) && cache->hasElementState)
+   {
+      mCartEpoch = cache->epoch;
+      mCartState = cache->cartState;
+      return cache->elementState;
+   }
+   
+   Rvector6 state = GetCartState();
+   
+   if (mOriginDep && mOrigin->GetName() != wxT("Earth"))
+   {
+      state = state - mOrigin->GetMJ2000State(mCartEpoch);
+   }
+   
+   if (cache != NULL)
+   {
+      cache->elementState = state;
+      cache->hasElementState = true;
+   }
+   
+   return state;
+}
+
+
+//------------------------------------------------------------------------------
+// ElementCache* GetElementCache()
+//------------------------------------------------------------------------------
+/**
+ * Finds the shared cache entry for the current spacecraft state.
+ *
+ * A new entry replaces the oldest one when no entry matches.
+ *
+ * @return The cache entry, or NULL if this parameter does not use the cache.
+ */
+//------------------------------------------------------------------------------
+OrbitData::ElementCache* OrbitData::GetElementCache()
+{
+   if (!mCacheElements || (mSpacecraft == NULL))
+      return NULL;
+   
+   Real epoch = mSpacecraft->GetEpoch();
+   const Real *state = mSpacecraft->GetState().GetState();
+   CoordinateSystem *coordSystem = (mOriginDep ? NULL : mOutCoordSystem);
+   
+   for (Integer i = 0; i < ELEMENT_CACHE_SIZE; ++i)
+   {
+      ElementCache &entry = elementCache[i];
+      if ((entry.spacecraft == mSpacecraft) &&
+          (entry.coordSystem == coordSystem) &&
+          (entry.origin == mOrigin) &&
+          (entry.internalCoordSystem == mInternalCoordSystem) &&
+          (entry.epoch == epoch) && (entry.gravConst == mGravConst) &&
+          (entry.rawState[0] == state[0]) && (entry.rawState[1] == state[1]) &&
+          (entry.rawState[2] == state[2]) && (entry.rawState[3] == state[3]) &&
+          (entry.rawState[4] == state[4]) && (entry.rawState[5] == state[5]))
+         return &entry;
+   }
+   
+   ElementCache &entry = elementCache[nextElementCache];
+   nextElementCache = (nextElementCache + 1) % ELEMENT_CACHE_SIZE;
+   
+   entry.spacecraft = mSpacecraft;
+   entry.internalCoordSystem = mInternalCoordSystem;
+   entry.coordSystem = coordSystem;
+   entry.origin = mOrigin;
+   entry.epoch = epoch;
+   entry.gravConst = mGravConst;
+   for (Integer i = 0; i < 6; ++i)
+      entry.rawState[i] = state[i];
+   
+   entry.hasCartState = false;
+   entry.hasElementState = false;
+   entry.kepRealSet = 0;
+   entry.otherKepRealSet = 0;
+   entry.hasSphRaDecState = false;
+   entry.hasSphAzFpaState = false;
+   entry.hasEquinState = false;
+   
+   return &entry;
+}
+
+
+//------------------------------------------------------------------------------
+// static void ClearElementCache()
+//------------------------------------------------------------------------------
+/**
+ * Empties the shared element cache.
+ *
+ * Called when parameters are initialized, so entries never outlive the
+ * objects they were keyed on.
+ */
+//------------------------------------------------------------------------------
+void OrbitData::ClearElementCache()
+{
+   for (Integer i = 0; i < ELEMENT_CACHE_SIZE; ++i)
+      elementCache[i].spacecraft = NULL;
+   nextElementCache = 0;
+}
+
+
 // The inherited methods from RefData
 //------------------------------------------------------------------------------
 // virtual void InitializeRefObjects()
@@ -1064,6 +1262,9 @@ void OrbitData::InitializeRefObjects()
    MessageInterface::ShowMessage(wxT("OrbitData::InitializeRefObjects() entered.\n"));
    #endif
    
+   ClearElementCache();
+   mCacheElements = false;
+   
    mSpacecraft =
       (Spacecraft*)FindFirstObject(VALID_OBJECT_TYPE_LIST[SPACECRAFT]);
    
@@ -1169,6 +1370,14 @@ void OrbitData::InitializeRefObjects()
          mGravConst = ((CelestialBody*)mOrigin)->GetGravitationalConstant();
    }
    
+   // Results are shared only when they depend on nothing but this
+   // spacecraft's state and the epoch; an origin or axes defined by another
+   // spacecraft can move without changing the cache key
+   mCacheElements = !mOrigin->IsOfType(Gmat::SPACEOBJECT);
+   if (mCacheElements && !mOriginDep &&
+       mOutCoordSystem->AreAxesOfType(wxT("ObjectReferencedAxes")))
+      mCacheElements = false;
+   
    #ifdef DEBUG_ORBITDATA_INIT
    MessageInterface::ShowMessage
       (wxT("OrbitData::InitializeRefObjects() exiting, mOrigin.Name=%s, mGravConst=%f, ")
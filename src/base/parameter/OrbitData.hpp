@@ -91,6 +91,7 @@ protected:
    
    void SetInternalCoordSys(CoordinateSystem *cs);
    Rvector6 GetRelativeCartState(SpacePoint *origin);
+   Rvector6 GetElementCartState();
    Real GetPositionMagnitude(SpacePoint *origin);
    
    // The inherited methods from RefData
@@ -120,6 +121,8 @@ protected:
    StateConverter   stateConverter;
 
    bool        firstTimeEpochWarning;
+   /// Flag indicating that computed states and elements can be shared
+   bool        mCacheElements;
 
    // only one CoordinateConverter needed
    static CoordinateConverter mCoordConverter;
@@ -134,6 +137,50 @@ protected:
    enum {EQ_SMA, EY, EX, NY, NX, MLONG};
    enum {ORBIT_STM, ORBIT_STM_A, ORBIT_STM_B, ORBIT_STM_C, ORBIT_STM_D};
    
+   /**
+    * States and elements computed for one spacecraft state.
+    *
+    * Each orbit Parameter owns its own OrbitData, so the cache is shared by
+    * all of them.  An entry is keyed by the spacecraft, its epoch and
+    * internal state, the output coordinate system, the origin and the
+    * gravitational constant; parameters that agree on all of these (SMA, ECC,
+    * INC, RAAN, AOP and TA of one spacecraft, for example) reuse the same
+    * converted state and elements.
+    */
+   struct ElementCache
+   {
+      Spacecraft       *spacecraft;
+      CoordinateSystem *internalCoordSystem;
+      CoordinateSystem *coordSystem;
+      SpacePoint       *origin;
+      Real             epoch;
+      Real             gravConst;
+      Real             rawState[6];
+      
+      bool             hasCartState;
+      Rvector6         cartState;
+      bool             hasElementState;
+      Rvector6         elementState;
+      UnsignedInt      kepRealSet;
+      Real             kepReal[RADN + 1];
+      UnsignedInt      otherKepRealSet;
+      Real             otherKepReal[ENERGY - MM + 1];
+      bool             hasSphRaDecState;
+      Rvector6         sphRaDecState;
+      bool             hasSphAzFpaState;
+      Rvector6         sphAzFpaState;
+      bool             hasEquinState;
+      Rvector6         equinState;
+   };
+   
+   enum {ELEMENT_CACHE_SIZE = 16};
+   
+   static ElementCache elementCache[ELEMENT_CACHE_SIZE];
+   static Integer      nextElementCache;
+   
+   ElementCache* GetElementCache();
+   static void ClearElementCache();
+   
    enum
    {
       SPACECRAFT = 0,
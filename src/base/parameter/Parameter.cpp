@@ -50,6 +50,10 @@ Parameter::PARAMETER_TEXT[ParameterParamCount - GmatBaseParamCount] =
    wxT("Color"),
 };
 
+const ParameterIndex
+Parameter::PARAMETER_INDEX(PARAMETER_TEXT,
+      GmatBaseParamCount, ParameterParamCount);
+
 const Gmat::ParameterType
 Parameter::PARAMETER_TYPE[ParameterParamCount - GmatBaseParamCount] =
 {
@@ -959,11 +963,9 @@ wxString Parameter::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer Parameter::GetParameterID(const wxString &str) const
 {
-   for (int i=GmatBaseParamCount; i<ParameterParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - GmatBaseParamCount])
-         return i;
-   }
+   Integer id = PARAMETER_INDEX.Find(str);
+   if (id != -1)
+      return id;
    
    return GmatBase::GetParameterID(str);
 }
@@ -199,6 +199,8 @@ protected:
       PARAMETER_TYPE[ParameterParamCount - GmatBaseParamCount];
    static const wxString
       PARAMETER_TEXT[ParameterParamCount - GmatBaseParamCount];
+   /// Hash index of the PARAMETER_TEXT labels, used by GetParameterID()
+   static const ParameterIndex PARAMETER_INDEX;
 };
 #endif // Parameter_hpp
 
@@ -37,6 +37,10 @@ RealVar::PARAMETER_TEXT[RealVarParamCount - ParameterParamCount] =
    wxT("Value")
 };
 
+const ParameterIndex
+RealVar::PARAMETER_INDEX(PARAMETER_TEXT,
+      ParameterParamCount, RealVarParamCount);
+
 const Gmat::ParameterType
 RealVar::PARAMETER_TYPE[RealVarParamCount - ParameterParamCount] =
 {
@@ -273,11 +277,9 @@ void RealVar::SetReal(Real val)
 //------------------------------------------------------------------------------
 Integer RealVar::GetParameterID(const wxString &str) const
 {
-   for (int i=ParameterParamCount; i<RealVarParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - ParameterParamCount])
-         return i;
-   }
+   Integer id = PARAMETER_INDEX.Find(str);
+   if (id != -1)
+      return id;
    
    return Parameter::GetParameterID(str);
 }
@@ -73,6 +73,8 @@ protected:
       PARAMETER_TYPE[RealVarParamCount - ParameterParamCount];
    static const wxString
       PARAMETER_TEXT[RealVarParamCount - ParameterParamCount];
+   /// Hash index of the PARAMETER_TEXT labels, used by GetParameterID()
+   static const ParameterIndex PARAMETER_INDEX;
    
    bool mValueSet;
    bool mIsNumber;
@@ -36,6 +36,10 @@ StringVar::PARAMETER_TEXT[StringVarParamCount - ParameterParamCount] =
    wxT("Value"),
 };
 
+const ParameterIndex
+StringVar::PARAMETER_INDEX(PARAMETER_TEXT,
+      ParameterParamCount, StringVarParamCount);
+
 const Gmat::ParameterType
 StringVar::PARAMETER_TYPE[StringVarParamCount - ParameterParamCount] =
 {
@@ -260,11 +264,9 @@ void StringVar::Copy(const GmatBase* orig)
 //------------------------------------------------------------------------------
 Integer StringVar::GetParameterID(const wxString &str) const
 {
-   for (int i=ParameterParamCount; i<StringVarParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - ParameterParamCount])
-         return i;
-   }
+   Integer id = PARAMETER_INDEX.Find(str);
+   if (id != -1)
+      return id;
    
    return Parameter::GetParameterID(str);
 }
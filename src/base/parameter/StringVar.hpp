@@ -74,6 +74,8 @@ protected:
    
    static const wxString
       PARAMETER_TEXT[StringVarParamCount - ParameterParamCount];
+   /// Hash index of the PARAMETER_TEXT labels, used by GetParameterID()
+   static const ParameterIndex PARAMETER_INDEX;
    static const Gmat::ParameterType
       PARAMETER_TYPE[StringVarParamCount - ParameterParamCount];
    
@@ -1289,6 +1289,10 @@ ElapsedDays::PARAMETER_TEXT[ElapsedDaysParamCount - ParameterParamCount] =
    wxT("InitialEpoch")
 };
 
+const ParameterIndex
+ElapsedDays::PARAMETER_INDEX(PARAMETER_TEXT,
+      ParameterParamCount, ElapsedDaysParamCount);
+
 const Gmat::ParameterType
 ElapsedDays::PARAMETER_TYPE[ElapsedDaysParamCount - ParameterParamCount] =
 {
@@ -1483,11 +1487,9 @@ bool ElapsedDays::IsParameterReadOnly(const Integer id) const
 //------------------------------------------------------------------------------
 Integer ElapsedDays::GetParameterID(const wxString &str) const
 {
-   for (int i = ParameterParamCount; i < ElapsedDaysParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - ParameterParamCount])
-         return i;
-   }
+   Integer id = PARAMETER_INDEX.Find(str);
+   if (id != -1)
+      return id;
    
    return TimeReal::GetParameterID(str);
 }
@@ -1582,6 +1584,10 @@ ElapsedDaysFromStart::PARAMETER_TEXT[ElapsedDaysFromStartParamCount - ParameterP
    wxT("InitialEpoch")
 };
 
+const ParameterIndex
+ElapsedDaysFromStart::PARAMETER_INDEX(PARAMETER_TEXT,
+      ParameterParamCount, ElapsedDaysFromStartParamCount);
+
 const Gmat::ParameterType
 ElapsedDaysFromStart::PARAMETER_TYPE[ElapsedDaysFromStartParamCount - ParameterParamCount] =
 {
@@ -1776,11 +1782,9 @@ bool ElapsedDaysFromStart::IsParameterReadOnly(const Integer id) const
 //------------------------------------------------------------------------------
 Integer ElapsedDaysFromStart::GetParameterID(const wxString &str) const
 {
-   for (int i = ParameterParamCount; i < ElapsedDaysFromStartParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - ParameterParamCount])
-         return i;
-   }
+   Integer id = PARAMETER_INDEX.Find(str);
+   if (id != -1)
+      return id;
    
    return TimeReal::GetParameterID(str);
 }
@@ -1875,6 +1879,10 @@ ElapsedSecs::PARAMETER_TEXT[ElapsedSecsParamCount - ParameterParamCount] =
    wxT("InitialEpoch")
 };
 
+const ParameterIndex
+ElapsedSecs::PARAMETER_INDEX(PARAMETER_TEXT,
+      ParameterParamCount, ElapsedSecsParamCount);
+
 const Gmat::ParameterType
 ElapsedSecs::PARAMETER_TYPE[ElapsedSecsParamCount - ParameterParamCount] =
 {
@@ -2070,11 +2078,9 @@ bool ElapsedSecs::IsParameterReadOnly(const Integer id) const
 //------------------------------------------------------------------------------
 Integer ElapsedSecs::GetParameterID(const wxString &str) const
 {
-   for (int i = ParameterParamCount; i < ElapsedSecsParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - ParameterParamCount])
-         return i;
-   }
+   Integer id = PARAMETER_INDEX.Find(str);
+   if (id != -1)
+      return id;
    
    return TimeReal::GetParameterID(str);
 }
@@ -2169,6 +2175,10 @@ ElapsedSecsFromStart::PARAMETER_TEXT[ElapsedSecsFromStartParamCount - ParameterP
    wxT("InitialEpoch")
 };
 
+const ParameterIndex
+ElapsedSecsFromStart::PARAMETER_INDEX(PARAMETER_TEXT,
+      ParameterParamCount, ElapsedSecsFromStartParamCount);
+
 const Gmat::ParameterType
 ElapsedSecsFromStart::PARAMETER_TYPE[ElapsedSecsFromStartParamCount - ParameterParamCount] =
 {
@@ -2363,11 +2373,9 @@ bool ElapsedSecsFromStart::IsParameterReadOnly(const Integer id) const
 //------------------------------------------------------------------------------
 Integer ElapsedSecsFromStart::GetParameterID(const wxString &str) const
 {
-   for (int i = ParameterParamCount; i < ElapsedSecsFromStartParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - ParameterParamCount])
-         return i;
-   }
+   Integer id = PARAMETER_INDEX.Find(str);
+   if (id != -1)
+      return id;
    
    return TimeReal::GetParameterID(str);
 }
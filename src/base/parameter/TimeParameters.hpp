@@ -396,6 +396,8 @@ protected:
       PARAMETER_TYPE[ElapsedDaysParamCount - ParameterParamCount];
    static const wxString
       PARAMETER_TEXT[ElapsedDaysParamCount - ParameterParamCount];
+   /// Hash index of the PARAMETER_TEXT labels, used by GetParameterID()
+   static const ParameterIndex PARAMETER_INDEX;
     
 private:
 };
@@ -442,6 +444,8 @@ protected:
       PARAMETER_TYPE[ElapsedDaysFromStartParamCount - ParameterParamCount];
    static const wxString
       PARAMETER_TEXT[ElapsedDaysFromStartParamCount - ParameterParamCount];
+   /// Hash index of the PARAMETER_TEXT labels, used by GetParameterID()
+   static const ParameterIndex PARAMETER_INDEX;
     
 private:
 };
@@ -489,6 +493,8 @@ protected:
       PARAMETER_TYPE[ElapsedSecsParamCount - ParameterParamCount];
    static const wxString
       PARAMETER_TEXT[ElapsedSecsParamCount - ParameterParamCount];
+   /// Hash index of the PARAMETER_TEXT labels, used by GetParameterID()
+   static const ParameterIndex PARAMETER_INDEX;
    
 private:
 };
@@ -535,6 +541,8 @@ protected:
       PARAMETER_TYPE[ElapsedSecsFromStartParamCount - ParameterParamCount];
    static const wxString
       PARAMETER_TEXT[ElapsedSecsFromStartParamCount - ParameterParamCount];
+   /// Hash index of the PARAMETER_TEXT labels, used by GetParameterID()
+   static const ParameterIndex PARAMETER_INDEX;
     
 private:
 };
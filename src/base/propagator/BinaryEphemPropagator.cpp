@@ -0,0 +1,604 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                             BinaryEphemPropagator
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool.
+//
+// Copyright (c) 2002-2011 United States Government as represented by the
+// Administrator of The National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Created: 2026/10/18
+//
+/**
+ * Implementation for the BinaryEphemPropagator class
+ */
+//------------------------------------------------------------------------------
+
+
+#include "BinaryEphemPropagator.hpp"
+#include "MessageInterface.hpp"
+#include "FileManager.hpp"
+#include <cstring>                   // for memcpy()
+
+//#define DEBUG_INITIALIZATION
+//#define DEBUG_PROPAGATION
+
+//---------------------------------
+// static data
+//---------------------------------
+
+/// BinaryEphemPropagator parameter labels
+const wxString BinaryEphemPropagator::PARAMETER_TEXT[
+         BinaryEphemPropagatorParamCount - EphemerisPropagatorParamCount] =
+{
+      wxT("EphemerisFile")               //EPHEMERIS_FILE
+};
+
+const ParameterIndex
+BinaryEphemPropagator::PARAMETER_INDEX(PARAMETER_TEXT,
+      EphemerisPropagatorParamCount, BinaryEphemPropagatorParamCount);
+
+/// BinaryEphemPropagator parameter types
+const Gmat::ParameterType BinaryEphemPropagator::PARAMETER_TYPE[
+         BinaryEphemPropagatorParamCount - EphemerisPropagatorParamCount] =
+{
+      Gmat::STRING_TYPE             //EPHEMERIS_FILE
+};
+
+
+//---------------------------------
+// public
+//---------------------------------
+
+//------------------------------------------------------------------------------
+// BinaryEphemPropagator(const wxString &name)
+//------------------------------------------------------------------------------
+/**
+ * Default constructor
+ *
+ * @param name The name of the object that gets constructed
+ */
+//------------------------------------------------------------------------------
+BinaryEphemPropagator::BinaryEphemPropagator(const wxString &name) :
+   EphemerisPropagator        (wxT("BinaryEphem"), name)
+{
+   // GmatBase data
+   objectTypeNames.push_back(wxT("BinaryEphem"));
+   parameterCount = BinaryEphemPropagatorParamCount;
+
+   fileCentralBody = centralBody;
+}
+
+
+//------------------------------------------------------------------------------
+// ~BinaryEphemPropagator()
+//------------------------------------------------------------------------------
+/**
+ * Destructor
+ */
+//------------------------------------------------------------------------------
+BinaryEphemPropagator::~BinaryEphemPropagator()
+{
+}
+
+
+//------------------------------------------------------------------------------
+// BinaryEphemPropagator(const BinaryEphemPropagator & bep)
+//------------------------------------------------------------------------------
+/**
+ * Copy constructor
+ *
+ * The ephemeris file is not shared; the copy opens it when it is initialized.
+ *
+ * @param bep The object that is copied into this new one
+ */
+//------------------------------------------------------------------------------
+BinaryEphemPropagator::BinaryEphemPropagator(const BinaryEphemPropagator & bep) :
+   EphemerisPropagator        (bep),
+   ephemFileName              (bep.ephemFileName),
+   fileCentralBody            (bep.fileCentralBody)
+{
+}
+
+
+//------------------------------------------------------------------------------
+// BinaryEphemPropagator & operator =(const BinaryEphemPropagator & bep)
+//------------------------------------------------------------------------------
+/**
+ * Assignment operator
+ *
+ * @param bep The object that is provides data for into this one
+ *
+ * @return This propagator, configured to match bep.
+ */
+//------------------------------------------------------------------------------
+BinaryEphemPropagator & BinaryEphemPropagator::operator =(
+      const BinaryEphemPropagator & bep)
+{
+   if (this != &bep)
+   {
+      EphemerisPropagator::operator=(bep);
+
+      reader.Close();
+      ephemFileName = bep.ephemFileName;
+      fileCentralBody = bep.fileCentralBody;
+   }
+
+   return *this;
+}
+
+
+//------------------------------------------------------------------------------
+// GmatBase* Clone() const
+//------------------------------------------------------------------------------
+/**
+ * Generates a new object that matches this one
+ *
+ * @return The new object
+ */
+//------------------------------------------------------------------------------
+GmatBase* BinaryEphemPropagator::Clone() const
+{
+   return new BinaryEphemPropagator(*this);
+}
+
+
+//------------------------------------------------------------------------------
+// wxString GetParameterText(const Integer id) const
+//------------------------------------------------------------------------------
+/**
+ * Retrieves the script string for a parameter
+ *
+ * @param id The index of the parameter in the parameter tables
+ *
+ * @return The string
+ */
+//------------------------------------------------------------------------------
+wxString BinaryEphemPropagator::GetParameterText(const Integer id) const
+{
+   if (id >= EphemerisPropagatorParamCount &&
+       id < BinaryEphemPropagatorParamCount)
+      return PARAMETER_TEXT[id - EphemerisPropagatorParamCount];
+   return EphemerisPropagator::GetParameterText(id);
+}
+
+
+//------------------------------------------------------------------------------
+// Integer GetParameterID(const wxString &str) const
+//------------------------------------------------------------------------------
+/**
+ * Retrieves the ID of a parameter
+ *
+ * @param The script string for the parameter
+ *
+ * @return The parameter's ID
+ */
+//------------------------------------------------------------------------------
+Integer BinaryEphemPropagator::GetParameterID(const wxString &str) const
+{
+   Integer id = PARAMETER_INDEX.Find(str);
+   if (id != -1)
+      return id;
+
+   return EphemerisPropagator::GetParameterID(str);
+}
+
+
+//------------------------------------------------------------------------------
+// Gmat::ParameterType GetParameterType(const Integer id) const
+//------------------------------------------------------------------------------
+/**
+ * Retrieves the type for a parameter
+ *
+ * @param id The ID of the parameter
+ *
+ * @return The parameter's type
+ */
+//------------------------------------------------------------------------------
+Gmat::ParameterType BinaryEphemPropagator::GetParameterType(
+      const Integer id) const
+{
+   if (id >= EphemerisPropagatorParamCount &&
+       id < BinaryEphemPropagatorParamCount)
+      return PARAMETER_TYPE[id - EphemerisPropagatorParamCount];
+   return EphemerisPropagator::GetParameterType(id);
+}
+
+
+//------------------------------------------------------------------------------
+// wxString GetParameterTypeString(const Integer id) const
+//------------------------------------------------------------------------------
+/**
+ * Retrieves a string description of a parameter's type
+ *
+ * @param id The ID of the parameter
+ *
+ * @return The type of the parameter
+ */
+//------------------------------------------------------------------------------
+wxString BinaryEphemPropagator::GetParameterTypeString(const Integer id) const
+{
+   if (id >= EphemerisPropagatorParamCount &&
+       id < BinaryEphemPropagatorParamCount)
+      return EphemerisPropagator::PARAM_TYPE_STRING[GetParameterType(id)];
+   return EphemerisPropagator::GetParameterTypeString(id);
+}
+
+
+//------------------------------------------------------------------------------
+// wxString GetParameterUnit(const Integer id) const
+//------------------------------------------------------------------------------
+/**
+ * retrieves the dimensional units for a parameter
+ *
+ * @param id The ID of the parameter
+ *
+ * @return The unit label
+ */
+//------------------------------------------------------------------------------
+wxString BinaryEphemPropagator::GetParameterUnit(const Integer id) const
+{
+   return EphemerisPropagator::GetParameterUnit(id);
+}
+
+
+//------------------------------------------------------------------------------
+// wxString GetStringParameter(const Integer id) const
+//------------------------------------------------------------------------------
+/**
+ * Retrieves a string parameter
+ *
+ * @param id The ID of the parameter
+ *
+ * @return The parameter's value
+ */
+//------------------------------------------------------------------------------
+wxString BinaryEphemPropagator::GetStringParameter(const Integer id) const
+{
+   if (id == EPHEMERIS_FILE)
+      return ephemFileName;
+
+   return EphemerisPropagator::GetStringParameter(id);
+}
+
+
+//------------------------------------------------------------------------------
+// bool SetStringParameter(const Integer id, const wxString &value)
+//------------------------------------------------------------------------------
+/**
+ * Sets a string parameter
+ *
+ * @param id The ID of the parameter
+ * @param value The new value
+ *
+ * @return true on success, false on failure
+ */
+//------------------------------------------------------------------------------
+bool BinaryEphemPropagator::SetStringParameter(const Integer id,
+      const wxString &value)
+{
+   if (id == EPHEMERIS_FILE)
+   {
+      ephemFileName = value;
+      return true;
+   }
+
+   bool retval = EphemerisPropagator::SetStringParameter(id, value);
+
+   if (retval && (id == EPHEM_CENTRAL_BODY))
+   {
+      // EphemerisFile writes the Moon's name as "Moon"
+      if (centralBody == wxT("Luna"))
+         fileCentralBody = wxT("Moon");
+      else
+         fileCentralBody = centralBody;
+   }
+
+   return retval;
+}
+
+
+//------------------------------------------------------------------------------
+// wxString GetStringParameter(const wxString &label) const
+//------------------------------------------------------------------------------
+/**
+ * Retrieves a string parameter
+ *
+ * @param label The script label of the parameter
+ *
+ * @return The parameter's value
+ */
+//------------------------------------------------------------------------------
+wxString BinaryEphemPropagator::GetStringParameter(const wxString &label) const
+{
+   return GetStringParameter(GetParameterID(label));
+}
+
+
+//------------------------------------------------------------------------------
+// bool SetStringParameter(const wxString &label, const wxString &value)
+//------------------------------------------------------------------------------
+/**
+ * Sets a string parameter
+ *
+ * @param label The script label of the parameter
+ * @param value The new value
+ *
+ * @return true on success, false on failure
+ */
+//------------------------------------------------------------------------------
+bool BinaryEphemPropagator::SetStringParameter(const wxString &label,
+      const wxString &value)
+{
+   return SetStringParameter(GetParameterID(label), value);
+}
+
+
+//------------------------------------------------------------------------------
+// bool Initialize()
+//------------------------------------------------------------------------------
+/**
+ * Prepares the BinaryEphemPropagator for use in a run
+ *
+ * The file is opened first so that the ephemeris span is known when the start
+ * epoch is taken from the ephemeris.
+ *
+ * @return true on success, false on failure
+ */
+//------------------------------------------------------------------------------
+bool BinaryEphemPropagator::Initialize()
+{
+   #ifdef DEBUG_INITIALIZATION
+      MessageInterface::ShowMessage
+         (wxT("BinaryEphemPropagator::Initialize() entered, file is '%s'\n"),
+          ephemFileName.c_str());
+   #endif
+
+   bool retval = false;
+
+   OpenEphemeris();
+   SetEphemSpan();
+
+   if (EphemerisPropagator::Initialize())
+   {
+      stepTaken = 0.0;
+
+      if (propObjects.size() != 1)
+         throw PropagatorException(wxT("Binary ephemeris propagators (i.e. ")
+               wxT("\"BinaryEphem\" propagators) require exactly one SpaceObject."));
+
+      currentEpoch = initialEpoch + timeFromEpoch /
+            GmatTimeConstants::SECS_PER_DAY;
+
+      LoadState(wxT("initialize outside of the timespan of the ephemeris data"));
+      UpdateSpaceObject(currentEpoch);
+
+      retval = true;
+   }
+
+   #ifdef DEBUG_INITIALIZATION
+      MessageInterface::ShowMessage(wxT("BinaryEphemPropagator::Initialize(): ")
+            wxT("Start state at epoch %.12lf is ["), currentEpoch);
+      for (Integer i = 0; i < dimension; ++i)
+      {
+         MessageInterface::ShowMessage(wxT("%.12lf"), state[i]);
+         if (i < dimension-1)
+            MessageInterface::ShowMessage(wxT("   "));
+         else
+            MessageInterface::ShowMessage(wxT("]\n"));
+      }
+   #endif
+
+   return retval;
+}
+
+
+//------------------------------------------------------------------------------
+// bool Step()
+//------------------------------------------------------------------------------
+/**
+ * Advances the state vector by the ephem step
+ *
+ * @return true on success, false on failure
+ */
+//------------------------------------------------------------------------------
+bool BinaryEphemPropagator::Step()
+{
+   #ifdef DEBUG_PROPAGATION
+      MessageInterface::ShowMessage(wxT("BinaryEphemPropagator::Step() entered: ")
+            wxT("initialEpoch = %.12lf; stepsize = %.12lf; ")
+            wxT("timeFromEpoch = %.12lf\n"), initialEpoch, ephemStep, timeFromEpoch);
+   #endif
+
+   if (!reader.IsOpen())
+      return false;
+
+   timeFromEpoch += ephemStep;
+   stepTaken = ephemStep;
+   currentEpoch = initialEpoch + timeFromEpoch /
+         GmatTimeConstants::SECS_PER_DAY;
+
+   LoadState(wxT("step outside of the span of the ephemeris data"));
+   UpdateSpaceObject(currentEpoch);
+
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// bool RawStep()
+//------------------------------------------------------------------------------
+/**
+ * Performs a propagation step without error control
+ *
+ * @note: RawStep is not used with the BinaryEphemPropagator
+ *
+ * @return false always
+ */
+//------------------------------------------------------------------------------
+bool BinaryEphemPropagator::RawStep()
+{
+   bool retval = false;
+   return retval;
+}
+
+
+//------------------------------------------------------------------------------
+// Real GetStepTaken()
+//------------------------------------------------------------------------------
+/**
+ * Retrieves the size of the most recent BinaryEphemPropagator step
+ *
+ * @return The most recent step (0.0 if no step was taken with this instance).
+ */
+//------------------------------------------------------------------------------
+Real BinaryEphemPropagator::GetStepTaken()
+{
+   return stepTaken;
+}
+
+
+//------------------------------------------------------------------------------
+// void UpdateState()
+//------------------------------------------------------------------------------
+/**
+ * Updates the propagation state vector with data from the ephemeris file
+ */
+//------------------------------------------------------------------------------
+void BinaryEphemPropagator::UpdateState()
+{
+   if (reader.IsOpen())
+      LoadState(wxT("access state data outside of the span of the ephemeris ")
+            wxT("data"));
+}
+
+
+//------------------------------------------------------------------------------
+// void SetEphemSpan(Integer whichOne)
+//------------------------------------------------------------------------------
+/**
+ * Sets the start and end epoch from the header of the ephemeris file
+ *
+ * @param whichOne Not currrently used.
+ */
+//------------------------------------------------------------------------------
+void BinaryEphemPropagator::SetEphemSpan(Integer whichOne)
+{
+   if (whichOne < 0)
+      throw PropagatorException(wxT("BinaryEphemPropagator::SetEphemSpan(")
+            wxT("Integer whichOne): Invalid index"));
+
+   if (reader.IsOpen())
+   {
+      ephemStart = reader.GetStartEpoch();
+      ephemEnd   = reader.GetEndEpoch();
+
+      #ifdef DEBUG_INITIALIZATION
+         MessageInterface::ShowMessage(wxT("EphemSpan is [%.12lf %.12lf]\n"),
+               ephemStart, ephemEnd);
+      #endif
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// void OpenEphemeris()
+//------------------------------------------------------------------------------
+/**
+ * Opens the ephemeris file and checks that its states can be used
+ *
+ * Names without path information are looked up in the ephemeris directory.
+ * The states must be in MJ2000Eq axes about the propagator's central body.
+ */
+//------------------------------------------------------------------------------
+void BinaryEphemPropagator::OpenEphemeris()
+{
+   if (ephemFileName == wxT(""))
+      throw PropagatorException(wxT("The BinaryEphem propagator ") +
+            instanceName + wxT(" requires an EphemerisFile"));
+
+   wxString fullPath = ephemFileName;
+
+   // If no path designation slash character is found, add the default path
+   if ((fullPath.find(wxT('/')) == wxString::npos) &&
+       (fullPath.find(wxT('\\')) == wxString::npos))
+   {
+      FileManager *fm = FileManager::Instance();
+      fullPath = fm->GetPathname(FileManager::EPHEM_PATH) + fullPath;
+   }
+
+   // Reopen on every run; the file may have been rewritten since the last one
+   try
+   {
+      reader.Open(fullPath);
+   }
+   catch (BaseException &e)
+   {
+      throw PropagatorException(e.GetFullMessage());
+   }
+
+   if (reader.GetAxesType() != wxT("MJ2000Eq"))
+      throw PropagatorException(wxT("The BinaryEphem propagator ") +
+            instanceName + wxT(" requires MJ2000Eq states, but the ephemeris ")
+            wxT("file \"") + fullPath + wxT("\" uses ") + reader.GetAxesType() +
+            wxT(" axes"));
+
+   if (reader.GetCentralBody() != fileCentralBody)
+      throw PropagatorException(wxT("The BinaryEphem propagator ") +
+            instanceName + wxT(" uses the central body ") + centralBody +
+            wxT(", but the ephemeris file \"") + fullPath +
+            wxT("\" contains states about ") + reader.GetCentralBody());
+
+   #ifdef DEBUG_INITIALIZATION
+      MessageInterface::ShowMessage(wxT("Opened '%s' for %s with %d records\n"),
+            fullPath.c_str(), reader.GetObjectName().c_str(),
+            reader.GetRecordCount());
+   #endif
+}
+
+
+//------------------------------------------------------------------------------
+// void LoadState(const wxString &action)
+//------------------------------------------------------------------------------
+/**
+ * Sets the state vector to the ephemeris state at the current epoch
+ *
+ * @param action Description of the request used if the epoch is outside of
+ *               the ephemeris
+ */
+//------------------------------------------------------------------------------
+void BinaryEphemPropagator::LoadState(const wxString &action)
+{
+   Real outState[6];
+
+   // Allow for slop in the last few bits
+   if ((currentEpoch < ephemStart - 1e-10) ||
+       (currentEpoch > ephemEnd + 1e-10) ||
+       !reader.GetState(currentEpoch, outState))
+   {
+      wxString errmsg;
+      errmsg << wxT("The BinaryEphemPropagator ")
+             << instanceName
+             << wxT(" is attempting to ") << action << wxT("; halting.  ");
+      errmsg << wxT("The ephemeris covers the A.1 modified Julian span ");
+      errmsg << ephemStart << wxT(" to ") << ephemEnd << wxT(" and the ")
+             wxT("requested epoch is ") << currentEpoch << wxT(".\n");
+      throw PropagatorException(errmsg);
+   }
+
+   std::memcpy(state, outState, dimension*sizeof(Real));
+
+   #ifdef DEBUG_PROPAGATION
+      MessageInterface::ShowMessage(wxT("(LoadState for %p) State at epoch ")
+            wxT("%.12lf is ["), this, currentEpoch);
+      for (Integer i = 0; i < dimension; ++i)
+      {
+         MessageInterface::ShowMessage(wxT("%.12lf"), state[i]);
+         if (i < 5)
+            MessageInterface::ShowMessage(wxT("   "));
+         else
+            MessageInterface::ShowMessage(wxT("]\n"));
+      }
+   #endif
+}
@@ -0,0 +1,93 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                             BinaryEphemPropagator
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool.
+//
+// Copyright (c) 2002-2011 United States Government as represented by the
+// Administrator of The National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Created: 2026/10/18
+//
+/**
+ * Definition for the BinaryEphemPropagator class
+ */
+//------------------------------------------------------------------------------
+
+
+#ifndef BinaryEphemPropagator_hpp
+#define BinaryEphemPropagator_hpp
+
+#include "EphemerisPropagator.hpp"
+#include "BinaryEphemerisReader.hpp"
+
+
+/**
+ * Propagates a spacecraft by sampling a binary ephemeris file written by an
+ * EphemerisFile with FileFormat "Binary".
+ */
+class BinaryEphemPropagator : public EphemerisPropagator
+{
+public:
+   BinaryEphemPropagator(const wxString &name = wxT(""));
+   virtual ~BinaryEphemPropagator();
+   BinaryEphemPropagator(const BinaryEphemPropagator& bep);
+   BinaryEphemPropagator& operator=(const BinaryEphemPropagator& bep);
+
+   // Access methods for the scriptable parameters
+   virtual wxString  GetParameterText(const Integer id) const;
+   virtual wxString  GetParameterUnit(const Integer id) const;
+   virtual Integer      GetParameterID(const wxString &str) const;
+   virtual Gmat::ParameterType
+                        GetParameterType(const Integer id) const;
+   virtual wxString  GetParameterTypeString(const Integer id) const;
+
+   virtual wxString  GetStringParameter(const Integer id) const;
+   virtual bool         SetStringParameter(const Integer id,
+                                           const wxString &value);
+   virtual wxString  GetStringParameter(const wxString &label) const;
+   virtual bool         SetStringParameter(const wxString &label,
+                                           const wxString &value);
+
+   virtual bool Initialize();
+
+   virtual GmatBase* Clone() const;
+   virtual bool Step();
+   virtual bool RawStep();
+   virtual Real GetStepTaken();
+
+protected:
+   /// The binary ephemeris file, as scripted
+   wxString ephemFileName;
+   /// Central body name used in the file (needed because of Luna/Moon names)
+   wxString fileCentralBody;
+
+   BinaryEphemerisReader reader;
+
+
+   /// Parameter IDs
+   enum
+   {
+      EPHEMERIS_FILE = EphemerisPropagatorParamCount,
+      BinaryEphemPropagatorParamCount,
+   };
+
+   /// BinaryEphemPropagator parameter types
+   static const Gmat::ParameterType PARAMETER_TYPE[
+         BinaryEphemPropagatorParamCount - EphemerisPropagatorParamCount];
+   /// BinaryEphemPropagator parameter labels
+   static const wxString PARAMETER_TEXT[
+         BinaryEphemPropagatorParamCount - EphemerisPropagatorParamCount];
+   /// Hash index of the PARAMETER_TEXT labels, used by GetParameterID()
+   static const ParameterIndex PARAMETER_INDEX;
+
+   virtual void         UpdateState();
+
+   virtual void         SetEphemSpan(Integer whichOne = 0);
+
+   void                 OpenEphemeris();
+   void                 LoadState(const wxString &action);
+};
+
+#endif /* BinaryEphemPropagator_hpp */
@@ -60,6 +60,10 @@ BulirschStoer::PARAMETER_TEXT[BulirschStoerParamCount - IntegratorParamCount] =
    wxT("MinimumTolerance"),
 };
 
+const ParameterIndex
+BulirschStoer::PARAMETER_INDEX(PARAMETER_TEXT,
+      MINIMUM_REDUCTION, BulirschStoerParamCount);
+
 const Gmat::ParameterType
 BulirschStoer::PARAMETER_TYPE[BulirschStoerParamCount - IntegratorParamCount] =
 {
@@ -1161,13 +1165,11 @@ wxString BulirschStoer::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer BulirschStoer::GetParameterID(const wxString &str) const
 {
-    for (Integer i = MINIMUM_REDUCTION; i < BulirschStoerParamCount; i++)
-    {
-        if (str == PARAMETER_TEXT[i - IntegratorParamCount])
-            return i;
-    }
+   Integer id = PARAMETER_INDEX.Find(str);
+   if (id != -1)
+      return id;
 
-    return Integrator::GetParameterID(str);
+   return Integrator::GetParameterID(str);
 }
 
 //------------------------------------------------------------------------------
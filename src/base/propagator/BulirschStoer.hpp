@@ -101,6 +101,8 @@ protected:
       BulirschStoerParamCount  /// Count of the parameters for this class
    };
    static const wxString PARAMETER_TEXT[BulirschStoerParamCount - IntegratorParamCount];
+   /// Hash index of the PARAMETER_TEXT labels, used by GetParameterID()
+   static const ParameterIndex PARAMETER_INDEX;
    static const Gmat::ParameterType PARAMETER_TYPE[BulirschStoerParamCount - IntegratorParamCount];
 
 private:
@@ -43,6 +43,10 @@ EphemerisPropagator::PARAMETER_TEXT[EphemerisPropagatorParamCount - PropagatorPa
       wxT("StartEpoch")      // EPHEM_START_EPOCH
 };
 
+const ParameterIndex
+EphemerisPropagator::PARAMETER_INDEX(PARAMETER_TEXT,
+      PropagatorParamCount, EphemerisPropagatorParamCount);
+
 /// EphemerisPropagator parameter types
 const Gmat::ParameterType
 EphemerisPropagator::PARAMETER_TYPE[EphemerisPropagatorParamCount - PropagatorParamCount] =
@@ -202,12 +206,9 @@ EphemerisPropagator& EphemerisPropagator::operator=(
 //------------------------------------------------------------------------------
 Integer EphemerisPropagator::GetParameterID(const wxString &str) const
 {
-   for (Integer i = PropagatorParamCount;
-         i < EphemerisPropagatorParamCount; ++i)
-   {
-      if (str == PARAMETER_TEXT[i - PropagatorParamCount])
-         return i;
-   }
+   Integer id = PARAMETER_INDEX.Find(str);
+   if (id != -1)
+      return id;
 
    return Propagator::GetParameterID(str);
 }
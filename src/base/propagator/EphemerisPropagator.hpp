@@ -204,6 +204,8 @@ protected:
    /// EphemerisPropagator parameter labels
    static const wxString
          PARAMETER_TEXT[EphemerisPropagatorParamCount - PropagatorParamCount];
+   /// Hash index of the PARAMETER_TEXT labels, used by GetParameterID()
+   static const ParameterIndex PARAMETER_INDEX;
 
    GmatEpoch ConvertToRealEpoch(const wxString &theEpoch,
          const wxString &theFormat);
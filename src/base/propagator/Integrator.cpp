@@ -94,6 +94,10 @@ Integrator::PARAMETER_TEXT[IntegratorParamCount - PropagatorParamCount] =
     wxT("StopIfAccuracyIsViolated"),
 };
 
+const ParameterIndex
+Integrator::PARAMETER_INDEX(PARAMETER_TEXT,
+      PropagatorParamCount, IntegratorParamCount);
+
 const Gmat::ParameterType
 Integrator::PARAMETER_TYPE[IntegratorParamCount - PropagatorParamCount] =
 {
@@ -252,12 +256,10 @@ wxString Integrator::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer Integrator::GetParameterID(const wxString &str) const
 {
-    for (int i = PropagatorParamCount; i < IntegratorParamCount; i++)
-    {
-        if (str == PARAMETER_TEXT[i - PropagatorParamCount])
-            return i;
-    }
-    return Propagator::GetParameterID(str);
+   Integer id = PARAMETER_INDEX.Find(str);
+   if (id != -1)
+      return id;
+   return Propagator::GetParameterID(str);
 }
 
 //------------------------------------------------------------------------------
@@ -379,7 +381,11 @@ Real Integrator::SetRealParameter(const Integer id, const Real value)
    {
    case ACCURACY:
       if (value > 0.0)
+      {
          tolerance = value;
+         if (physicalModel)
+            physicalModel->SetIntegrationAccuracy(tolerance);
+      }
       else
       {
          wxString buffer;
@@ -608,7 +614,8 @@ bool Integrator::TakeAction(const wxString &action,
  * Connects the propagation system to the physical model 
  *
  * This method calls Propagator::SetPhysicalModel(), and then sets the error 
- * threshold for the physical model to the local value.
+ * threshold and integration accuracy for the physical model to the local
+ * values.
  *
  * @param pPhyscialModel Pointer to the physical model
  */
@@ -617,7 +624,10 @@ void Integrator::SetPhysicalModel(PhysicalModel *pPhysicalModel)
 {
     Propagator::SetPhysicalModel(pPhysicalModel);
     if (physicalModel != NULL) 
+    {
         physicalModel->SetErrorThreshold(errorThreshold);
+        physicalModel->SetIntegrationAccuracy(tolerance);
+    }
         else
            throw PropagatorException(
                  wxT("Integrator::SetPhysicalModel -- PhyscialModel is NULL."));
@@ -231,6 +231,8 @@ protected:
     // Start with the parameter IDs and associates strings
     static const wxString 
                       PARAMETER_TEXT[IntegratorParamCount - PropagatorParamCount];
+    /// Hash index of the PARAMETER_TEXT labels, used by GetParameterID()
+    static const ParameterIndex PARAMETER_INDEX;
     static const Gmat::ParameterType 
                       PARAMETER_TYPE[IntegratorParamCount - PropagatorParamCount];
         
@@ -0,0 +1,929 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                           OrbitAveragedIntegrator
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool.
+//
+// Copyright (c) 2002-2011 United States Government as represented by the
+// Administrator of The National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Created: 2026.10.18
+//
+/**
+ * Implementation of the orbit averaged Prince-Dormand integrator used for fast
+ * low-thrust trajectory propagation.
+ */
+//------------------------------------------------------------------------------
+
+#include "OrbitAveragedIntegrator.hpp"
+#include "PhysicalModel.hpp"
+#include "CelestialBody.hpp"
+#include "PropagatorException.hpp"
+#include "BaseException.hpp"
+#include "MessageInterface.hpp"
+#include "GmatConstants.hpp"
+#include "Rvector6.hpp"
+#include <math.h>
+
+//#define DEBUG_ORBIT_AVERAGING
+
+//---------------------------------
+// static data
+//---------------------------------
+const wxString
+OrbitAveragedIntegrator::PARAMETER_TEXT[OrbitAveragedParamCount -
+                                        IntegratorParamCount] =
+{
+   wxT("Averaging"),
+   wxT("QuadraturePoints"),
+};
+
+const ParameterIndex
+OrbitAveragedIntegrator::PARAMETER_INDEX(PARAMETER_TEXT,
+      AVERAGING, OrbitAveragedParamCount);
+
+const Gmat::ParameterType
+OrbitAveragedIntegrator::PARAMETER_TYPE[OrbitAveragedParamCount -
+                                        IntegratorParamCount] =
+{
+   Gmat::BOOLEAN_TYPE,
+   Gmat::INTEGER_TYPE,
+};
+
+//---------------------------------
+// public
+//---------------------------------
+
+//------------------------------------------------------------------------------
+// OrbitAveragedIntegrator(const wxString &nomme)
+//------------------------------------------------------------------------------
+/**
+ * The constructor
+ *
+ * @param nomme Name of the integrator
+ */
+//------------------------------------------------------------------------------
+OrbitAveragedIntegrator::OrbitAveragedIntegrator(const wxString &nomme) :
+   PrinceDormand78      (nomme),
+   averaging            (false),
+   averagedStep         (false),
+   quadraturePoints     (16),
+   mu                   (0.0),
+   orbitStart           (0),
+   orbitCount           (0),
+   elementDimension     (0),
+   elementState         (NULL),
+   elementStage         (NULL),
+   elementCandidate     (NULL),
+   averagedRates        (NULL),
+   sampleState          (NULL),
+   shortPeriod          (NULL)
+{
+   typeName       = wxT("OrbitAveraged");
+   typeSource     = wxT("OrbitAveraged");
+   parameterCount = OrbitAveragedParamCount;
+}
+
+//------------------------------------------------------------------------------
+// ~OrbitAveragedIntegrator()
+//------------------------------------------------------------------------------
+/**
+ * The destructor
+ */
+//------------------------------------------------------------------------------
+OrbitAveragedIntegrator::~OrbitAveragedIntegrator()
+{
+   ClearElementArrays();
+}
+
+//------------------------------------------------------------------------------
+// OrbitAveragedIntegrator(const OrbitAveragedIntegrator& oa)
+//------------------------------------------------------------------------------
+/**
+ * The copy constructor
+ *
+ * The work arrays are not copied; they are built the first time the copy
+ * takes an averaged step.
+ */
+//------------------------------------------------------------------------------
+OrbitAveragedIntegrator::OrbitAveragedIntegrator(
+      const OrbitAveragedIntegrator& oa) :
+   PrinceDormand78      (oa),
+   averaging            (oa.averaging),
+   averagedStep         (false),
+   quadraturePoints     (oa.quadraturePoints),
+   mu                   (0.0),
+   orbitStart           (0),
+   orbitCount           (0),
+   elementDimension     (0),
+   elementState         (NULL),
+   elementStage         (NULL),
+   elementCandidate     (NULL),
+   averagedRates        (NULL),
+   sampleState          (NULL),
+   shortPeriod          (NULL)
+{
+   parameterCount = OrbitAveragedParamCount;
+}
+
+//------------------------------------------------------------------------------
+// OrbitAveragedIntegrator& operator=(const OrbitAveragedIntegrator& oa)
+//------------------------------------------------------------------------------
+/**
+ * The assignment operator
+ */
+//------------------------------------------------------------------------------
+OrbitAveragedIntegrator& OrbitAveragedIntegrator::operator=(
+      const OrbitAveragedIntegrator& oa)
+{
+   if (this == &oa)
+      return *this;
+
+   PrinceDormand78::operator=(oa);
+
+   averaging        = oa.averaging;
+   averagedStep     = false;
+   quadraturePoints = oa.quadraturePoints;
+   mu               = 0.0;
+   orbitStart       = 0;
+   orbitCount       = 0;
+
+   ClearElementArrays();
+
+   return *this;
+}
+
+//------------------------------------------------------------------------------
+// Propagator* Clone() const
+//------------------------------------------------------------------------------
+/**
+ * Method used to create a copy of the object
+ */
+//------------------------------------------------------------------------------
+Propagator* OrbitAveragedIntegrator::Clone() const
+{
+   return new OrbitAveragedIntegrator(*this);
+}
+
+//------------------------------------------------------------------------------
+// bool Initialize()
+//------------------------------------------------------------------------------
+/**
+ * Initializes the Runge-Kutta data and discards the element work arrays
+ *
+ * @return true on success
+ */
+//------------------------------------------------------------------------------
+bool OrbitAveragedIntegrator::Initialize()
+{
+   ClearElementArrays();
+   return PrinceDormand78::Initialize();
+}
+
+//------------------------------------------------------------------------------
+// bool RawStep()
+//------------------------------------------------------------------------------
+/**
+ * Takes a raw step without error control
+ *
+ * With averaging on, the osculating state is converted to mean equinoctial
+ * elements, the stages are evaluated using the orbit averaged rates, and the
+ * short-period terms are restored to the candidate elements before they are
+ * converted back to Cartesian coordinates for the candidate state.  With
+ * averaging off, or when the state transition matrix is propagated, the
+ * Prince-Dormand step is taken on the Cartesian state.
+ *
+ * @return true if the step was taken
+ */
+//------------------------------------------------------------------------------
+bool OrbitAveragedIntegrator::RawStep()
+{
+   averagedStep = false;
+
+   if (!averaging)
+      return PrinceDormand78::RawStep();
+
+   if (!PrepareAveraging())
+      return false;
+
+   if (physicalModel->GetStmCount() > 0)
+      return PrinceDormand78::RawStep();
+
+   averagedStep = true;
+   Integer i, j, k;
+
+   if (inState != physicalModel->GetState())
+      memcpy(inState, physicalModel->GetState(), sizeof(Real) * dimension);
+
+   memcpy(elementState, inState, sizeof(Real) * dimension);
+   for (i = 0; i < orbitCount; ++i)
+      ToElements(&inState[orbitStart + i * 6],
+                 &elementState[orbitStart + i * 6]);
+
+   // Remove the short-period terms to get the mean elements
+   if (!ShortPeriodTerms(elementState, 0.0))
+      return false;
+   for (k = orbitStart; k < orbitStart + 6 * orbitCount; ++k)
+      elementState[k] -= shortPeriod[k];
+
+   // Calculate the stages
+   for (i = 0; i < stages; ++i)
+   {
+      memcpy(elementStage, elementState, sizeof(Real) * dimension);
+      for (j = 0; j < i; ++j)
+         for (k = 0; k < dimension; ++k)
+            elementStage[k] += bij[i][j] * ki[j][k];
+
+      if (!AveragedRates(elementStage, stepSize * ai[i]))
+         return false;
+
+      for (j = 0; j < dimension; ++j)
+         ki[i][j] = stepSize * averagedRates[j];
+   }
+
+   // Accumulate the stages for the step
+   memcpy(elementCandidate, elementState, sizeof(Real) * dimension);
+   for (i = 0; i < stages; ++i)
+      for (j = 0; j < dimension; ++j)
+         elementCandidate[j] += cj[i] * ki[i][j];
+
+   // Restore the short-period terms for the osculating candidate state
+   if (!ShortPeriodTerms(elementCandidate, stepSize))
+      return false;
+
+   Real osculating[6];
+   memcpy(candidateState, elementCandidate, sizeof(Real) * dimension);
+   for (i = 0; i < orbitCount; ++i)
+   {
+      for (k = 0; k < 6; ++k)
+         osculating[k] = elementCandidate[orbitStart + i * 6 + k] +
+               shortPeriod[orbitStart + i * 6 + k];
+      ToCartesian(osculating, &candidateState[orbitStart + i * 6]);
+   }
+
+   #ifdef DEBUG_ORBIT_AVERAGING
+      MessageInterface::ShowMessage(wxT("Averaged step of %.3lf sec: sma ")
+            wxT("%.9lf -> %.9lf km\n"), stepSize, elementState[orbitStart],
+            elementCandidate[orbitStart]);
+   #endif
+
+   return true;
+}
+
+//------------------------------------------------------------------------------
+// wxString GetParameterText(const Integer id) const
+//------------------------------------------------------------------------------
+/**
+ * @see GmatBase
+ */
+//------------------------------------------------------------------------------
+wxString OrbitAveragedIntegrator::GetParameterText(const Integer id) const
+{
+   if (id >= AVERAGING && id < OrbitAveragedParamCount)
+      return PARAMETER_TEXT[id - IntegratorParamCount];
+
+   return PrinceDormand78::GetParameterText(id);
+}
+
+//------------------------------------------------------------------------------
+// Integer GetParameterID(const wxString &str) const
+//------------------------------------------------------------------------------
+/**
+ * @see GmatBase
+ */
+//------------------------------------------------------------------------------
+Integer OrbitAveragedIntegrator::GetParameterID(const wxString &str) const
+{
+   Integer id = PARAMETER_INDEX.Find(str);
+   if (id != -1)
+      return id;
+
+   return PrinceDormand78::GetParameterID(str);
+}
+
+//------------------------------------------------------------------------------
+// Gmat::ParameterType GetParameterType(const Integer id) const
+//------------------------------------------------------------------------------
+/**
+ * @see GmatBase
+ */
+//------------------------------------------------------------------------------
+Gmat::ParameterType OrbitAveragedIntegrator::GetParameterType(
+      const Integer id) const
+{
+   if (id >= AVERAGING && id < OrbitAveragedParamCount)
+      return PARAMETER_TYPE[id - IntegratorParamCount];
+
+   return PrinceDormand78::GetParameterType(id);
+}
+
+//------------------------------------------------------------------------------
+// wxString GetParameterTypeString(const Integer id) const
+//------------------------------------------------------------------------------
+/**
+ * @see GmatBase
+ */
+//------------------------------------------------------------------------------
+wxString OrbitAveragedIntegrator::GetParameterTypeString(
+      const Integer id) const
+{
+   if (id >= AVERAGING && id < OrbitAveragedParamCount)
+      return GmatBase::PARAM_TYPE_STRING[GetParameterType(id)];
+
+   return PrinceDormand78::GetParameterTypeString(id);
+}
+
+//------------------------------------------------------------------------------
+// Integer GetIntegerParameter(const Integer id) const
+//------------------------------------------------------------------------------
+/**
+ * @see GmatBase
+ */
+//------------------------------------------------------------------------------
+Integer OrbitAveragedIntegrator::GetIntegerParameter(const Integer id) const
+{
+   if (id == QUADRATURE_POINTS)
+      return quadraturePoints;
+
+   return PrinceDormand78::GetIntegerParameter(id);
+}
+
+//------------------------------------------------------------------------------
+// Integer GetIntegerParameter(const wxString &label) const
+//------------------------------------------------------------------------------
+/**
+ * @see GmatBase
+ */
+//------------------------------------------------------------------------------
+Integer OrbitAveragedIntegrator::GetIntegerParameter(
+      const wxString &label) const
+{
+   return GetIntegerParameter(GetParameterID(label));
+}
+
+//------------------------------------------------------------------------------
+// Integer SetIntegerParameter(const Integer id, const Integer value)
+//------------------------------------------------------------------------------
+/**
+ * @see GmatBase
+ */
+//------------------------------------------------------------------------------
+Integer OrbitAveragedIntegrator::SetIntegerParameter(const Integer id,
+                                                     const Integer value)
+{
+   if (id == QUADRATURE_POINTS)
+   {
+      if (value < 4)
+      {
+         wxString buffer;
+         buffer << value;
+         throw PropagatorException(
+            wxT("The value of \"") + buffer + wxT("\" for field ")
+            wxT("\"QuadraturePoints\" on object \"") + instanceName +
+            wxT("\" is not an allowed value.\n")
+            wxT("The allowed values are: [ Integer >= 4 ]. "));
+      }
+      quadraturePoints = value;
+      return quadraturePoints;
+   }
+
+   return PrinceDormand78::SetIntegerParameter(id, value);
+}
+
+//------------------------------------------------------------------------------
+// Integer SetIntegerParameter(const wxString &label, const Integer value)
+//------------------------------------------------------------------------------
+/**
+ * @see GmatBase
+ */
+//------------------------------------------------------------------------------
+Integer OrbitAveragedIntegrator::SetIntegerParameter(const wxString &label,
+                                                     const Integer value)
+{
+   return SetIntegerParameter(GetParameterID(label), value);
+}
+
+//------------------------------------------------------------------------------
+// bool GetBooleanParameter(const Integer id) const
+//------------------------------------------------------------------------------
+/**
+ * @see GmatBase
+ */
+//------------------------------------------------------------------------------
+bool OrbitAveragedIntegrator::GetBooleanParameter(const Integer id) const
+{
+   if (id == AVERAGING)
+      return averaging;
+
+   return PrinceDormand78::GetBooleanParameter(id);
+}
+
+//------------------------------------------------------------------------------
+// bool SetBooleanParameter(const Integer id, const bool value)
+//------------------------------------------------------------------------------
+/**
+ * Sets the value for a boolean parameter.
+ *
+ * Averaging is off by default.  Turning it on switches the integrator to
+ * averaged propagation of the mean elements at the next step, starting from
+ * the mean elements of the current osculating state; turning it off resumes
+ * full fidelity propagation.
+ *
+ * @param id The integer ID for the parameter.
+ * @param value The new value.
+ *
+ * @return the boolean value for this parameter
+ */
+//------------------------------------------------------------------------------
+bool OrbitAveragedIntegrator::SetBooleanParameter(const Integer id,
+                                                  const bool value)
+{
+   if (id == AVERAGING)
+   {
+      averaging = value;
+      return averaging;
+   }
+
+   return PrinceDormand78::SetBooleanParameter(id, value);
+}
+
+//---------------------------------
+// protected
+//---------------------------------
+
+//------------------------------------------------------------------------------
+// Real EstimateError()
+//------------------------------------------------------------------------------
+/**
+ * Provides the largest error in the element state
+ *
+ * The semimajor axis error is relative; the errors in h, k, p, q and the mean
+ * longitude (in radians) are absolute.  Elements outside of the orbit states
+ * use relative error once they are larger than 1.
+ *
+ * @return The largest error found in the step
+ */
+//------------------------------------------------------------------------------
+Real OrbitAveragedIntegrator::EstimateError()
+{
+   if (!averagedStep)
+      return PrinceDormand78::EstimateError();
+
+   Integer i, j;
+   Real maxError = 0.0, err;
+   Integer orbitEnd = orbitStart + 6 * orbitCount;
+
+   for (i = 0; i < dimension; ++i)
+   {
+      errorEstimates[i] = 0.0;
+      for (j = 0; j < stages; ++j)
+         errorEstimates[i] += ee[j] * ki[j][i];
+
+      err = fabs(errorEstimates[i]);
+      if ((i >= orbitStart) && (i < orbitEnd))
+      {
+         if ((i - orbitStart) % 6 == 0)
+            err /= fabs(elementCandidate[i]);
+      }
+      else if (fabs(elementCandidate[i]) > 1.0)
+         err /= fabs(elementCandidate[i]);
+
+      if (err > maxError)
+         maxError = err;
+   }
+
+   return maxError;
+}
+
+//------------------------------------------------------------------------------
+// bool TruncateAtBoundary()
+//------------------------------------------------------------------------------
+/**
+ * Shortens the step to land on force discontinuities in full fidelity mode
+ *
+ * Averaged steps span many revolutions, so shadow boundaries are already
+ * folded into the averaged rates and do not truncate the step.
+ *
+ * @return true if the step size was changed and the step needs to be retaken
+ */
+//------------------------------------------------------------------------------
+bool OrbitAveragedIntegrator::TruncateAtBoundary()
+{
+   if (averagedStep)
+      return false;
+
+   return PrinceDormand78::TruncateAtBoundary();
+}
+
+//------------------------------------------------------------------------------
+// bool PrepareAveraging()
+//------------------------------------------------------------------------------
+/**
+ * Reads the state layout and central body from the physical model, and sizes
+ * the element work arrays
+ *
+ * @return true if the integrator is ready for an averaged step
+ */
+//------------------------------------------------------------------------------
+bool OrbitAveragedIntegrator::PrepareAveraging()
+{
+   if (physicalModel == NULL)
+      return false;
+
+   CelestialBody *origin = physicalModel->GetForceOrigin();
+   if (origin == NULL)
+      throw PropagatorException(typeSource + wxT(": Orbit averaging requires ")
+            wxT("a force model with a central body\n"));
+
+   mu = origin->GetGravitationalConstant();
+   converter.SetMu(mu);
+   orbitStart = physicalModel->GetCartesianStart();
+   orbitCount = physicalModel->GetCartesianCount();
+
+   if (elementDimension != dimension)
+   {
+      ClearElementArrays();
+      elementState     = new Real[dimension];
+      elementStage     = new Real[dimension];
+      elementCandidate = new Real[dimension];
+      averagedRates    = new Real[dimension];
+      sampleState      = new Real[dimension];
+      shortPeriod      = new Real[dimension];
+      elementDimension = dimension;
+   }
+
+   sampleRates.resize(quadraturePoints * 6 * orbitCount);
+
+   return true;
+}
+
+//------------------------------------------------------------------------------
+// void ClearElementArrays()
+//------------------------------------------------------------------------------
+/**
+ * Deallocates and NULLs the element work arrays
+ */
+//------------------------------------------------------------------------------
+void OrbitAveragedIntegrator::ClearElementArrays()
+{
+   if (elementState != NULL)
+      delete [] elementState;
+   if (elementStage != NULL)
+      delete [] elementStage;
+   if (elementCandidate != NULL)
+      delete [] elementCandidate;
+   if (averagedRates != NULL)
+      delete [] averagedRates;
+   if (sampleState != NULL)
+      delete [] sampleState;
+   if (shortPeriod != NULL)
+      delete [] shortPeriod;
+
+   elementState = elementStage = elementCandidate = averagedRates =
+         sampleState = shortPeriod = NULL;
+   elementDimension = 0;
+}
+
+//------------------------------------------------------------------------------
+// void ToElements(const Real *cartesian, Real *elements)
+//------------------------------------------------------------------------------
+/**
+ * Converts one Cartesian state to equinoctial elements
+ *
+ * @param cartesian The 6-element Cartesian state
+ * @param elements  The elements (sma, h, k, p, q, mean longitude in radians)
+ */
+//------------------------------------------------------------------------------
+void OrbitAveragedIntegrator::ToElements(const Real *cartesian,
+                                         Real *elements)
+{
+   Rvector6 equinoctial;
+
+   try
+   {
+      equinoctial = converter.Convert(Rvector6(cartesian), wxT("Cartesian"),
+            wxT("Equinoctial"));
+   }
+   catch (BaseException &be)
+   {
+      throw PropagatorException(typeSource + wxT(": Orbit averaging requires ")
+            wxT("closed orbits.  ") + be.GetFullMessage());
+   }
+
+   for (Integer i = 0; i < 5; ++i)
+      elements[i] = equinoctial[i];
+   elements[5] = equinoctial[5] * GmatMathConstants::RAD_PER_DEG;
+}
+
+//------------------------------------------------------------------------------
+// void ToCartesian(const Real *elements, Real *cartesian)
+//------------------------------------------------------------------------------
+/**
+ * Converts one set of equinoctial elements to a Cartesian state
+ *
+ * @param elements  The elements (sma, h, k, p, q, mean longitude in radians)
+ * @param cartesian The 6-element Cartesian state
+ */
+//------------------------------------------------------------------------------
+void OrbitAveragedIntegrator::ToCartesian(const Real *elements,
+                                          Real *cartesian)
+{
+   Rvector6 equinoctial(elements), state;
+   equinoctial[5] = elements[5] * GmatMathConstants::DEG_PER_RAD;
+
+   try
+   {
+      state = converter.Convert(equinoctial, wxT("Equinoctial"),
+            wxT("Cartesian"));
+   }
+   catch (BaseException &be)
+   {
+      throw PropagatorException(typeSource + wxT(": The averaged elements do ")
+            wxT("not describe a closed orbit.  ") + be.GetFullMessage());
+   }
+
+   for (Integer i = 0; i < 6; ++i)
+      cartesian[i] = state[i];
+}
+
+//------------------------------------------------------------------------------
+// bool AveragedRates(const Real *elements, Real dt)
+//------------------------------------------------------------------------------
+/**
+ * Fills averagedRates with the orbit averaged element rates
+ *
+ * Each orbit is sampled at quadraturePoints points spaced evenly in mean
+ * longitude, so the trapezoid sum is a time average over one revolution and
+ * converges rapidly for the smooth, periodic integrand.  The perturbing
+ * acceleration at each point is the force model acceleration less the
+ * central body point mass term.  The rates at each point are kept in
+ * sampleRates for the short-period terms.
+ *
+ * Elements outside of the orbit states are not averaged; they take the
+ * derivatives at the first point, the mean longitude of the element state.
+ *
+ * @param elements The element state
+ * @param dt       Time offset, in seconds, of the forces from the step epoch
+ *
+ * @return true if the force model derivatives were evaluated
+ */
+//------------------------------------------------------------------------------
+bool OrbitAveragedIntegrator::AveragedRates(const Real *elements, Real dt)
+{
+   Integer i, j, n, i6;
+   Integer orbitEnd = orbitStart + 6 * orbitCount;
+   Real sample[6], accel[3], rates[6], r, r3;
+
+   for (n = 0; n < dimension; ++n)
+      averagedRates[n] = 0.0;
+
+   for (j = 0; j < quadraturePoints; ++j)
+   {
+      memcpy(sampleState, elements, sizeof(Real) * dimension);
+      for (i = 0; i < orbitCount; ++i)
+      {
+         i6 = orbitStart + i * 6;
+         memcpy(sample, &elements[i6], sizeof(Real) * 6);
+         sample[5] += GmatMathConstants::TWO_PI * j / quadraturePoints;
+         ToCartesian(sample, &sampleState[i6]);
+      }
+
+      if (!physicalModel->GetDerivatives(sampleState, dt))
+         return false;
+
+      for (i = 0; i < orbitCount; ++i)
+      {
+         i6 = orbitStart + i * 6;
+         r = sqrt(sampleState[i6]   * sampleState[i6] +
+                  sampleState[i6+1] * sampleState[i6+1] +
+                  sampleState[i6+2] * sampleState[i6+2]);
+         r3 = r * r * r;
+         for (n = 0; n < 3; ++n)
+            accel[n] = ddt[i6+3+n] + mu * sampleState[i6+n] / r3;
+
+         PerturbationRates(&sampleState[i6], accel, rates);
+         for (n = 0; n < 6; ++n)
+         {
+            averagedRates[i6+n] += rates[n];
+            sampleRates[(i * quadraturePoints + j) * 6 + n] = rates[n];
+         }
+      }
+
+      if (j == 0)
+      {
+         for (n = 0; n < orbitStart; ++n)
+            averagedRates[n] = ddt[n];
+         for (n = orbitEnd; n < dimension; ++n)
+            averagedRates[n] = ddt[n];
+      }
+   }
+
+   for (n = orbitStart; n < orbitEnd; ++n)
+      averagedRates[n] /= quadraturePoints;
+
+   // The mean longitude also advances at the mean motion
+   for (i = 0; i < orbitCount; ++i)
+   {
+      i6 = orbitStart + i * 6;
+      if (elements[i6] <= 0.0)
+         throw PropagatorException(typeSource + wxT(": The averaged ")
+               wxT("semimajor axis is not positive\n"));
+      averagedRates[i6+5] += sqrt(mu / (elements[i6] * elements[i6] *
+            elements[i6]));
+   }
+
+   return true;
+}
+
+//------------------------------------------------------------------------------
+// bool ShortPeriodTerms(const Real *elements, Real dt)
+//------------------------------------------------------------------------------
+/**
+ * Fills shortPeriod with the first order short-period element terms
+ *
+ * The periodic part of the sampled rates is expanded in harmonics of the mean
+ * longitude and integrated over the revolution, giving the difference between
+ * the osculating and mean elements at the mean longitude of the element state.
+ * The mean longitude term also includes the integral of the mean motion change
+ * from the periodic semimajor axis.  The terms are found from the rates at the
+ * given elements, so they serve both directions of the conversion to first
+ * order.
+ *
+ * @param elements The element state
+ * @param dt       Time offset, in seconds, of the forces from the step epoch
+ *
+ * @return true if the force model derivatives were evaluated
+ */
+//------------------------------------------------------------------------------
+bool OrbitAveragedIntegrator::ShortPeriodTerms(const Real *elements, Real dt)
+{
+   if (!AveragedRates(elements, dt))
+      return false;
+
+   Integer i, j, m, n, i6;
+   Integer harmonics = (quadraturePoints - 1) / 2;
+   Real angle, cosSum, sinSum, meanMotion;
+
+   for (i = 0; i < orbitCount; ++i)
+   {
+      i6 = orbitStart + i * 6;
+      meanMotion = sqrt(mu / (elements[i6] * elements[i6] * elements[i6]));
+
+      for (n = 0; n < 6; ++n)
+         shortPeriod[i6+n] = 0.0;
+
+      for (m = 1; m <= harmonics; ++m)
+      {
+         for (n = 0; n < 6; ++n)
+         {
+            cosSum = sinSum = 0.0;
+            for (j = 0; j < quadraturePoints; ++j)
+            {
+               angle = GmatMathConstants::TWO_PI * m * j / quadraturePoints;
+               cosSum += sampleRates[(i * quadraturePoints + j) * 6 + n] *
+                     cos(angle);
+               sinSum += sampleRates[(i * quadraturePoints + j) * 6 + n] *
+                     sin(angle);
+            }
+            cosSum *= 2.0 / quadraturePoints;
+            sinSum *= 2.0 / quadraturePoints;
+
+            shortPeriod[i6+n] -= sinSum / (m * meanMotion);
+            if (n == 0)
+               shortPeriod[i6+5] += 1.5 * cosSum /
+                     (elements[i6] * meanMotion * m * m);
+         }
+      }
+   }
+
+   return true;
+}
+
+//------------------------------------------------------------------------------
+// void PerturbationRates(const Real *cartesian, const Real *accel,
+//                        Real *rates)
+//------------------------------------------------------------------------------
+/**
+ * Evaluates the Gauss variational equations for the equinoctial elements
+ *
+ * The perturbing acceleration changes the velocity but not the position, so
+ * the rates follow from the rates of the semimajor axis, eccentricity vector
+ * and orbit normal, projected onto the equinoctial frame.  The mean longitude
+ * rate is found through the eccentric longitude, which keeps the equations
+ * nonsingular for circular and equatorial orbits.  The Keplerian mean motion
+ * is not included in the mean longitude rate.
+ *
+ * @param cartesian The Cartesian state
+ * @param accel     The perturbing acceleration
+ * @param rates     The rates of sma, h, k, p, q and mean longitude
+ */
+//------------------------------------------------------------------------------
+void OrbitAveragedIntegrator::PerturbationRates(const Real *cartesian,
+      const Real *accel, Real *rates)
+{
+   const Real *r = cartesian, *v = &cartesian[3];
+   Integer n;
+
+   Real rMag = sqrt(r[0]*r[0] + r[1]*r[1] + r[2]*r[2]);
+   Real v2 = v[0]*v[0] + v[1]*v[1] + v[2]*v[2];
+   Real rv = r[0]*v[0] + r[1]*v[1] + r[2]*v[2];
+   Real va = v[0]*accel[0] + v[1]*accel[1] + v[2]*accel[2];
+   Real ra = r[0]*accel[0] + r[1]*accel[1] + r[2]*accel[2];
+
+   // Semimajor axis and eccentricity vector
+   Real sma    = 1.0 / (2.0 / rMag - v2 / mu);
+   Real smaDot = 2.0 * sma * sma * va / mu;
+   Real ecc[3], eccDot[3];
+   for (n = 0; n < 3; ++n)
+   {
+      ecc[n]    = ((v2 - mu / rMag) * r[n] - rv * v[n]) / mu;
+      eccDot[n] = (2.0 * va * r[n] - ra * v[n] - rv * accel[n]) / mu;
+   }
+
+   // Orbit normal, from the angular momentum and its rate
+   Real am[3], amDot[3], w[3], wDot[3];
+   am[0] = r[1]*v[2] - r[2]*v[1];
+   am[1] = r[2]*v[0] - r[0]*v[2];
+   am[2] = r[0]*v[1] - r[1]*v[0];
+   amDot[0] = r[1]*accel[2] - r[2]*accel[1];
+   amDot[1] = r[2]*accel[0] - r[0]*accel[2];
+   amDot[2] = r[0]*accel[1] - r[1]*accel[0];
+   Real amMag = sqrt(am[0]*am[0] + am[1]*am[1] + am[2]*am[2]);
+   Real proj = 0.0;
+   for (n = 0; n < 3; ++n)
+   {
+      w[n] = am[n] / amMag;
+      proj += w[n] * amDot[n];
+   }
+   for (n = 0; n < 3; ++n)
+      wDot[n] = (amDot[n] - w[n] * proj) / amMag;
+
+   Real den = 1.0 + w[2];
+   Real p = w[0] / den;
+   Real q = -w[1] / den;
+   Real pDot = (wDot[0] * den - w[0] * wDot[2]) / (den * den);
+   Real qDot = -(wDot[1] * den - w[1] * wDot[2]) / (den * den);
+
+   // Equinoctial frame and its rate
+   Real c    = 1.0 + p*p + q*q;
+   Real cDot = 2.0 * (p*pDot + q*qDot);
+   Real pqDot = pDot*q + p*qDot;
+   Real f[3], g[3], fDot[3], gDot[3];
+   f[0] = (1.0 - p*p + q*q) / c;
+   f[1] = 2.0 * p * q / c;
+   f[2] = -2.0 * p / c;
+   g[0] = 2.0 * p * q / c;
+   g[1] = (1.0 + p*p - q*q) / c;
+   g[2] = 2.0 * q / c;
+   fDot[0] = (-2.0*p*pDot + 2.0*q*qDot - f[0]*cDot) / c;
+   fDot[1] = (2.0*pqDot - f[1]*cDot) / c;
+   fDot[2] = (-2.0*pDot - f[2]*cDot) / c;
+   gDot[0] = (2.0*pqDot - g[0]*cDot) / c;
+   gDot[1] = (2.0*p*pDot - 2.0*q*qDot - g[1]*cDot) / c;
+   gDot[2] = (2.0*qDot - g[2]*cDot) / c;
+
+   Real h = 0.0, k = 0.0, hDot = 0.0, kDot = 0.0;
+   Real x = 0.0, y = 0.0, xDot = 0.0, yDot = 0.0;
+   for (n = 0; n < 3; ++n)
+   {
+      h    += ecc[n] * g[n];
+      k    += ecc[n] * f[n];
+      hDot += eccDot[n] * g[n] + ecc[n] * gDot[n];
+      kDot += eccDot[n] * f[n] + ecc[n] * fDot[n];
+      x    += r[n] * f[n];
+      y    += r[n] * g[n];
+      xDot += r[n] * fDot[n];
+      yDot += r[n] * gDot[n];
+   }
+
+   // Eccentric longitude rate, from the inverse of the in-plane position
+   Real b       = sqrt(1.0 - h*h - k*k);
+   Real beta    = 1.0 / (1.0 + b);
+   Real bDot    = -(h*hDot + k*kDot) / b;
+   Real betaDot = -beta * beta * bDot;
+   Real hkb     = h * k * beta;
+   Real hkbDot  = hDot*k*beta + h*kDot*beta + h*k*betaDot;
+   Real d       = sma * b;
+   Real dDot    = smaDot * b + sma * bDot;
+
+   Real numC    = (1.0 - k*k*beta) * x - hkb * y;
+   Real numS    = (1.0 - h*h*beta) * y - hkb * x;
+   Real numCDot = -(2.0*k*kDot*beta + k*k*betaDot) * x +
+                  (1.0 - k*k*beta) * xDot - hkbDot * y - hkb * yDot;
+   Real numSDot = -(2.0*h*hDot*beta + h*h*betaDot) * y +
+                  (1.0 - h*h*beta) * yDot - hkbDot * x - hkb * xDot;
+
+   Real cosF    = k + numC / d;
+   Real sinF    = h + numS / d;
+   Real cosFDot = kDot + (numCDot * d - numC * dDot) / (d * d);
+   Real sinFDot = hDot + (numSDot * d - numS * dDot) / (d * d);
+   Real fLonDot = cosF * sinFDot - sinF * cosFDot;
+
+   rates[0] = smaDot;
+   rates[1] = hDot;
+   rates[2] = kDot;
+   rates[3] = pDot;
+   rates[4] = qDot;
+   rates[5] = (1.0 - h*sinF - k*cosF) * fLonDot + cosF*hDot - sinF*kDot;
+}
@@ -0,0 +1,138 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                           OrbitAveragedIntegrator
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool.
+//
+// Copyright (c) 2002-2011 United States Government as represented by the
+// Administrator of The National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Created: 2026.10.18
+//
+/**
+ * Definition of the orbit averaged Prince-Dormand integrator used for fast
+ * low-thrust trajectory propagation.
+ */
+//------------------------------------------------------------------------------
+
+#ifndef OrbitAveragedIntegrator_hpp
+#define OrbitAveragedIntegrator_hpp
+
+#include "gmatdefs.hpp"
+#include "PrinceDormand78.hpp"
+#include "StateConverter.hpp"
+
+/**
+ * Prince-Dormand 7(8) integrator that propagates orbit averaged dynamics.
+ *
+ * Averaging is off by default, giving full fidelity Prince-Dormand 7(8)
+ * propagation of the Cartesian state.  When averaging is on, each
+ * spacecraft's Cartesian state is converted to equinoctial elements (sma, h,
+ * k, p, q, mean longitude) and the Gauss variational equations are integrated
+ * in place of the Cartesian equations of motion.  The element rates are
+ * averaged over one revolution by sampling the force model at
+ * QuadraturePoints points spaced evenly in mean longitude; whatever the
+ * ODEModel contains -- thrust, nonspherical gravity, drag -- is averaged this
+ * way.  The force epoch is held fixed across each revolution.
+ *
+ * The averaged equations move mean elements, so the osculating state is
+ * converted to mean elements at the start of each step and back at the end.
+ * The short-period terms of the conversion are first order: they are the
+ * integrals over mean longitude of the periodic part of the sampled rates,
+ * including the mean longitude drift from the periodic semimajor axis.
+ * Second order terms, like the coupling of J2 with itself, are not modeled,
+ * so the reported state carries errors of that order.
+ *
+ * Other propagated elements, like the mass flow from a finite burn, are not
+ * averaged; they use their derivatives at the mean longitude of the step.
+ * The state transition matrix has no averaged form, so steps that propagate
+ * it are taken at full fidelity.
+ */
+class GMAT_API OrbitAveragedIntegrator : public PrinceDormand78
+{
+public:
+   OrbitAveragedIntegrator(const wxString &nomme = wxT(""));
+   virtual ~OrbitAveragedIntegrator();
+
+   OrbitAveragedIntegrator(const OrbitAveragedIntegrator&);
+   OrbitAveragedIntegrator& operator=(const OrbitAveragedIntegrator&);
+
+   virtual Propagator* Clone() const;
+
+   virtual bool Initialize();
+   virtual bool RawStep();
+
+   // Parameter accessor methods -- overridden from GmatBase
+   virtual wxString            GetParameterText(const Integer id) const;
+   virtual Integer             GetParameterID(const wxString &str) const;
+   virtual Gmat::ParameterType GetParameterType(const Integer id) const;
+   virtual wxString            GetParameterTypeString(const Integer id) const;
+   virtual Integer GetIntegerParameter(const Integer id) const;
+   virtual Integer GetIntegerParameter(const wxString &label) const;
+   virtual Integer SetIntegerParameter(const Integer id, const Integer value);
+   virtual Integer SetIntegerParameter(const wxString &label,
+                                       const Integer value);
+   virtual bool    GetBooleanParameter(const Integer id) const;
+   virtual bool    SetBooleanParameter(const Integer id, const bool value);
+
+protected:
+   enum
+   {
+      AVERAGING = IntegratorParamCount,
+      QUADRATURE_POINTS,
+      OrbitAveragedParamCount  /// Count of the parameters for this class
+   };
+   static const wxString
+         PARAMETER_TEXT[OrbitAveragedParamCount - IntegratorParamCount];
+   /// Hash index of the PARAMETER_TEXT labels, used by GetParameterID()
+   static const ParameterIndex PARAMETER_INDEX;
+   static const Gmat::ParameterType
+         PARAMETER_TYPE[OrbitAveragedParamCount - IntegratorParamCount];
+
+   /// Flag that turns the averaged dynamics on; false (the default) gives
+   /// full fidelity
+   bool           averaging;
+   /// Flag indicating that the current step uses the averaged dynamics
+   bool           averagedStep;
+   /// Number of mean longitude samples used to average the rates
+   Integer        quadraturePoints;
+   /// Gravitational parameter of the force origin
+   Real           mu;
+   /// Index of the first Cartesian state in the propagation vector
+   Integer        orbitStart;
+   /// Number of 6-element orbit states in the propagation vector
+   Integer        orbitCount;
+   /// Size of the element work arrays
+   Integer        elementDimension;
+   /// Element state at the start of the step
+   Real           *elementState;
+   /// Element state for the current stage
+   Real           *elementStage;
+   /// Candidate element state at the end of the step
+   Real           *elementCandidate;
+   /// Averaged element rates for the current stage
+   Real           *averagedRates;
+   /// Cartesian state at a quadrature point
+   Real           *sampleState;
+   /// Short-period element terms; osculating minus mean elements
+   Real           *shortPeriod;
+   /// Element rates at each quadrature point, 6 per point for each orbit
+   RealArray      sampleRates;
+   /// Converter used for the equinoctial element transformations
+   StateConverter converter;
+
+   virtual Real   EstimateError();
+   virtual bool   TruncateAtBoundary();
+
+   bool           PrepareAveraging();
+   void           ClearElementArrays();
+   void           ToElements(const Real *cartesian, Real *elements);
+   void           ToCartesian(const Real *elements, Real *cartesian);
+   bool           AveragedRates(const Real *elements, Real dt);
+   bool           ShortPeriodTerms(const Real *elements, Real dt);
+   void           PerturbationRates(const Real *cartesian, const Real *accel,
+                                    Real *rates);
+};
+
+#endif // OrbitAveragedIntegrator_hpp
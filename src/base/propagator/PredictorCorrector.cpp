@@ -64,6 +64,10 @@ PredictorCorrector::PARAMETER_TEXT[PredictorCorrectorParamCount - IntegratorPara
    wxT("InvOrder")
 };
 
+const ParameterIndex
+PredictorCorrector::PARAMETER_INDEX(PARAMETER_TEXT,
+      STEP_COUNT, PredictorCorrectorParamCount);
+
 const Gmat::ParameterType
 PredictorCorrector::PARAMETER_TYPE[PredictorCorrectorParamCount - IntegratorParamCount] =
 {
@@ -702,13 +706,11 @@ wxString PredictorCorrector::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer PredictorCorrector::GetParameterID(const wxString &str) const
 {
-    for (Integer i = STEP_COUNT; i < PredictorCorrectorParamCount; i++)
-    {
-        if (str == PARAMETER_TEXT[i - IntegratorParamCount])
-            return i;
-    }
+   Integer id = PARAMETER_INDEX.Find(str);
+   if (id != -1)
+      return id;
 
-    return Integrator::GetParameterID(str);
+   return Integrator::GetParameterID(str);
 }
 
 //------------------------------------------------------------------------------
@@ -224,6 +224,8 @@ private:
     
    static const wxString 
             PARAMETER_TEXT[PredictorCorrectorParamCount - IntegratorParamCount];
+   /// Hash index of the PARAMETER_TEXT labels, used by GetParameterID()
+   static const ParameterIndex PARAMETER_INDEX;
    static const Gmat::ParameterType 
             PARAMETER_TYPE[PredictorCorrectorParamCount - IntegratorParamCount];
 };
@@ -87,6 +87,10 @@ PropSetup::PARAMETER_TEXT[PropSetupParamCount - GmatBaseParamCount] =
    wxT("MinimumTolerance")
 };
 
+const ParameterIndex
+PropSetup::PARAMETER_INDEX(PARAMETER_TEXT,
+      GmatBaseParamCount, PropSetupParamCount);
+
 
 const Gmat::ParameterType
 PropSetup::PARAMETER_TYPE[PropSetupParamCount - GmatBaseParamCount] =
@@ -791,11 +795,9 @@ wxString PropSetup::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer PropSetup::GetParameterID(const wxString &str) const
 {
-   for (int i=GmatBaseParamCount; i<PropSetupParamCount; i++)
-   {
-      if (str == PropSetup::PARAMETER_TEXT[i - GmatBaseParamCount])
-         return i;
-   }
+   Integer id = PARAMETER_INDEX.Find(str);
+   if (id != -1)
+      return id;
    
    return GmatBase::GetParameterID(str);
 }
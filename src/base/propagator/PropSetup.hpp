@@ -222,6 +222,8 @@ private:
    
    static const wxString
       PARAMETER_TEXT[PropSetupParamCount - GmatBaseParamCount];
+   /// Hash index of the PARAMETER_TEXT labels, used by GetParameterID()
+   static const ParameterIndex PARAMETER_INDEX;
    static const Gmat::ParameterType
       PARAMETER_TYPE[PropSetupParamCount - GmatBaseParamCount];
    
@@ -91,6 +91,10 @@ Propagator::PARAMETER_TEXT[PropagatorParamCount - GmatBaseParamCount] =
     wxT("AlwaysUpdateStepsize")
 };
 
+const ParameterIndex
+Propagator::PARAMETER_INDEX(PARAMETER_TEXT,
+      GmatBaseParamCount, PropagatorParamCount);
+
 const Gmat::ParameterType
 Propagator::PARAMETER_TYPE[PropagatorParamCount - GmatBaseParamCount] =
 {
@@ -267,10 +271,9 @@ wxString Propagator::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer Propagator::GetParameterID(const wxString &str) const
 {
-   for (Integer i = GmatBaseParamCount; i < PropagatorParamCount; ++i)
-      if (str == PARAMETER_TEXT[i - GmatBaseParamCount])
-         return i;
-        
+   Integer id = PARAMETER_INDEX.Find(str);
+   if (id != -1)
+      return id;
    return GmatBase::GetParameterID(str);
 }
 
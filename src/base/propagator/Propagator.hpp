@@ -198,6 +198,8 @@ protected:
    // Start with the parameter IDs and associated strings
    static const wxString
       PARAMETER_TEXT[PropagatorParamCount - GmatBaseParamCount];
+   /// Hash index of the PARAMETER_TEXT labels, used by GetParameterID()
+   static const ParameterIndex PARAMETER_INDEX;
    static const Gmat::ParameterType
       PARAMETER_TYPE[PropagatorParamCount - GmatBaseParamCount];
 
@@ -295,14 +295,20 @@ bool RungeKutta::Step()
     if (fabs(stepSize) > maximumStep)
         stepSize = ((stepSize > 0.0) ? maximumStep : -maximumStep);
 
-    bool goodStepTaken = false;
-    Real maxerror;
+    bool goodStepTaken = false, landing = false;
+    Real maxerror, boundlessStep = stepSize;
 
     do
     {
         if (!RawStep())
            return false;
 
+        if (!landing && TruncateAtBoundary())
+        {
+           landing = true;
+           continue;
+        }
+
         maxerror = EstimateError();
         stepTaken = stepSize;
         if (maxerror!= 0.0)
@@ -325,6 +331,11 @@ bool RungeKutta::Step()
         }
     } while (!goodStepTaken);
 
+    // A step shortened to land on a boundary says nothing about the step size
+    // the error control can sustain past it
+    if (landing && (fabs(stepSize) < fabs(boundlessStep)))
+       stepSize = boundlessStep;
+
     physicalModel->IncrementTime(stepTaken);
     return true;
 }
@@ -573,6 +584,43 @@ bool RungeKutta::AdaptStep(Real maxerror)
     return true;
 }
 
+//------------------------------------------------------------------------------
+// bool RungeKutta::TruncateAtBoundary()
+//------------------------------------------------------------------------------
+/**
+ * Shortens the current step so it ends on the first force discontinuity
+ *
+ * Forces like solar radiation pressure change abruptly at predictable places
+ * (shadow entry and exit).  Rather than letting the error control reject
+ * steps until one happens to end near the discontinuity, the candidate step
+ * is checked for a boundary crossing and, if one is found, the step is
+ * retaken so that it ends on the boundary.  Boundaries within a minimum step
+ * of either end of the step are ignored.
+ *
+ * @return true if the step size was changed and the step needs to be retaken
+ */
+//------------------------------------------------------------------------------
+bool RungeKutta::TruncateAtBoundary()
+{
+    if (!physicalModel->HasStepBoundaries())
+       return false;
+
+    Real boundary = physicalModel->FindStepBoundary(inState, candidateState,
+          stepSize);
+
+    if ((fabs(boundary) <= minimumStep) ||
+        (fabs(stepSize) - fabs(boundary) <= minimumStep))
+       return false;
+
+    #ifdef DEBUG_PROPAGATOR_FLOW
+       MessageInterface::ShowMessage(wxT("Step %.12lf truncated to %.12lf to ")
+             wxT("land on a force boundary\n"), stepSize, boundary);
+    #endif
+
+    stepSize = boundary;
+    return true;
+}
+
 //------------------------------------------------------------------------------
 // void RungeKutta::ClearArrays(void)
 //------------------------------------------------------------------------------
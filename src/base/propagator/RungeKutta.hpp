@@ -183,6 +183,7 @@ protected:
     void ClearArrays();
     virtual Real EstimateError();
     bool AdaptStep(Real maxerror);
+    virtual bool TruncateAtBoundary();
 
     //------------------------------------------------------------------------------
     // virtual void SetCoefficients(void)
@@ -274,8 +274,8 @@ bool RungeKuttaNystrom::Step()
     if (fabs(stepSize) > maximumStep)
         stepSize = ((stepSize > 0.0) ? maximumStep : -maximumStep);
         
-    bool goodStepTaken = false;
-    double maxerror;
+    bool goodStepTaken = false, landing = false;
+    double maxerror, boundlessStep = stepSize;
     
     do {
         if (!RawStep()) {
@@ -283,6 +283,11 @@ bool RungeKuttaNystrom::Step()
             return false;
         }
 
+        if (!landing && TruncateAtBoundary()) {
+            landing = true;
+            continue;
+        }
+
         maxerror = EstimateError();
         stepTaken = stepSize;
         if (AdaptStep(maxerror))
@@ -294,6 +299,9 @@ bool RungeKuttaNystrom::Step()
         }
     } while (!goodStepTaken);
 
+    if (landing && (fabs(stepSize) < fabs(boundlessStep)))
+        stepSize = boundlessStep;
+
     physicalModel->IncrementTime(stepTaken);
     return true;
 }
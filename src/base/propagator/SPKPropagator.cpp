@@ -39,6 +39,10 @@ const wxString SPKPropagator::PARAMETER_TEXT[
       wxT("SPKFiles")                    //SPKFILENAMES
 };
 
+const ParameterIndex
+SPKPropagator::PARAMETER_INDEX(PARAMETER_TEXT,
+      EphemerisPropagatorParamCount, SPKPropagatorParamCount);
+
 /// SPKPropagator parameter types
 const Gmat::ParameterType SPKPropagator::PARAMETER_TYPE[
                  SPKPropagatorParamCount - EphemerisPropagatorParamCount] =
@@ -180,12 +184,9 @@ wxString SPKPropagator::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer SPKPropagator::GetParameterID(const wxString &str) const
 {
-   for (Integer i = EphemerisPropagatorParamCount;
-         i < SPKPropagatorParamCount; ++i)
-   {
-       if (str == PARAMETER_TEXT[i - EphemerisPropagatorParamCount])
-           return i;
-   }
+   Integer id = PARAMETER_INDEX.Find(str);
+   if (id != -1)
+      return id;
 
    return EphemerisPropagator::GetParameterID(str);
 }
@@ -112,6 +112,8 @@ protected:
    /// SPKPropagator parameter labels
    static const wxString PARAMETER_TEXT[SPKPropagatorParamCount -
                                            EphemerisPropagatorParamCount];
+   /// Hash index of the PARAMETER_TEXT labels, used by GetParameterID()
+   static const ParameterIndex PARAMETER_INDEX;
 
    virtual void         UpdateState();
 
@@ -26,6 +26,7 @@
 #include "GmatConstants.hpp"
 #include "AngleUtil.hpp"            // For lat, long range setting
 #include "CoordinateConverter.hpp"
+#include "TimeSystemConverter.hpp"  // for the density cache interval
 
 
 //#include wxT("RealUtilities.hpp")        // Inadequate for my needs here, so...
@@ -48,6 +49,10 @@ AtmosphereModel::PARAMETER_TEXT[AtmosphereModelParamCount-GmatBaseParamCount] =
    wxT("MagneticIndex")                  // In GMAT, the wxT("published") value is K_p.
 };
 
+const ParameterIndex
+AtmosphereModel::PARAMETER_INDEX(PARAMETER_TEXT,
+      GmatBaseParamCount, AtmosphereModelParamCount);
+
 const Gmat::ParameterType
 AtmosphereModel::PARAMETER_TYPE[AtmosphereModelParamCount-GmatBaseParamCount] =
 {
@@ -56,6 +61,15 @@ AtmosphereModel::PARAMETER_TYPE[AtmosphereModelParamCount-GmatBaseParamCount] =
    Gmat::REAL_TYPE
 };
 
+/// Ap for each Kp step of 1/3, from table 8-3 of Vallado, 3rd edition
+const Real
+AtmosphereModel::KP_TO_AP[KP_AP_TABLE_SIZE] =
+{
+     0.0,   2.0,   3.0,   4.0,   5.0,   6.0,   7.0,   9.0,  12.0,  15.0,
+    18.0,  22.0,  27.0,  32.0,  39.0,  48.0,  56.0,  67.0,  80.0,  94.0,
+   111.0, 132.0, 154.0, 179.0, 207.0, 236.0, 300.0, 400.0
+};
+
 //------------------------------------------------------------------------------
 //  AtmosphereModel()
 //------------------------------------------------------------------------------
@@ -93,7 +107,15 @@ AtmosphereModel::AtmosphereModel(const wxString &typeStr, const wxString &name)
    geoLat               (0.0),
    geoLong              (0.0),
    gha                  (0.0),
-   ghaEpoch             (0.0)
+   ghaEpoch             (0.0),
+   densityCacheTolerance(0.0),       // Default is no cache
+   densityCacheInterval (0.125),     // 3 hours, the K_p cadence
+   densityCacheEpoch    (-1.0),
+   densityCacheMinAlt   (100.0),
+   densityCacheMaxAlt   (1000.0),
+   densityCacheAltStep  (2.0),
+   densityCacheLatStep  (5.0),
+   densityCacheTimeStep (0.5)
 {
    objectTypes.push_back(Gmat::ATMOSPHERE);
    objectTypeNames.push_back(wxT("AtmosphereModel"));
@@ -106,6 +128,9 @@ AtmosphereModel::AtmosphereModel(const wxString &typeStr, const wxString &name)
    angVel[1]      = 0.0;
    angVel[2]      = 7.29211585530e-5;
 
+   densityCacheSun[0] = densityCacheSun[1] = densityCacheSun[2] = 0.0;
+   densityCacheInputs[0] = densityCacheInputs[1] = densityCacheInputs[2] = 0.0;
+
    #ifdef CHECK_KP2AP
       MessageInterface::ShowMessage(wxT("K_p to A_p conversions:\n"));
       for (Integer i = 0; i < 28; ++i)
@@ -123,6 +148,12 @@ AtmosphereModel::AtmosphereModel(const wxString &typeStr, const wxString &name)
 //------------------------------------------------------------------------------
 AtmosphereModel::~AtmosphereModel()
 {
+   if (fileReader)
+   {
+      if (solarFluxFile)
+         fileReader->CloseSolarFluxFile(solarFluxFile);
+      delete fileReader;
+   }
 }
 
 //------------------------------------------------------------------------------
@@ -161,10 +192,24 @@ AtmosphereModel::AtmosphereModel(const AtmosphereModel& am) :
    geoLat               (0.0),
    geoLong              (0.0),
    gha                  (0.0),
-   ghaEpoch             (0.0)
+   ghaEpoch             (0.0),
+   densityCacheTolerance(am.densityCacheTolerance),
+   densityCacheInterval (am.densityCacheInterval),
+   densityCacheEpoch    (-1.0),
+   densityCacheMinAlt   (am.densityCacheMinAlt),
+   densityCacheMaxAlt   (am.densityCacheMaxAlt),
+   densityCacheAltStep  (am.densityCacheAltStep),
+   densityCacheLatStep  (am.densityCacheLatStep),
+   densityCacheTimeStep (am.densityCacheTimeStep)
 {
    parameterCount = AtmosphereModelParamCount;
    nominalAp = ConvertKpToAp(nominalKp);
+   densityCacheSun[0] = densityCacheSun[1] = densityCacheSun[2] = 0.0;
+   densityCacheInputs[0] = densityCacheInputs[1] = densityCacheInputs[2] = 0.0;
+
+   // Share the space weather already read rather than reading the file again
+   if ((am.fileReader != NULL) && am.fileReader->IsLoaded())
+      fileReader = new SolarFluxFileReader(*am.fileReader);
 }
 
 //------------------------------------------------------------------------------
@@ -185,7 +230,15 @@ AtmosphereModel& AtmosphereModel::operator=(const AtmosphereModel& am)
         
    GmatBase::operator=(am);
    
+   if (fileReader)
+   {
+      if (solarFluxFile)
+         fileReader->CloseSolarFluxFile(solarFluxFile);
+      delete fileReader;
+   }
    fileReader           = NULL;
+   if ((am.fileReader != NULL) && am.fileReader->IsLoaded())
+      fileReader = new SolarFluxFileReader(*am.fileReader);
    solarSystem          = am.solarSystem;
    mCentralBody         = am.mCentralBody;
    solarFluxFile        = NULL;
@@ -213,6 +266,15 @@ AtmosphereModel& AtmosphereModel::operator=(const AtmosphereModel& am)
    gha                  = 0.0;
    ghaEpoch             = 0.0;
 
+   densityCacheTolerance = am.densityCacheTolerance;
+   densityCacheInterval  = am.densityCacheInterval;
+   densityCacheMinAlt    = am.densityCacheMinAlt;
+   densityCacheMaxAlt    = am.densityCacheMaxAlt;
+   densityCacheAltStep   = am.densityCacheAltStep;
+   densityCacheLatStep   = am.densityCacheLatStep;
+   densityCacheTimeStep  = am.densityCacheTimeStep;
+   ResetDensityCache();
+
    return *this;
 }
 
@@ -475,95 +537,8 @@ Real AtmosphereModel::ConvertKpToAp(const Real kp)
       case 0:  // Table lookup
          {
             Integer index = (Integer)((kp + .01) * 3);
-            switch (index)
-            {
-               case 0:
-                  ap = 0.0;
-                  break;
-               case 1:
-                  ap = 2.0;
-                  break;
-               case 2:
-                  ap = 3.0;
-                  break;
-               case 3:
-                  ap = 4.0;
-                  break;
-               case 4:
-                  ap = 5.0;
-                  break;
-               case 5:
-                  ap = 6.0;
-                  break;
-               case 6:
-                  ap = 7.0;
-                  break;
-               case 7:
-                  ap = 9.0;
-                  break;
-               case 8:
-                  ap = 12.0;
-                  break;
-               /// case 9 is the default, below
-               case 10:
-                  ap = 18.0;
-                  break;
-               case 11:
-                  ap = 22.0;
-                  break;
-               case 12:
-                  ap = 27.0;
-                  break;
-               case 13:
-                  ap = 32.0;
-                  break;
-               case 14:
-                  ap = 39.0;
-                  break;
-               case 15:
-                  ap = 48.0;
-                  break;
-               case 16:
-                  ap = 56.0;
-                  break;
-               case 17:
-                  ap = 67.0;
-                  break;
-               case 18:
-                  ap = 80.0;
-                  break;
-               case 19:
-                  ap = 94.0;
-                  break;
-               case 20:
-                  ap = 111.0;
-                  break;
-               case 21:
-                  ap = 132.0;
-                  break;
-               case 22:
-                  ap = 154.0;
-                  break;
-               case 23:
-                  ap = 179.0;
-                  break;
-               case 24:
-                  ap = 207.0;
-                  break;
-               case 25:
-                  ap = 236.0;
-                  break;
-               case 26:
-                  ap = 300.0;
-                  break;
-               case 27:
-                  ap = 400.0;
-                  break;
-               case 9:
-               default:
-                  ap = 15.0;
-                  break;
-            }
+            if ((index >= 0) && (index < KP_AP_TABLE_SIZE))
+               ap = KP_TO_AP[index];
          }
          break;
 
@@ -604,6 +579,137 @@ Real AtmosphereModel::ConvertKpToAp(const Real kp)
 }
 
 
+//-----------------------------------------------------------------------------
+// bool SupportsDensityCache()
+//-----------------------------------------------------------------------------
+/**
+ * Checks to see if the model can build an interpolated density table.
+ *
+ * Models that support the cache override GridDensity() and consult
+ * CachedDensity() from their Density() implementation.
+ *
+ * @return true if the model supports the density cache, false if not
+ */
+//-----------------------------------------------------------------------------
+bool AtmosphereModel::SupportsDensityCache()
+{
+   return false;
+}
+
+//-----------------------------------------------------------------------------
+// void SetDensityCacheTolerance(Real tolerance)
+//-----------------------------------------------------------------------------
+/**
+ * Sets the relative error bound for the interpolated density cache.
+ *
+ * @param <tolerance> The largest accepted relative density error; 0.0 turns
+ *                    the cache off.
+ */
+//-----------------------------------------------------------------------------
+void AtmosphereModel::SetDensityCacheTolerance(Real tolerance)
+{
+   if (tolerance < 0.0)
+      throw AtmosphereException(wxT("The density cache tolerance must be ")
+            wxT("greater than or equal to 0.0"));
+
+   if (tolerance != densityCacheTolerance)
+   {
+      densityCacheTolerance = tolerance;
+      ResetDensityCache();
+   }
+}
+
+//-----------------------------------------------------------------------------
+// Real GetDensityCacheTolerance() const
+//-----------------------------------------------------------------------------
+/**
+ * Retrieves the relative error bound for the interpolated density cache.
+ *
+ * @return The tolerance; 0.0 when the cache is off.
+ */
+//-----------------------------------------------------------------------------
+Real AtmosphereModel::GetDensityCacheTolerance() const
+{
+   return densityCacheTolerance;
+}
+
+//-----------------------------------------------------------------------------
+// void ResetDensityCache()
+//-----------------------------------------------------------------------------
+/**
+ * Discards the interpolated density table.
+ */
+//-----------------------------------------------------------------------------
+void AtmosphereModel::ResetDensityCache()
+{
+   densityCacheEpoch = -1.0;
+   densityNodes.clear();
+   densityCells.clear();
+}
+
+
+//-----------------------------------------------------------------------------
+// bool DensityGradient(Real *position, Real *density, Real *gradient,
+//                      Real epoch, Integer count)
+//-----------------------------------------------------------------------------
+/**
+ * Calculates the density and its gradient with respect to position.
+ *
+ * The default implementation treats the density as a function of altitude
+ * only, and differences the model along the radial direction over a 10 m
+ * step.  Models with an analytic altitude profile override this method.
+ *
+ * @param <position>  The input vector of spacecraft states, in MJ2000Eq
+ *                    coordinates, 6 elements per spacecraft.
+ * @param <density>   The array of output densities, in kg/m^3.
+ * @param <gradient>  The output density gradients, 3 elements per spacecraft,
+ *                    in kg/m^3/km.
+ * @param <epoch>     The current TAI modified Julian epoch.
+ * @param <count>     The number of spacecraft contained in position.
+ *
+ * @return true on success, false if a problem is encountered.
+ */
+//-----------------------------------------------------------------------------
+bool AtmosphereModel::DensityGradient(Real *position, Real *density,
+      Real *gradient, Real epoch, Integer count)
+{
+   const Real radialStep = 0.01;
+   Real offset[6], loc[3], r, upper;
+
+   for (Integer i = 0; i < count; ++i)
+   {
+      Real *pos = &position[i*6];
+      if (!Density(pos, &density[i], epoch, 1))
+         return false;
+
+      for (Integer j = 0; j < 3; ++j)
+         loc[j] = pos[j] -
+               (centralBodyLocation != NULL ? centralBodyLocation[j] : 0.0);
+      r = sqrt(loc[0]*loc[0] + loc[1]*loc[1] + loc[2]*loc[2]);
+
+      if (r == 0.0)
+      {
+         gradient[i*3] = gradient[i*3+1] = gradient[i*3+2] = 0.0;
+         continue;
+      }
+
+      for (Integer j = 0; j < 3; ++j)
+      {
+         offset[j]   = pos[j] + radialStep * loc[j] / r;
+         offset[j+3] = pos[j+3];
+      }
+      if (!Density(offset, &upper, epoch, 1))
+         return false;
+
+      Real dRhodR = (upper - density[i]) / radialStep;
+      for (Integer j = 0; j < 3; ++j)
+         gradient[i*3+j] = dRhodR * loc[j] / r;
+   }
+
+   return true;
+}
+
+
 //-----------------------------------------------------------------------------
 // bool AtmosphereModel::HasWindModel()
 //-----------------------------------------------------------------------------
@@ -779,9 +885,9 @@ wxString AtmosphereModel::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer AtmosphereModel::GetParameterID(const wxString &str) const
 {
-   for (Integer i = GmatBaseParamCount; i < AtmosphereModelParamCount; ++i)
-      if (str == PARAMETER_TEXT[i - GmatBaseParamCount])
-         return i;
+   Integer id = PARAMETER_INDEX.Find(str);
+   if (id != -1)
+      return id;
    return GmatBase::GetParameterID(str);
 }
 
@@ -863,6 +969,10 @@ Real AtmosphereModel::GetRealParameter(const Integer id) const
 //------------------------------------------------------------------------------
 Real AtmosphereModel::SetRealParameter(const Integer id, const Real value)
 {
+   if ((id == NOMINAL_FLUX) || (id == NOMINAL_AVERAGE_FLUX) ||
+       (id == NOMINAL_MAGNETIC_INDEX))
+      ResetDensityCache();
+
    if (id == NOMINAL_FLUX)
    {
       if (value > 0.0)
@@ -908,6 +1018,17 @@ void AtmosphereModel::SetSolarFluxFile(const wxString &file)
    {
       fileName = file;
       SetOpenFileFlag(false);
+
+      // The space weather table belongs to the previous file
+      if (fileReader)
+      {
+         if (solarFluxFile)
+            fileReader->CloseSolarFluxFile(solarFluxFile);
+         solarFluxFile = NULL;
+         delete fileReader;
+         fileReader = NULL;
+      }
+      ResetDensityCache();
    }   
 }
 
@@ -948,8 +1069,14 @@ void AtmosphereModel::SetOpenFileFlag(bool flag)
 //------------------------------------------------------------------------------
 void AtmosphereModel::CloseFile()
 {
+   if ((fileReader == NULL) || (solarFluxFile == NULL))
+      return;
+
    if (fileReader->CloseSolarFluxFile(solarFluxFile))
+   {
+      solarFluxFile = NULL;
       fileRead = false;
+   }
    else
       throw AtmosphereException(wxT("Error closing Atmosphere Model data file.\n"));
 }
@@ -1169,3 +1296,249 @@ Real AtmosphereModel::CalculateGeocentrics(Real *position, GmatEpoch when,
    return geoHeight;
 
 }
+
+
+//------------------------------------------------------------------------------
+// bool CachedDensity(Real height, Real latitude, Real localTime,
+//                    GmatEpoch when, Real &density)
+//------------------------------------------------------------------------------
+/**
+ * Looks up the density in the interpolated density table.
+ *
+ * The table is a grid in altitude, geodetic latitude and local solar time.
+ * Each table covers one space weather interval, aligned to the 3 hour UTC
+ * K_p boundaries, and is rebuilt when the epoch leaves the interval or when
+ * the model's space weather inputs change.  Nodes are filled lazily from
+ * GridDensity() at the middle of the interval, and the natural log of the
+ * density is interpolated trilinearly.
+ *
+ * The first time a cell is used, the model is evaluated at the cell center
+ * at the start, middle and end of the interval, so that the universal time
+ * terms of the model are checked as well as the spatial ones.  If the
+ * interpolated value misses any of these by more than the tolerance, the
+ * cell is marked so that the caller evaluates the full model for every point
+ * inside it.
+ *
+ * @param <height>    Geodetic altitude, in km.
+ * @param <latitude>  Geodetic latitude, in degrees.
+ * @param <localTime> Local solar time, in hours.
+ * @param <when>      The current epoch.
+ * @param <density>   The interpolated density, in kg/m^3.
+ *
+ * @return true if density was set from the table, false if the caller needs
+ *         to evaluate the model directly.
+ */
+//------------------------------------------------------------------------------
+bool AtmosphereModel::CachedDensity(Real height, Real latitude, Real localTime,
+                                    GmatEpoch when, Real &density)
+{
+   if ((densityCacheTolerance <= 0.0) || !SupportsDensityCache())
+      return false;
+   if ((height < densityCacheMinAlt) || (height >= densityCacheMaxAlt))
+      return false;
+
+   Real inputs[3];
+   GetDensityCacheInputs(when, inputs);
+
+   // Start a new table when the epoch leaves the current interval or the
+   // space weather changes
+   if ((densityCacheEpoch < 0.0) || (when < densityCacheEpoch) ||
+       (when >= densityCacheEpoch + densityCacheInterval) ||
+       (inputs[0] != densityCacheInputs[0]) ||
+       (inputs[1] != densityCacheInputs[1]) ||
+       (inputs[2] != densityCacheInputs[2]))
+   {
+      ResetDensityCache();
+      if (sunVector != NULL)
+         for (Integer i = 0; i < 3; ++i)
+            densityCacheSun[i] = sunVector[i];
+      for (Integer i = 0; i < 3; ++i)
+         densityCacheInputs[i] = inputs[i];
+
+      // Align the interval to the UTC boundaries of the K_p data
+      Real utcWhen = TimeConverterUtil::Convert(when,
+            TimeConverterUtil::A1MJD, TimeConverterUtil::UTCMJD,
+            GmatTimeConstants::JD_JAN_5_1941);
+      Real utcStart = floor(utcWhen / densityCacheInterval) *
+            densityCacheInterval;
+      densityCacheEpoch = when - (utcWhen - utcStart);
+   }
+
+   Integer latCount  = (Integer)(180.0 / densityCacheLatStep + 0.5) + 1;
+   Integer timeCount = (Integer)(24.0 / densityCacheTimeStep + 0.5);
+
+   localTime = fmod(localTime, 24.0);
+   if (localTime < 0.0)
+      localTime += 24.0;
+
+   Real ah = (height - densityCacheMinAlt) / densityCacheAltStep;
+   Real al = (latitude + 90.0) / densityCacheLatStep;
+   Real at = localTime / densityCacheTimeStep;
+
+   Integer ih = (Integer)ah;
+   Integer il = (Integer)al;
+   Integer it = (Integer)at;
+   if (il > latCount - 2)
+      il = latCount - 2;
+   if (il < 0)
+      il = 0;
+   if (it > timeCount - 1)
+      it = timeCount - 1;
+
+   Real fh = ah - ih;
+   Real fl = al - il;
+   Real ft = at - it;
+
+   // Local time wraps around at 24 hours
+   Integer it1 = (it + 1) % timeCount;
+
+   Real corner[8];
+   corner[0] = DensityNode(ih,   il,   it);
+   corner[1] = DensityNode(ih+1, il,   it);
+   corner[2] = DensityNode(ih,   il+1, it);
+   corner[3] = DensityNode(ih+1, il+1, it);
+   corner[4] = DensityNode(ih,   il,   it1);
+   corner[5] = DensityNode(ih+1, il,   it1);
+   corner[6] = DensityNode(ih,   il+1, it1);
+   corner[7] = DensityNode(ih+1, il+1, it1);
+
+   Integer cell = (ih * latCount + il) * timeCount + it;
+   std::map<Integer, bool>::iterator cellCheck = densityCells.find(cell);
+   if (cellCheck == densityCells.end())
+   {
+      Real center = 0.0;
+      bool valid = true;
+      for (Integer i = 0; i < 8; ++i)
+      {
+         if (corner[i] == -GmatRealConstants::REAL_MAX)
+            valid = false;
+         center += corner[i];
+      }
+
+      // Check the start, middle and end of the interval; the end is pulled
+      // in by a second so that it still uses this interval's space weather
+      Real checkEpoch[3];
+      checkEpoch[0] = densityCacheEpoch;
+      checkEpoch[1] = densityCacheEpoch + 0.5 * densityCacheInterval;
+      checkEpoch[2] = densityCacheEpoch + densityCacheInterval -
+            1.0 / GmatTimeConstants::SECS_PER_DAY;
+
+      Real estimate = exp(0.125 * center);
+      for (Integer i = 0; (i < 3) && valid; ++i)
+      {
+         Real exact = GridDensity(
+               densityCacheMinAlt + (ih + 0.5) * densityCacheAltStep,
+               -90.0 + (il + 0.5) * densityCacheLatStep,
+               (it + 0.5) * densityCacheTimeStep, checkEpoch[i]);
+         valid = (exact > 0.0) &&
+               (fabs(estimate - exact) <= densityCacheTolerance * exact);
+      }
+
+      #ifdef DEBUG_DENSITY_CACHE
+         MessageInterface::ShowMessage(wxT("Density cache cell [%d %d %d] ")
+               wxT("is %s\n"), ih, il, it, (valid ? wxT("valid") :
+               wxT("outside of the tolerance")));
+      #endif
+
+      densityCells[cell] = valid;
+      if (!valid)
+         return false;
+   }
+   else if (cellCheck->second == false)
+      return false;
+
+   Real c00 = corner[0] + fh * (corner[1] - corner[0]);
+   Real c10 = corner[2] + fh * (corner[3] - corner[2]);
+   Real c01 = corner[4] + fh * (corner[5] - corner[4]);
+   Real c11 = corner[6] + fh * (corner[7] - corner[6]);
+   Real c0  = c00 + fl * (c10 - c00);
+   Real c1  = c01 + fl * (c11 - c01);
+
+   density = exp(c0 + ft * (c1 - c0));
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// Real GridDensity(Real height, Real latitude, Real localTime, GmatEpoch when)
+//------------------------------------------------------------------------------
+/**
+ * Evaluates the model at a point of the density table.
+ *
+ * Models that support the density cache override this method to evaluate the
+ * density at the requested epoch inside the table's interval, using the Sun
+ * vector captured for the table (densityCacheSun).
+ *
+ * @param <height>    Geodetic altitude, in km.
+ * @param <latitude>  Geodetic latitude, in degrees.
+ * @param <localTime> Local solar time, in hours.
+ * @param <when>      The a.1 epoch of the evaluation.
+ *
+ * @return The density, in kg/m^3.
+ */
+//------------------------------------------------------------------------------
+Real AtmosphereModel::GridDensity(Real height, Real latitude, Real localTime,
+                                  GmatEpoch when)
+{
+   throw AtmosphereException(wxT("The ") + typeName +
+         wxT(" atmosphere model does not support the density cache"));
+}
+
+
+//------------------------------------------------------------------------------
+// void GetDensityCacheInputs(GmatEpoch when, Real *inputs)
+//------------------------------------------------------------------------------
+/**
+ * Retrieves the space weather inputs the model uses at an epoch.
+ *
+ * The density table is rebuilt whenever any of these change.  The default
+ * returns the nominal F10.7, average F10.7 and K_p values; models that read
+ * space weather from a file override this method.
+ *
+ * @param <when>   The a.1 epoch.
+ * @param <inputs> Array of 3 elements that receives the inputs.
+ */
+//------------------------------------------------------------------------------
+void AtmosphereModel::GetDensityCacheInputs(GmatEpoch when, Real *inputs)
+{
+   inputs[0] = nominalF107;
+   inputs[1] = nominalF107a;
+   inputs[2] = nominalKp;
+}
+
+
+//------------------------------------------------------------------------------
+// Real DensityNode(Integer altIndex, Integer latIndex, Integer timeIndex)
+//------------------------------------------------------------------------------
+/**
+ * Retrieves the log of the density at a table node, evaluating the model at
+ * the middle of the table's interval the first time the node is used.
+ *
+ * @param <altIndex>  Altitude index of the node.
+ * @param <latIndex>  Latitude index of the node.
+ * @param <timeIndex> Local time index of the node.
+ *
+ * @return The natural log of the density, or -REAL_MAX if the density is not
+ *         positive at the node.
+ */
+//------------------------------------------------------------------------------
+Real AtmosphereModel::DensityNode(Integer altIndex, Integer latIndex,
+                                  Integer timeIndex)
+{
+   Integer latCount  = (Integer)(180.0 / densityCacheLatStep + 0.5) + 1;
+   Integer timeCount = (Integer)(24.0 / densityCacheTimeStep + 0.5);
+   Integer node = (altIndex * latCount + latIndex) * timeCount + timeIndex;
+
+   std::map<Integer, Real>::iterator i = densityNodes.find(node);
+   if (i != densityNodes.end())
+      return i->second;
+
+   Real rho = GridDensity(densityCacheMinAlt + altIndex * densityCacheAltStep,
+         -90.0 + latIndex * densityCacheLatStep,
+         timeIndex * densityCacheTimeStep,
+         densityCacheEpoch + 0.5 * densityCacheInterval);
+   Real logRho = (rho > 0.0 ? log(rho) : -GmatRealConstants::REAL_MAX);
+   densityNodes[node] = logRho;
+
+   return logRho;
+}
@@ -82,6 +82,17 @@ public:
    void SetKpApConversionMethod(Integer method);
    Real ConvertKpToAp(const Real kp);
 
+   // Interpolated density cache
+   virtual bool SupportsDensityCache();
+   void SetDensityCacheTolerance(Real tolerance);
+   Real GetDensityCacheTolerance() const;
+   void ResetDensityCache();
+
+   // Density partials used by the drag state transition matrix
+   virtual bool DensityGradient(Real *position, Real *density,
+         Real *gradient, Real epoch = GmatTimeConstants::MJD_OF_J2000,
+         Integer count = 1);
+
    // Extra methods some models may support
    virtual bool HasWindModel();
    virtual bool Wind(Real *position, Real* wind, Real ep,
@@ -112,7 +123,7 @@ public:
    void CloseFile();
 
 protected:
-   /// Solar flux binary file reader
+   /// Solar flux binary file reader, holding the file's space weather table
    SolarFluxFileReader     *fileReader;
    /// The solarsystem
    SolarSystem             *solarSystem;
@@ -171,6 +182,28 @@ protected:
    /// GHA epoch
    Real                    ghaEpoch;
 
+   /// Relative error bound for the density cache; 0.0 disables the cache
+   Real                    densityCacheTolerance;
+   /// Time span (days) a density table is used before it is rebuilt
+   Real                    densityCacheInterval;
+   /// Start of the space weather interval of the density table, or -1.0
+   GmatEpoch               densityCacheEpoch;
+   /// Space weather inputs the density table was built with
+   Real                    densityCacheInputs[3];
+   /// Sun vector captured at the reference epoch of the density table
+   Real                    densityCacheSun[3];
+   /// Lowest and highest altitudes (km) covered by the density table
+   Real                    densityCacheMinAlt;
+   Real                    densityCacheMaxAlt;
+   /// Node spacing: altitude (km), latitude (deg) and local time (hours)
+   Real                    densityCacheAltStep;
+   Real                    densityCacheLatStep;
+   Real                    densityCacheTimeStep;
+   /// Natural log of the density at the table nodes computed so far
+   std::map<Integer, Real> densityNodes;
+   /// Table cells checked against the tolerance; false cells use the model
+   std::map<Integer, bool> densityCells;
+
    /// Conversion routines to go to the fixed frame
 //   CoordinateConverter     mCoordConverter;
 
@@ -183,6 +216,16 @@ protected:
                                  GmatEpoch when = -1.0,
                                  bool includeLatLong = false);
 
+   bool                    CachedDensity(Real height, Real latitude,
+                                 Real localTime, GmatEpoch when,
+                                 Real &density);
+   virtual Real            GridDensity(Real height, Real latitude,
+                                 Real localTime, GmatEpoch when);
+   virtual void            GetDensityCacheInputs(GmatEpoch when,
+                                 Real *inputs);
+   Real                    DensityNode(Integer altIndex, Integer latIndex,
+                                 Integer timeIndex);
+
    enum {
       NOMINAL_FLUX = GmatBaseParamCount,
       NOMINAL_AVERAGE_FLUX,
@@ -192,9 +235,15 @@ protected:
    
    static const wxString
       PARAMETER_TEXT[AtmosphereModelParamCount - GmatBaseParamCount];
+   /// Hash index of the PARAMETER_TEXT labels, used by GetParameterID()
+   static const ParameterIndex PARAMETER_INDEX;
    static const Gmat::ParameterType
       PARAMETER_TYPE[AtmosphereModelParamCount - GmatBaseParamCount];
 
+   /// Number of entries in the Kp to Ap lookup table
+   static const Integer KP_AP_TABLE_SIZE = 28;
+   static const Real    KP_TO_AP[KP_AP_TABLE_SIZE];
+
 private:  
     
 };
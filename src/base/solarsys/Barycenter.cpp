@@ -150,6 +150,12 @@ const Rvector6 Barycenter::GetMJ2000State(const A1Mjd &atTime)
       #endif
       return builtInSP->GetMJ2000State(atTime);
    }
+   
+   // Reuse the state if it was already computed for this epoch
+   Rvector6 memoState;
+   if (GetCachedMJ2000State(atTime, memoState))
+      return memoState;
+   
    // otherwise, sum the masses and states
    CheckBodies();
    #ifdef DEBUG_BARYCENTER
@@ -189,8 +195,11 @@ const Rvector6 Barycenter::GetMJ2000State(const A1Mjd &atTime)
       MessageInterface::ShowMessage(wxT("sumMassPos = %s\n"),
             (sumMassPos.ToString()).c_str());
    #endif
-   return Rvector6(sumMassPos(0), sumMassPos(1), sumMassPos(2),
-                   sumMassVel(0), sumMassVel(1), sumMassVel(2));
+   memoState.Set(sumMassPos(0), sumMassPos(1), sumMassPos(2),
+                 sumMassVel(0), sumMassVel(1), sumMassVel(2));
+   SetCachedMJ2000State(atTime, memoState);
+   
+   return memoState;
 }
 
 //---------------------------------------------------------------------------
@@ -422,6 +431,7 @@ bool Barycenter::Initialize()
             MessageInterface::ShowMessage(wxT("   %d    %s\n"), ii, (bodyNames.at(ii)).c_str());
       #endif
    }
+   InvalidateStateCache();
    return CalculatedPoint::Initialize();
 }
 
@@ -435,6 +445,7 @@ void Barycenter::SetIsBuiltIn(bool builtIn, const wxString &ofType)
 {
    isBuiltIn   = builtIn;
    builtInType = ofType;
+   InvalidateStateCache();
 }
 
 StringArray Barycenter::GetBuiltInNames()
@@ -445,6 +456,29 @@ StringArray Barycenter::GetBuiltInNames()
    return spNames;
 }
 
+//------------------------------------------------------------------------------
+// protected methods
+//------------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------
+//  UnsignedInt GetDependencyStateVersion()
+//---------------------------------------------------------------------------
+/**
+ * A built-in Barycenter takes its state from the built-in SpacePoint, so
+ * that point is its only dependency.
+ */
+//---------------------------------------------------------------------------
+UnsignedInt Barycenter::GetDependencyStateVersion()
+{
+   if (isBuiltIn)
+   {
+      if (builtInSP)
+         return builtInSP->GetStateCacheVersion();
+      return 0;
+   }
+   return CalculatedPoint::GetDependencyStateVersion();
+}
+
 //------------------------------------------------------------------------------
 // private methods
 //------------------------------------------------------------------------------
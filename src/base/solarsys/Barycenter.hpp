@@ -85,6 +85,8 @@ protected:
    bool                        isBuiltIn;
    wxString                 builtInType;
    SpacePoint                  *builtInSP;
+   
+   virtual UnsignedInt     GetDependencyStateVersion();
     
 private:
       // check that all bodies in the list are CelestialBody objects
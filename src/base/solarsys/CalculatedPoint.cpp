@@ -674,6 +674,7 @@ bool CalculatedPoint::SetRefObject(GmatBase *obj,
             
             (*pos) = (SpacePoint*)obj;
             bodyFound = true;
+            InvalidateStateCache();
          }
          ++pos;
       }
@@ -690,6 +691,7 @@ bool CalculatedPoint::SetRefObject(GmatBase *obj,
          
          bodyList.push_back((SpacePoint*) obj);         
          numberOfBodies++;
+         InvalidateStateCache();
       }
       
       return true;
@@ -817,6 +819,7 @@ bool CalculatedPoint::TakeAction(const wxString &action,
       bodyList.clear();
 //      defaultBodies.clear();
       numberOfBodies = 0;
+      InvalidateStateCache();
       return true; 
    }
    return SpacePoint::TakeAction(action, actionData);
@@ -874,6 +877,30 @@ const StringArray& CalculatedPoint::GetDefaultBodies() const
 }
 
 
+//------------------------------------------------------------------------------
+// protected methods
+//------------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------
+//  UnsignedInt GetDependencyStateVersion()
+//---------------------------------------------------------------------------
+/**
+ * Returns the sum of the state cache versions of the bodies this point is
+ * calculated from.  Nested calculated points add in their own bodies, so a
+ * change anywhere below this point invalidates its memoized state.
+ *
+ * @return the dependency version sum.
+ */
+//---------------------------------------------------------------------------
+UnsignedInt CalculatedPoint::GetDependencyStateVersion()
+{
+   UnsignedInt version = 0;
+   for (unsigned int i = 0; i < bodyList.size(); i++)
+      version += bodyList[i]->GetStateCacheVersion();
+   return version;
+}
+
+
 
 
 //------------------------------------------------------------------------------
@@ -139,6 +139,8 @@ protected:
 
    // names of the default bodies to use
    StringArray defaultBodies;
+   
+   virtual UnsignedInt  GetDependencyStateVersion();
     
 private:
       
@@ -638,6 +638,7 @@ bool CelestialBody::Initialize()
    lastEphemTime = 0.0;
    stateTime = 0.0;   
    newTwoBody = true;
+   InvalidateStateCache();
 
    if (!centralBodySet)
    {
@@ -758,7 +759,7 @@ const Rvector6&  CelestialBody::GetState(A1Mjd atTime)
       {
          #ifdef __USE_SPICE__
          if (!spiceSetupDone) SetUpSPICE();
-         Rvector6 spiceState = kernelReader->GetTargetState(naifName, naifId, atTime, j2000BodyName);
+         Rvector6 spiceState = kernelReader->GetCachedTargetState(naifName, naifId, atTime, j2000BodyName);
          state.Set(spiceState[0], spiceState[1], spiceState[2],
                    spiceState[3], spiceState[4], spiceState[5]);
          #else
@@ -858,7 +859,7 @@ void CelestialBody::GetState(const A1Mjd &atTime, Real *outState)
       #ifdef __USE_SPICE__
          if (!spiceSetupDone) SetUpSPICE();
 //         state = kernelReader->GetTargetState(instanceName, naifId, atTime, j2000BodyName);
-         state = kernelReader->GetTargetState(naifName, naifId, atTime, j2000BodyName);
+         state = kernelReader->GetCachedTargetState(naifName, naifId, atTime, j2000BodyName);
          for (Integer i=0;i<6;i++) outState[i] = state[i];
       #endif
          break;
@@ -1582,6 +1583,8 @@ bool CelestialBody::SetGravitationalConstant(Real newMu)
    
    mu                         = newMu;
    mass                       = mu / GmatPhysicalConstants::UNIVERSAL_GRAVITATIONAL_CONSTANT;
+   // Barycenter and libration point states are weighted by mass
+   InvalidateStateCache();
    return true;
 }
 
@@ -1710,6 +1713,7 @@ bool CelestialBody::SetSource(Gmat::PosVelSource pvSrc)
       spiceSetupDone = false;
    }
    posVelSrc           = pvSrc;
+   InvalidateStateCache();
    return true;
 }
 
@@ -1732,6 +1736,7 @@ bool CelestialBody::SetSourceFile(PlanetaryEphem *src)
    theSourceFile = src;
    sourceFilename = theSourceFile->GetName();
    bodyNumber = theSourceFile->GetBodyID(instanceName);
+   InvalidateStateCache();
    #ifdef DEBUG_EPHEM_SOURCE
       MessageInterface::ShowMessage
          (wxT("CelestialBody::SetSourceFile() <%p> %s, Setting source file to %p\n"),
@@ -2022,6 +2027,7 @@ bool CelestialBody::SetTwoBodyEpoch(const A1Mjd &toTime)
    #endif
    twoBodyEpoch        = toTime;
    newTwoBody          = true;
+   InvalidateStateCache();
    return true;
 }
 
@@ -2128,6 +2134,7 @@ bool CelestialBody::SetTwoBodyElements(const Rvector6 &kepl)
    
    twoBodyKepler       = kepl;
    newTwoBody          = true;
+   InvalidateStateCache();
    return true;
 }
 
@@ -2516,6 +2523,7 @@ Real        CelestialBody::GetRealParameter(const Integer id) const
 Real CelestialBody::SetRealParameter(const Integer id, const Real value)
 {
    Rvector6 tmpKepl = twoBodyKepler;
+   InvalidateStateCache();
    #ifdef DEBUG_CB_SET
       MessageInterface::ShowMessage(wxT("In CB::SetReal with id = %d, and value = %.14f\n"),
       id, value);
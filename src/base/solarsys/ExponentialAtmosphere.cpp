@@ -164,6 +164,58 @@ bool ExponentialAtmosphere::Density(Real *position, Real *density, Real epoch,
 }
 
 
+//------------------------------------------------------------------------------
+// bool DensityGradient(Real *position, Real *density, Real *gradient,
+//                      Real epoch, Integer count)
+//------------------------------------------------------------------------------
+/**
+ * Calculates the density and its gradient with respect to position.
+ *
+ * Inside a band the density falls off as exp(-h/H), so the gradient is
+ * -rho/H along the radial direction.  The smoothed profile has no simple
+ * closed form, so it is differenced by the base class.
+ *
+ * @param <position>  The input vector of spacecraft states.
+ * @param <density>   The array of output densities.
+ * @param <gradient>  The output density gradients, 3 elements per spacecraft.
+ * @param <epoch>     The current TAI modified Julian epoch.
+ * @param <count>     The number of spacecraft contained in position.
+ *
+ * @return true on success, false if a problem is encountered.
+ */
+//------------------------------------------------------------------------------
+bool ExponentialAtmosphere::DensityGradient(Real *position, Real *density,
+      Real *gradient, Real epoch, Integer count)
+{
+   if (smoothDensity)
+      return AtmosphereModel::DensityGradient(position, density, gradient,
+            epoch, count);
+
+   if (!Density(position, density, epoch, count))
+      return false;
+
+   Real loc[3], r, height;
+   Integer index;
+
+   for (Integer i = 0; i < count; ++i)
+   {
+      loc[0] = position[ i*6 ] - centralBodyLocation[0];
+      loc[1] = position[i*6+1] - centralBodyLocation[1];
+      loc[2] = position[i*6+2] - centralBodyLocation[2];
+      r = sqrt(loc[0]*loc[0] + loc[1]*loc[1] + loc[2]*loc[2]);
+
+      height = CalculateGeodetics(loc, epoch);
+      index = FindBand(height);
+
+      Real dRhodR = -density[i] / scaleHeight[index];
+      for (Integer j = 0; j < 3; ++j)
+         gradient[i*3+j] = dRhodR * loc[j] / r;
+   }
+
+   return true;
+}
+
+
 //------------------------------------------------------------------------------
 // void SetConstants(void)
 //------------------------------------------------------------------------------
@@ -64,6 +64,10 @@ public:
    virtual bool            Density(Real *position, Real *density, 
                                    Real epoch = GmatTimeConstants::MJD_OF_J2000,
                                    Integer count = 1);
+   virtual bool            DensityGradient(Real *position, Real *density,
+                                   Real *gradient,
+                                   Real epoch = GmatTimeConstants::MJD_OF_J2000,
+                                   Integer count = 1);
 
 protected: 
    /// Table of scale heights, \f$H\f$.
@@ -77,13 +77,7 @@ JacchiaRobertsAtmosphere::JacchiaRobertsAtmosphere(const wxString &name) :
 //------------------------------------------------------------------------------
 JacchiaRobertsAtmosphere::~JacchiaRobertsAtmosphere()
 {
-   if (fileReader)
-   {
-      if (fileReader->CloseSolarFluxFile(solarFluxFile))
-         fileRead = false;
-      else
-         throw AtmosphereException(wxT("Error closing JacchiaRoberts data file.\n"));
-   }
+   // The base class closes the flux file and releases the reader
 }
 
 //------------------------------------------------------------------------------
@@ -213,6 +207,11 @@ bool JacchiaRobertsAtmosphere::Density(Real *pos, Real *density, Real epoch,
       //  value used for heights below 90 KM.
       if (height > 0.0)
       {         
+         if ((densityCacheTolerance > 0.0) &&
+             CachedDensity(height, geoLat, LocalSolarTime(&pos[i*6]), epoch,
+                   density[i]))
+            continue;
+
          // Output density in units of kg/m3
          density[i] = 1.0e3 * JacchiaRoberts(height, &pos[i*6], sunVector,
                utc_time, newFile);
@@ -252,11 +251,125 @@ void JacchiaRobertsAtmosphere::SetCentralBody(CelestialBody *cb)
 }
 
 
+//------------------------------------------------------------------------------
+// bool SupportsDensityCache()
+//------------------------------------------------------------------------------
+/**
+ * Jacchia-Roberts supports the interpolated density table.
+ *
+ * @return true
+ */
+//------------------------------------------------------------------------------
+bool JacchiaRobertsAtmosphere::SupportsDensityCache()
+{
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// Real GridDensity(Real height, Real latitude, Real localTime, GmatEpoch when)
+//------------------------------------------------------------------------------
+/**
+ * Evaluates the model at a point of the density table.
+ *
+ * The model only sees the spacecraft position through the hour angle from
+ * the Sun, so the node is placed in the Sun's right ascension plane at the
+ * hour angle matching the requested local solar time.
+ *
+ * @param height     Geodetic altitude (km)
+ * @param latitude   Geodetic latitude (deg)
+ * @param localTime  Local solar time (hours)
+ * @param when       The a.1 epoch of the evaluation
+ *
+ * @return The density in kg/m^3
+ */
+//------------------------------------------------------------------------------
+Real JacchiaRobertsAtmosphere::GridDensity(Real height, Real latitude,
+                                           Real localTime, GmatEpoch when)
+{
+   Real hourAngle = (localTime - 12.0) * GmatMathConstants::PI / 12.0;
+   // exotherm() cannot evaluate points on the Sun's meridian
+   if (fabs(sin(hourAngle)) < 1.0e-6)
+      hourAngle += 1.0e-6;
+
+   Real sunRA = atan2(densityCacheSun[1], densityCacheSun[0]);
+   Real radius = cbRadius + height;
+   Real node[3];
+   node[0] = radius * cos(sunRA + hourAngle);
+   node[1] = radius * sin(sunRA + hourAngle);
+   node[2] = 0.0;
+
+   A1Mjd a1mjd_time(when);
+   Real utc_time = (Real)a1mjd_time.ToUtcMjd();
+
+   // JacchiaRoberts() reads the latitude from the geodetic data
+   Real currentLat = geoLat;
+   geoLat = latitude;
+   Real rho = 1.0e3 * JacchiaRoberts(height, node, densityCacheSun, utc_time,
+         newFile);
+   geoLat = currentLat;
+
+   return rho;
+}
+
+
+//------------------------------------------------------------------------------
+// void GetDensityCacheInputs(GmatEpoch when, Real *inputs)
+//------------------------------------------------------------------------------
+/**
+ * Retrieves the space weather inputs used at an epoch.
+ *
+ * When the flux file is in use, these are the minimum exospheric temperature
+ * and K_p read from it; otherwise the nominal values are used.
+ *
+ * @param when    The a.1 epoch
+ * @param inputs  Array of 3 elements that receives the inputs
+ */
+//------------------------------------------------------------------------------
+void JacchiaRobertsAtmosphere::GetDensityCacheInputs(GmatEpoch when,
+                                                     Real *inputs)
+{
+   GEOPARMS geo;
+   A1Mjd a1mjd_time(when);
+
+   if (newFile && (fileReader != NULL) && fileReader->IsLoaded() &&
+       (fileReader->GetSpaceWeather((Real)a1mjd_time.ToUtcMjd(), &geo) == 0))
+   {
+      inputs[0] = geo.xtemp;
+      inputs[1] = 0.0;
+      inputs[2] = geo.tkp;
+   }
+   else
+      AtmosphereModel::GetDensityCacheInputs(when, inputs);
+}
+
+
 //------------------------------------------------------------------------------
 //  Private methods
 //------------------------------------------------------------------------------
 
 
+//------------------------------------------------------------------------------
+// Real LocalSolarTime(Real space_craft[3])
+//------------------------------------------------------------------------------
+/**
+ * Computes the local solar time used to index the density table, based on the
+ * same hour angle from the Sun that exotherm() uses.
+ *
+ * @param space_craft  Spacecraft position (km)
+ *
+ * @return The local solar time, in hours
+ */
+//------------------------------------------------------------------------------
+Real JacchiaRobertsAtmosphere::LocalSolarTime(Real space_craft[3])
+{
+   Real hourAngle = atan2(
+         sunVector[0]*space_craft[1] - sunVector[1]*space_craft[0],
+         sunVector[0]*space_craft[0] + sunVector[1]*space_craft[1]);
+   return 12.0 + hourAngle * 12.0 / GmatMathConstants::PI;
+}
+
+
 //------------------------------------------------------------------------------
 // Real JacchiaRoberts(Real height, Real space_craft[3], Real sun[3], 
 //                     Real a1_time, bool new_file)
@@ -298,29 +411,31 @@ Real JacchiaRobertsAtmosphere::JacchiaRoberts(Real height, Real space_craft[3],
 
    if (new_file)
    {
-      if (!fileRead)
+      // Clones arrive with the table already filled
+      if ((fileReader == NULL) || !fileReader->IsLoaded())
       {  
+         if (fileReader == NULL)
+            fileReader = new SolarFluxFileReader();
+
          tkptr = fileReader->OpenSolarFluxFile(fileName);
-         solarFluxFile = tkptr;
-         fileRead = true;
-         
          if (tkptr != NULL)
-         {  
-            // Read minimum temperature and geomagnetic indices
-            Integer status = fileReader->LoadSolarFluxFile(a1_time, tkptr, new_file, &geo);
-            // Following Swingby code's procedure, return density = 0.0
-            // if values read from file are not accurate.
+         {
+            // Read all of the temperatures and geomagnetic indices once
+            Integer status = fileReader->LoadSpaceWeather(tkptr);
+            fileReader->CloseSolarFluxFile(tkptr);
             if (status != 0)
-            {
-                  throw AtmosphereException(wxT("Error loading in JacchiaRoberts data file.")
-                                            wxT("Density has be set to 0.0\n"));
-               Real dValue = 0.0;
-               return dValue; 
-            }    
+               throw AtmosphereException(wxT("Error loading in JacchiaRoberts data file.\n"));
          }
          else
             throw AtmosphereException(wxT("Error opening JacchiaRoberts data file.\n"));
-      }       
+      }
+      fileRead = true;
+
+      // Minimum temperature and geomagnetic index for this epoch
+      if (fileReader->GetSpaceWeather(a1_time, &geo) != 0)
+         throw AtmosphereException(wxT("The JacchiaRoberts data file does ")
+               wxT("not contain data for the requested epoch.\n"));
+
       #ifdef DEBUG_JR_DRAG
          MessageInterface::ShowMessage
             (wxT("   Using file\n   K_p     = %15.10le\n   exoTemp = %lf\n"), geo.tkp,
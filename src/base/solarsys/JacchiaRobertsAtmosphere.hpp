@@ -46,6 +46,12 @@ public:
    bool Density(Real *position, Real *density, Real epoch = GmatTimeConstants::MJD_OF_J2000,
                 Integer count = 1);
    virtual void SetCentralBody(CelestialBody *cb);
+   virtual bool SupportsDensityCache();
+
+protected:
+   virtual Real GridDensity(Real height, Real latitude, Real localTime,
+                            GmatEpoch when);
+   virtual void GetDensityCacheInputs(GmatEpoch when, Real *inputs);
 
 private:
    ///  Auxiliary temperature related quantities
@@ -98,6 +104,7 @@ private:
    Real con_den[5][7];
 
 
+   Real LocalSolarTime(Real space_craft[3]);
    Real JacchiaRoberts(Real height, Real space_craft[3], Real sun[3],
                       Real a1_time, bool new_file);
    Real exotherm(Real space_craft[3], Real sun[3], GEOPARMS *geo,
@@ -79,7 +79,9 @@ primaryBodyName     (wxT("")),
 secondaryBodyName   (wxT("")),
 whichPoint          (wxT("")),
 primaryBody         (NULL),
-secondaryBody       (NULL)
+secondaryBody       (NULL),
+gammaMuStar         (-1.0),
+gammaSolution       (0.0)
 {
    objectTypes.push_back(Gmat::LIBRATION_POINT);
    objectTypeNames.push_back(wxT("LibrationPoint"));
@@ -102,7 +104,9 @@ primaryBodyName          (lp.primaryBodyName),
 secondaryBodyName        (lp.secondaryBodyName),
 whichPoint               (lp.whichPoint),
 primaryBody              (lp.primaryBody),
-secondaryBody            (lp.secondaryBody)
+secondaryBody            (lp.secondaryBody),
+gammaMuStar              (-1.0),
+gammaSolution            (0.0)
 {
 }
 
@@ -129,6 +133,8 @@ LibrationPoint& LibrationPoint::operator=(const LibrationPoint &lp)
    whichPoint          = lp.whichPoint;
    primaryBody         = lp.primaryBody;
    secondaryBody       = lp.secondaryBody;
+   gammaMuStar         = -1.0;
+   gammaSolution       = 0.0;
    return *this;
 }
 
@@ -165,6 +171,11 @@ const Rvector6 LibrationPoint::GetMJ2000State(const A1Mjd &atTime)
        secondaryBody, secondaryBody->GetName().c_str());
    #endif
    
+   // Reuse the state if it was already computed for this epoch
+   Rvector6 rvResult;
+   if (GetCachedMJ2000State(atTime, rvResult))
+      return rvResult;
+   
    CheckBodies();
    // Compute position and velocity from primary to secondary
    Rvector6 primaryState = primaryBody->GetMJ2000State(atTime);
@@ -177,7 +188,7 @@ const Rvector6 LibrationPoint::GetMJ2000State(const A1Mjd &atTime)
       (wxT("   secondaryState =\n   %s\n"), secondaryState.ToString().c_str());
    #endif
    
-   Rvector6 pToS = (secondaryBody->GetMJ2000State(atTime)) - primaryState;
+   Rvector6 pToS = secondaryState - primaryState;
    Rvector3 r    = pToS.GetR();
    Rvector3 v    = pToS.GetV();
    Rvector3 a    = (secondaryBody->GetMJ2000Acceleration(atTime)) -
@@ -204,62 +215,10 @@ const Rvector6 LibrationPoint::GetMJ2000State(const A1Mjd &atTime)
    #endif
    
    Real gamma = 0.0;
-   Real gamma2 = 0.0, gamma3 = 0.0, gamma4 = 0.0, gamma5 = 0.0, gammaPrev = 0.0;
-   Real F = 0.0, Fdot = 0.0;
    if ((whichPoint == wxT("L1")) || (whichPoint == wxT("L2")) ||
        (whichPoint == wxT("L3")))
-   {
-      // Determine initial gamma
-      if (whichPoint == wxT("L3"))  gamma = 1.0;
-      else  gamma = GmatMathUtil::Pow((muStar / (3.0 * (1.0 - muStar))),
-                                      (1.0 / 3.0));
-      
-
-      Integer counter = 0;
-      Real diff = 999.99;
-      while (diff > CONVERGENCE_TOLERANCE)
-      {
-         if (counter > MAX_ITERATIONS)
-            throw SolarSystemException(
-                  wxT("Libration point gamma not converging."));
-         gamma2 = gamma  * gamma;
-         gamma3 = gamma2 * gamma;
-         gamma4 = gamma3 * gamma;
-         gamma5 = gamma4 * gamma;
-         if (whichPoint == wxT("L1"))
-         {
-            F = gamma5 - ((3.0 - muStar) * gamma4) + 
-                ((3.0 - 2.0 * muStar) * gamma3) - 
-                (muStar * gamma2) + (2.0 * muStar * gamma) - muStar;
-            Fdot = (5.0 * gamma4) - (4.0 * (3.0 - muStar) * gamma3) + 
-                   (3.0 * (3.0 - 2.0 * muStar) * gamma2) - 
-                   (2.0 * muStar * gamma) + (2.0 * muStar);
-         }
-         else if (whichPoint == wxT("L2"))
-         {
-            F = gamma5 + ((3.0 - muStar) * gamma4) + 
-                ((3.0 - 2.0 * muStar) * gamma3) - 
-                (muStar * gamma2) - (2.0 * muStar * gamma) - muStar;
-            Fdot = (5.0 * gamma4) + (4.0 * (3.0 - muStar) * gamma3) + 
-               (3.0 * (3.0 - 2.0 * muStar) * gamma2) - (2.0 * muStar * gamma) - 
-               (2.0 * muStar);
-         }
-         else  // whichPoint == wxT("L3")
-         {
-            F = gamma5 + ((2.0 + muStar) * gamma4) + 
-                ((1.0 + 2.0 * muStar) * gamma3) -
-                ((1.0 - muStar) * gamma2) - (2.0 * (1.0 - muStar) * gamma) - 
-                (1.0 - muStar);
-            Fdot = (5.0 * gamma4) + (4.0 * (2.0 +  muStar) * gamma3) + 
-               (3.0 * (1.0 +  2.0 * muStar) * gamma2) - 
-               (2.0 * (1.0 - muStar) * gamma) - (2.0 * (1.0 - muStar));
-         }
-         counter++;
-         gammaPrev = gamma;
-         gamma     = gammaPrev - (F / Fdot);
-         diff      = GmatMathUtil::Abs(gamma - gammaPrev);
-      }
-   }
+      gamma = SolveForGamma(muStar);
+   
    Real x = 0.0;
    Real y = 0.0;
    if (whichPoint == wxT("L1")) 
@@ -337,7 +296,8 @@ const Rvector6 LibrationPoint::GetMJ2000State(const A1Mjd &atTime)
    Rvector6 rvFK5(rLi(0), rLi(1), rLi(2), vLi(0), vLi(1), vLi(2));
    
    // Translate so that the origin is at the j2000Body
-   Rvector6 rvResult = rvFK5 + primaryState;
+   rvResult = rvFK5 + primaryState;
+   SetCachedMJ2000State(atTime, rvResult);
    
    #ifdef DEBUG_GET_STATE
    MessageInterface::ShowMessage
@@ -535,6 +495,7 @@ bool LibrationPoint::SetStringParameter(const Integer id,
       // since we don't know the order of setting, we cannot do the checking
       // of primary and secondary bodies are the same
       primaryBodyName = value;
+      InvalidateStateCache();
       return true;
    }
    if (id == SECONDARY_BODY_NAME)             
@@ -542,6 +503,7 @@ bool LibrationPoint::SetStringParameter(const Integer id,
       // since we don't know the order of setting, we cannot do the checking
       // of primary and secondary bodies are the same
       secondaryBodyName = value;
+      InvalidateStateCache();
       return true;
    }
    if (id == WHICH_POINT)             
@@ -553,6 +515,8 @@ bool LibrationPoint::SetStringParameter(const Integer id,
             wxT(" on object \"") + instanceName + wxT("\" is not an allowed value.\n")
             wxT("The allowed values are: [ L1, L2, L3, L4, L5 ]. "));
       whichPoint = value;
+      gammaMuStar = -1.0;
+      InvalidateStateCache();
       return true;
    }
    
@@ -763,6 +727,90 @@ void LibrationPoint::Copy(const GmatBase* orig)
 }
 
 
+//------------------------------------------------------------------------------
+// protected methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+//  Real SolveForGamma(Real muStar)
+//------------------------------------------------------------------------------
+/**
+ * Solves the quintic for the distance ratio of a collinear libration point.
+ *
+ * The solution depends only on the mass ratio and the point, so it is kept
+ * and reused until either one changes.
+ *
+ * @param <muStar> Mass ratio of the secondary body to the total.
+ *
+ * @return the distance ratio gamma.
+ */
+//------------------------------------------------------------------------------
+Real LibrationPoint::SolveForGamma(Real muStar)
+{
+   if (muStar == gammaMuStar)
+      return gammaSolution;
+   
+   Real gamma = 0.0;
+   Real gamma2 = 0.0, gamma3 = 0.0, gamma4 = 0.0, gamma5 = 0.0, gammaPrev = 0.0;
+   Real F = 0.0, Fdot = 0.0;
+   
+   // Determine initial gamma
+   if (whichPoint == wxT("L3"))  gamma = 1.0;
+   else  gamma = GmatMathUtil::Pow((muStar / (3.0 * (1.0 - muStar))),
+                                   (1.0 / 3.0));
+   
+   Integer counter = 0;
+   Real diff = 999.99;
+   while (diff > CONVERGENCE_TOLERANCE)
+   {
+      if (counter > MAX_ITERATIONS)
+         throw SolarSystemException(
+               wxT("Libration point gamma not converging."));
+      gamma2 = gamma  * gamma;
+      gamma3 = gamma2 * gamma;
+      gamma4 = gamma3 * gamma;
+      gamma5 = gamma4 * gamma;
+      if (whichPoint == wxT("L1"))
+      {
+         F = gamma5 - ((3.0 - muStar) * gamma4) + 
+             ((3.0 - 2.0 * muStar) * gamma3) - 
+             (muStar * gamma2) + (2.0 * muStar * gamma) - muStar;
+         Fdot = (5.0 * gamma4) - (4.0 * (3.0 - muStar) * gamma3) + 
+                (3.0 * (3.0 - 2.0 * muStar) * gamma2) - 
+                (2.0 * muStar * gamma) + (2.0 * muStar);
+      }
+      else if (whichPoint == wxT("L2"))
+      {
+         F = gamma5 + ((3.0 - muStar) * gamma4) + 
+             ((3.0 - 2.0 * muStar) * gamma3) - 
+             (muStar * gamma2) - (2.0 * muStar * gamma) - muStar;
+         Fdot = (5.0 * gamma4) + (4.0 * (3.0 - muStar) * gamma3) + 
+            (3.0 * (3.0 - 2.0 * muStar) * gamma2) - (2.0 * muStar * gamma) - 
+            (2.0 * muStar);
+      }
+      else  // whichPoint == wxT("L3")
+      {
+         F = gamma5 + ((2.0 + muStar) * gamma4) + 
+             ((1.0 + 2.0 * muStar) * gamma3) -
+             ((1.0 - muStar) * gamma2) - (2.0 * (1.0 - muStar) * gamma) - 
+             (1.0 - muStar);
+         Fdot = (5.0 * gamma4) + (4.0 * (2.0 +  muStar) * gamma3) + 
+            (3.0 * (1.0 +  2.0 * muStar) * gamma2) - 
+            (2.0 * (1.0 - muStar) * gamma) - (2.0 * (1.0 - muStar));
+      }
+      counter++;
+      gammaPrev = gamma;
+      gamma     = gammaPrev - (F / Fdot);
+      diff      = GmatMathUtil::Abs(gamma - gammaPrev);
+   }
+   
+   gammaMuStar   = muStar;
+   gammaSolution = gamma;
+   
+   return gamma;
+}
+
+
 //------------------------------------------------------------------------------
 // private methods
 //------------------------------------------------------------------------------
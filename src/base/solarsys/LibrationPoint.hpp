@@ -113,6 +113,13 @@ protected:
    SpacePoint  *primaryBody;
    SpacePoint  *secondaryBody;
    
+   /// Mass ratio used for the last collinear point solution
+   Real        gammaMuStar;
+   /// Converged distance ratio for gammaMuStar
+   Real        gammaSolution;
+   
+   Real        SolveForGamma(Real muStar);
+   
 private:
    
    //------------------------------------------------------------------------------
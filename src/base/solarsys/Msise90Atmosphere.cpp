@@ -198,6 +198,9 @@ bool Msise90Atmosphere::Density(Real *pos, Real *density, Real epoch,
       alt = CalculateGeodetics(&pos[i6], epoch, true);
       lst = sod/3600.0 + geoLong/15.0;
 
+      if (CachedDensity(geoHeight, geoLat, lst, epoch, density[i]))
+         continue;
+
 
       #ifdef DEBUG_GEODETICS
          MessageInterface::ShowMessage(wxT("Diffs:\n"));
@@ -378,6 +381,120 @@ void Msise90Atmosphere::GetInputs(Real epoch)
    }
 }
 
+//------------------------------------------------------------------------------
+//  bool SupportsDensityCache()
+//------------------------------------------------------------------------------
+/**
+ *  MSISE90 supports the interpolated density table.
+ *
+ *  @return true
+ */
+//------------------------------------------------------------------------------
+bool Msise90Atmosphere::SupportsDensityCache()
+{
+   return true;
+}
+
+//------------------------------------------------------------------------------
+//  Real GridDensity(Real height, Real latitude, Real localTime,
+//                   GmatEpoch when)
+//------------------------------------------------------------------------------
+/**
+ *  Evaluates MSISE90 at a point of the density table.
+ *
+ *  The longitude passed to the model is the one that has the requested local
+ *  solar time at the requested epoch.
+ *
+ *  @param height     Geodetic altitude (km)
+ *  @param latitude   Geodetic latitude (deg)
+ *  @param localTime  Local solar time (hours)
+ *  @param when       The a.1 epoch of the evaluation
+ *
+ *  @return The density in kg/m^3
+ */
+//------------------------------------------------------------------------------
+Real Msise90Atmosphere::GridDensity(Real height, Real latitude, Real localTime,
+                                    GmatEpoch when)
+{
+   // The model inputs for the current epoch are still in use by Density()
+   Real    currentSod   = sod;
+   Integer currentYd    = yd;
+   Real    currentF107  = f107;
+   Real    currentF107a = f107a;
+   Real    currentAp[7];
+   for (Integer i = 0; i < 7; ++i)
+      currentAp[i] = ap[i];
+
+   Real utcEpoch = TimeConverterUtil::Convert(when,
+         TimeConverterUtil::A1MJD, TimeConverterUtil::UTCMJD,
+         GmatTimeConstants::JD_JAN_5_1941);
+   GetInputs(utcEpoch);
+
+   Real lon = fmod((localTime - sod/3600.0) * 15.0, 360.0);
+   if (lon < 0.0)
+      lon += 360.0;
+
+   int   xyd    = yd;
+   float xsod   = (float)sod;
+   float xalt   = (float)height;
+   float xlat   = (float)latitude;
+   float xlon   = (float)lon;
+   float xlst   = (float)localTime;
+   float xf107a = (float)f107a;
+   float xf107  = (float)f107;
+   int   xmass  = 48;
+   float xap[7];
+   float xden[8];
+   float xtemp[2];
+
+   Integer j;
+   for (j = 0; j < 7; j++)
+      xap[j] = (float)ap[j];
+   for (j = 0; j < 8; j++)
+      xden[j] = 0.0;
+   xtemp[0] = xtemp[1] = 0.0;
+
+   #ifndef __SKIP_MSISE90__
+      #ifdef USE_64_BIT_LONGS
+         long int xydLong = (long int) xyd;
+         long int xmassLong = (long int) xmass;
+         gtd6_(&xydLong,&xsod,&xalt,&xlat,&xlon,&xlst,&xf107a,&xf107,&xap[0],
+               &xmassLong,&xden[0],&xtemp[0]);
+      #else
+         gtd6_(&xyd,&xsod,&xalt,&xlat,&xlon,&xlst,&xf107a,&xf107,&xap[0],&xmass,
+               &xden[0],&xtemp[0]);
+      #endif
+   #endif
+
+   sod   = currentSod;
+   yd    = currentYd;
+   f107  = currentF107;
+   f107a = currentF107a;
+   for (j = 0; j < 7; j++)
+      ap[j] = currentAp[j];
+
+   return xden[5] * 1000.0;
+}
+
+//------------------------------------------------------------------------------
+//  void GetDensityCacheInputs(GmatEpoch when, Real *inputs)
+//------------------------------------------------------------------------------
+/**
+ *  Retrieves the F10.7, average F10.7 and A_p values used at an epoch.
+ *
+ *  Density() sets these for its epoch before consulting the density table.
+ *
+ *  @param when    The a.1 epoch
+ *  @param inputs  Array of 3 elements that receives the inputs
+ */
+//------------------------------------------------------------------------------
+void Msise90Atmosphere::GetDensityCacheInputs(GmatEpoch when, Real *inputs)
+{
+   inputs[0] = f107;
+   inputs[1] = f107a;
+   inputs[2] = ap[0];
+}
+
 //------------------------------------------------------------------------------
 // GmatBase* Clone() cnst
 //------------------------------------------------------------------------------
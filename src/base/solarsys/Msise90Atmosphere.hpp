@@ -42,6 +42,7 @@ public:
                                     Integer count = 1);
 
    virtual GmatBase*       Clone() const; // inherited from GmatBase
+   virtual bool            SupportsDensityCache();
 protected:
    /// Flag to indicate if data comes from a file
    bool                    fileData;
@@ -61,6 +62,10 @@ protected:
    Integer                 mass;
 
    void                    GetInputs(Real epoch);
+   virtual Real            GridDensity(Real height, Real latitude,
+                                       Real localTime, GmatEpoch when);
+   virtual void            GetDensityCacheInputs(GmatEpoch when,
+                                       Real *inputs);
 };
 
 #endif // Msise90Atmosphere_hpp
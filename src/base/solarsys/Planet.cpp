@@ -47,6 +47,10 @@ Planet::PARAMETER_TEXT[PlanetParamCount - CelestialBodyParamCount] =
    wxT("NutationUpdateInterval"),
 };
 
+const ParameterIndex
+Planet::PARAMETER_INDEX(PARAMETER_TEXT,
+      CelestialBodyParamCount, PlanetParamCount);
+
 const Gmat::ParameterType
 Planet::PARAMETER_TYPE[PlanetParamCount - CelestialBodyParamCount] =
 {
@@ -479,11 +483,9 @@ wxString Planet::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer Planet::GetParameterID(const wxString &str) const
 {
-   for (Integer i = CelestialBodyParamCount; i < PlanetParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - CelestialBodyParamCount])
-         return i;
-   }
+   Integer id = PARAMETER_INDEX.Find(str);
+   if (id != -1)
+      return id;
    
    return CelestialBody::GetParameterID(str);
 }
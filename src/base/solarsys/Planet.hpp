@@ -110,6 +110,8 @@ protected:
    };
    
    static const wxString PARAMETER_TEXT[PlanetParamCount - CelestialBodyParamCount];
+   /// Hash index of the PARAMETER_TEXT labels, used by GetParameterID()
+   static const ParameterIndex PARAMETER_INDEX;
    
    static const Gmat::ParameterType PARAMETER_TYPE[PlanetParamCount - CelestialBodyParamCount];
    
@@ -34,8 +34,19 @@ public:
                              bool new_file, GEOPARMS *geoParms);
    FILE*   OpenSolarFluxFile(wxString filename);
    bool    CloseSolarFluxFile(FILE* tkptr);
+
+   Integer LoadSpaceWeather(FILE *tkptr);
+   Integer GetSpaceWeather(Real a1_time, GEOPARMS *geoParms) const;
+   bool    IsLoaded() const;
    
 protected:
+   /// Day number of the first entry in the space weather table
+   Integer           firstDay;
+   /// Nighttime minimum global exospheric temperature for each day; -1 if
+   /// the file has no value for the day
+   RealArray         exoTemp;
+   /// Packed 3-hour geomagnetic indices, 8 per day; -1 if not in the file
+   IntegerArray      kpIndex;
 
 private:    
 };
@@ -72,6 +72,10 @@ SolarSystem::PARAMETER_TEXT[SolarSystemParamCount - GmatBaseParamCount] =
    wxT("EphemerisUpdateInterval"),
 };
 
+const ParameterIndex
+SolarSystem::PARAMETER_INDEX(PARAMETER_TEXT,
+      GmatBaseParamCount, SolarSystemParamCount);
+
 const Gmat::ParameterType
 SolarSystem::PARAMETER_TYPE[SolarSystemParamCount - GmatBaseParamCount] =
 {
@@ -2093,11 +2097,9 @@ wxString SolarSystem::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer SolarSystem::GetParameterID(const wxString &str) const
 {
-   for (Integer i = GmatBaseParamCount; i < SolarSystemParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - GmatBaseParamCount])
-         return i;
-   }
+   Integer id = PARAMETER_INDEX.Find(str);
+   if (id != -1)
+      return id;
 
    return GmatBase::GetParameterID(str);
 }
@@ -283,6 +283,8 @@ protected:
 
    static const wxString
       PARAMETER_TEXT[SolarSystemParamCount - GmatBaseParamCount];
+   /// Hash index of the PARAMETER_TEXT labels, used by GetParameterID()
+   static const ParameterIndex PARAMETER_INDEX;
    
    static const Gmat::ParameterType
       PARAMETER_TYPE[SolarSystemParamCount - GmatBaseParamCount];
@@ -53,6 +53,10 @@ DifferentialCorrector::PARAMETER_TEXT[DifferentialCorrectorParamCount -
    wxT("DerivativeMethod")
 };
 
+const ParameterIndex
+DifferentialCorrector::PARAMETER_INDEX(PARAMETER_TEXT,
+      SolverParamCount, DifferentialCorrectorParamCount);
+
 const Gmat::ParameterType
 DifferentialCorrector::PARAMETER_TYPE[DifferentialCorrectorParamCount -
                                       SolverParamCount] =
@@ -241,11 +245,9 @@ Integer DifferentialCorrector::GetParameterID(const wxString &str) const
    }
 
    // 2. This part is kept for a future build:
-   for (Integer i = SolverParamCount; i < DifferentialCorrectorParamCount; ++i)
-   {
-      if (str == PARAMETER_TEXT[i - SolverParamCount])
-         return i;
-   }
+   Integer id = PARAMETER_INDEX.Find(str);
+   if (id != -1)
+      return id;
 
    return Solver::GetParameterID(str);
 }
@@ -130,6 +130,8 @@ protected:
 
    static const wxString    PARAMETER_TEXT[DifferentialCorrectorParamCount -
                                               SolverParamCount];
+   /// Hash index of the PARAMETER_TEXT labels, used by GetParameterID()
+   static const ParameterIndex PARAMETER_INDEX;
    static const Gmat::ParameterType
                                PARAMETER_TYPE[DifferentialCorrectorParamCount -
                                               SolverParamCount];
@@ -38,6 +38,10 @@ ExternalOptimizer::PARAMETER_TEXT[ExternalOptimizerParamCount -OptimizerParamCou
    wxT("SourceType"),
 };
 
+const ParameterIndex
+ExternalOptimizer::PARAMETER_INDEX(PARAMETER_TEXT,
+      OptimizerParamCount, ExternalOptimizerParamCount);
+
 const Gmat::ParameterType
 ExternalOptimizer::PARAMETER_TYPE[ExternalOptimizerParamCount - OptimizerParamCount] =
 {
@@ -185,11 +189,9 @@ wxString ExternalOptimizer::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer ExternalOptimizer::GetParameterID(const wxString &str) const
 {
-   for (Integer i = OptimizerParamCount; i < ExternalOptimizerParamCount; ++i)
-   {
-      if (str == PARAMETER_TEXT[i - OptimizerParamCount])
-         return i;
-   }
+   Integer id = PARAMETER_INDEX.Find(str);
+   if (id != -1)
+      return id;
 
    return Optimizer::GetParameterID(str);
 }
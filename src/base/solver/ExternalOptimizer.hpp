@@ -116,6 +116,8 @@ protected:
    
    static const wxString    PARAMETER_TEXT[ExternalOptimizerParamCount -
                                               OptimizerParamCount];
+   /// Hash index of the PARAMETER_TEXT labels, used by GetParameterID()
+   static const ParameterIndex PARAMETER_INDEX;
    static const Gmat::ParameterType
                                PARAMETER_TYPE[ExternalOptimizerParamCount -
                                               OptimizerParamCount];
@@ -43,6 +43,10 @@ Optimizer::PARAMETER_TEXT[OptimizerParamCount -SolverParamCount] =
    wxT("PlotCost"),
 };
 
+const ParameterIndex
+Optimizer::PARAMETER_INDEX(PARAMETER_TEXT,
+      SolverParamCount, OptimizerParamCount);
+
 const Gmat::ParameterType
 Optimizer::PARAMETER_TYPE[OptimizerParamCount - SolverParamCount] =
 {
@@ -483,11 +487,9 @@ wxString Optimizer::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer Optimizer::GetParameterID(const wxString &str) const
 {
-   for (Integer i = SolverParamCount; i < OptimizerParamCount; ++i)
-   {
-      if (str == PARAMETER_TEXT[i - SolverParamCount])
-         return i;
-   }
+   Integer id = PARAMETER_INDEX.Find(str);
+   if (id != -1)
+      return id;
 
    return Solver::GetParameterID(str);
 }
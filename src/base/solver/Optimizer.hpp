@@ -149,6 +149,8 @@ protected:
 
    static const wxString    PARAMETER_TEXT[OptimizerParamCount -
                                               SolverParamCount];
+   /// Hash index of the PARAMETER_TEXT labels, used by GetParameterID()
+   static const ParameterIndex PARAMETER_INDEX;
    static const Gmat::ParameterType
                                PARAMETER_TYPE[OptimizerParamCount -
                                               SolverParamCount];
@@ -54,6 +54,9 @@ Solver::PARAMETER_TEXT[SolverParamCount - GmatBaseParamCount] =
    wxT("SolverStatus")
 };
 
+const ParameterIndex
+Solver::PARAMETER_INDEX(PARAMETER_TEXT, GmatBaseParamCount, SolverParamCount);
+
 const Gmat::ParameterType
 Solver::PARAMETER_TYPE[SolverParamCount - GmatBaseParamCount] =
 {
@@ -736,11 +739,9 @@ Integer Solver::GetParameterID(const wxString &str) const
    }
    
    // 2. This part is kept for a future build:
-   for (Integer i = GmatBaseParamCount; i < SolverParamCount; ++i)
-   {
-      if (param_text == PARAMETER_TEXT[i - GmatBaseParamCount])
-         return i;
-   }
+   Integer id = PARAMETER_INDEX.Find(param_text);
+   if (id != -1)
+      return id;
    
    return GmatBase::GetParameterID(str);
 }
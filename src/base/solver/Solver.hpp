@@ -322,6 +322,8 @@ protected:
    
    static const wxString    PARAMETER_TEXT[SolverParamCount -
                                               GmatBaseParamCount];
+   /// Hash index of the PARAMETER_TEXT labels, used by GetParameterID()
+   static const ParameterIndex PARAMETER_INDEX;
    static const Gmat::ParameterType
                                PARAMETER_TYPE[SolverParamCount -
                                               GmatBaseParamCount];
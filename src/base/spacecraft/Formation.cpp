@@ -46,6 +46,10 @@ Formation::PARAMETER_TEXT[FormationParamCount - SpaceObjectParamCount] =
    wxT("CartesianState"),
 };
 
+const ParameterIndex
+Formation::PARAMETER_INDEX(PARAMETER_TEXT,
+      SpaceObjectParamCount, FormationParamCount);
+
 
 const Gmat::ParameterType
 Formation::PARAMETER_TYPE[FormationParamCount - SpaceObjectParamCount] =
@@ -350,11 +354,9 @@ wxString Formation::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer Formation::GetParameterID(const wxString &str) const
 {
-   for (Integer i = SpaceObjectParamCount; i < FormationParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - SpaceObjectParamCount])
-         return i;
-   }
+   Integer id = PARAMETER_INDEX.Find(str);
+   if (id != -1)
+      return id;
    
    return SpaceObject::GetParameterID(str);
 }
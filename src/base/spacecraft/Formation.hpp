@@ -129,6 +129,8 @@ protected:
    /// Array of supported parameters
    static const wxString
       PARAMETER_TEXT[FormationParamCount - SpaceObjectParamCount];
+   /// Hash index of the PARAMETER_TEXT labels, used by GetParameterID()
+   static const ParameterIndex PARAMETER_INDEX;
    /// Array of parameter types
    static const Gmat::ParameterType
       PARAMETER_TYPE[FormationParamCount - SpaceObjectParamCount];
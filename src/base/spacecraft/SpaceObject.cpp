@@ -37,6 +37,10 @@ const wxString SpaceObject::PARAMETER_TEXT[SpaceObjectParamCount -
       wxT("A1Epoch")
    };
 
+const ParameterIndex
+SpaceObject::PARAMETER_INDEX(PARAMETER_TEXT,
+      SpacePointParamCount, SpaceObjectParamCount);
+
 
 const Gmat::ParameterType SpaceObject::PARAMETER_TYPE[SpaceObjectParamCount - 
                                                       SpacePointParamCount] =
@@ -425,11 +429,9 @@ const Rvector3 SpaceObject::GetMJ2000Velocity(const A1Mjd &atTime)
 //------------------------------------------------------------------------------
 Integer SpaceObject::GetParameterID(const wxString &str) const
 {
-   for (Integer i = SpacePointParamCount; i < SpaceObjectParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - SpacePointParamCount])
-         return i;
-   }
+   Integer id = PARAMETER_INDEX.Find(str);
+   if (id != -1)
+      return id;
    
    return SpacePoint::GetParameterID(str);
 }
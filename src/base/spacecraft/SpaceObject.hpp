@@ -123,6 +123,8 @@ protected:
    /// Array of supported parameters
    static const wxString PARAMETER_TEXT[SpaceObjectParamCount - 
                                            SpacePointParamCount];
+   /// Hash index of the PARAMETER_TEXT labels, used by GetParameterID()
+   static const ParameterIndex PARAMETER_INDEX;
    /// Array of parameter types
    static const Gmat::ParameterType PARAMETER_TYPE[SpaceObjectParamCount - 
                                                    SpacePointParamCount];
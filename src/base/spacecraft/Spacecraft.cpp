@@ -193,6 +193,10 @@ Spacecraft::PARAMETER_LABEL[SpacecraftParamCount - SpaceObjectParamCount] =
       wxT("ModelScale"),
 };
 
+const ParameterIndex
+Spacecraft::PARAMETER_INDEX(PARAMETER_LABEL,
+      SpaceObjectParamCount, SpacecraftParamCount);
+
 const wxString Spacecraft::MULT_REP_STRINGS[EndMultipleReps - CART_X] =
 {
    // Cartesian
@@ -237,6 +241,9 @@ const wxString Spacecraft::MULT_REP_STRINGS[EndMultipleReps - CART_X] =
    wxT("MLONG"),
 };
 
+const ParameterIndex
+Spacecraft::MULT_REP_INDEX(MULT_REP_STRINGS, CART_X, EndMultipleReps);
+
 const Integer Spacecraft::ATTITUDE_ID_OFFSET = 20000;
 
 //-------------------------------------
@@ -1625,17 +1632,16 @@ Integer Spacecraft::GetParameterID(const wxString &str) const
          return UTC_GREGORIAN;
 
       // first check the multiple reps
-      Integer sz = EndMultipleReps - CART_X;
-      for (Integer ii = 0; ii < sz; ii++)
-         if (str == MULT_REP_STRINGS[ii])
-         {
-            #ifdef DEBUG_GET_REAL
-            MessageInterface::ShowMessage(
-            wxT("In SC::GetParameterID, multiple reps found!! - str = %s and id = %d\n "),
-            str.c_str(), (ii + CART_X));
-            #endif
-            return ii + CART_X;
-         }
+      Integer id = MULT_REP_INDEX.Find(str);
+      if (id != -1)
+      {
+         #ifdef DEBUG_GET_REAL
+         MessageInterface::ShowMessage(
+         wxT("In SC::GetParameterID, multiple reps found!! - str = %s and id = %d\n "),
+         str.c_str(), id);
+         #endif
+         return id;
+      }
 
       Integer retval = -1;
       if (str == wxT("Element1") || str == wxT("X") || str == wxT("SMA") || str == wxT("RadPer") ||
@@ -1677,17 +1683,15 @@ Integer Spacecraft::GetParameterID(const wxString &str) const
       #endif
       if (retval != -1) return retval;
 
-      for (Integer i = SpaceObjectParamCount; i < SpacecraftParamCount; ++i)
+      id = PARAMETER_INDEX.Find(str);
+      if (id != -1)
       {
-         if (str == PARAMETER_LABEL[i - SpaceObjectParamCount])
-         {
-            #ifdef DEBUG_SPACECRAFT_SET
-            MessageInterface::ShowMessage(
-            wxT("In SC::GetParameterID, setting id to %d for str = %s\n "),
-            i, str.c_str());
-            #endif
-            return i;
-         }
+         #ifdef DEBUG_SPACECRAFT_SET
+         MessageInterface::ShowMessage(
+         wxT("In SC::GetParameterID, setting id to %d for str = %s\n "),
+         id, str.c_str());
+         #endif
+         return id;
       }
       if (str == wxT("STM"))
          return ORBIT_STM;
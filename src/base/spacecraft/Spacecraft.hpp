@@ -305,6 +305,8 @@ protected:
    };
    // these are the corresponding strings
    static const wxString MULT_REP_STRINGS[EndMultipleReps - CART_X];
+   /// Hash index of the MULT_REP_STRINGS labels, used by GetParameterID()
+   static const ParameterIndex MULT_REP_INDEX;
 
    /// Spacecraft parameter types
    static const Gmat::ParameterType
@@ -312,6 +314,8 @@ protected:
    /// Spacecraft parameter labels
    static const wxString
                   PARAMETER_LABEL[SpacecraftParamCount - SpaceObjectParamCount];
+   /// Hash index of the PARAMETER_LABEL labels, used by GetParameterID()
+   static const ParameterIndex PARAMETER_INDEX;
 
    enum STATE_REPS
    {
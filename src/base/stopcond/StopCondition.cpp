@@ -71,6 +71,10 @@ StopCondition::PARAMETER_TEXT[StopConditionParamCount - GmatBaseParamCount] =
    wxT("Repeat"),
 };
 
+const ParameterIndex
+StopCondition::PARAMETER_INDEX(PARAMETER_TEXT,
+      GmatBaseParamCount, StopConditionParamCount);
+
 const Gmat::ParameterType
 StopCondition::PARAMETER_TYPE[StopConditionParamCount - GmatBaseParamCount] =
 {
@@ -1927,11 +1931,9 @@ Integer StopCondition::GetParameterID(const wxString &str) const
       (wxT("StopCondition::GetParameterID() str = %s\n"), str.c_str());
    #endif
    
-   for (int i=GmatBaseParamCount; i<StopConditionParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - GmatBaseParamCount])
-         return i;
-   }
+   Integer id = PARAMETER_INDEX.Find(str);
+   if (id != -1)
+      return id;
    
    return GmatBase::GetParameterID(str);
 }
@@ -241,6 +241,8 @@ protected:
       PARAMETER_TYPE[StopConditionParamCount - GmatBaseParamCount];
    static const wxString
       PARAMETER_TEXT[StopConditionParamCount - GmatBaseParamCount];
+   /// Hash index of the PARAMETER_TEXT labels, used by GetParameterID()
+   static const ParameterIndex PARAMETER_INDEX;
 
    bool CheckOnPeriapsis();
    bool CheckOnApoapsis();
@@ -43,6 +43,7 @@
 //#define DEBUG_EPHEMFILE_INIT
 //#define DEBUG_EPHEMFILE_OPEN
 //#define DEBUG_EPHEMFILE_SPICE
+//#define DEBUG_EPHEMFILE_BINARY
 //#define DEBUG_EPHEMFILE_CCSDS
 //#define DEBUG_EPHEMFILE_BUFFER
 //#define DEBUG_EPHEMFILE_TIME
@@ -97,6 +98,10 @@ EphemerisFile::PARAMETER_TEXT[EphemerisFileParamCount - SubscriberParamCount] =
    wxT("FileName"),              // FILE_NAME - deprecated
 };
 
+const ParameterIndex
+EphemerisFile::PARAMETER_INDEX(PARAMETER_TEXT,
+      SubscriberParamCount, EphemerisFileParamCount);
+
 const Gmat::ParameterType
 EphemerisFile::PARAMETER_TYPE[EphemerisFileParamCount - SubscriberParamCount] =
 {
@@ -189,6 +194,7 @@ EphemerisFile::EphemerisFile(const wxString &name, const wxString &type) :
    // CCSDS-AEM not allowed in 2010 release (bug 2219)
 //   fileFormatList.push_back(wxT("CCSDS-AEM"));
    fileFormatList.push_back(wxT("SPK"));
+   fileFormatList.push_back(wxT("Binary"));
    
    epochFormatList.clear();
    epochFormatList.push_back(wxT("UTCGregorian"));
@@ -271,8 +277,7 @@ EphemerisFile::~EphemerisFile()
    }
    #endif
    
-   dstream.flush();
-   dstream.close();
+   dstream.Close();
    
    #ifdef DEBUG_EPHEMFILE
    MessageInterface::ShowMessage
@@ -491,7 +496,8 @@ void EphemerisFile::ValidateParameters()
    {
       // check for FileFormat and StateType
       if ((fileFormat == wxT("CCSDS-OEM") && stateType == wxT("Quaternion")) ||
-          (fileFormat == wxT("CCSDS-AEM") && stateType == wxT("Cartesian")))
+          (fileFormat == wxT("CCSDS-AEM") && stateType == wxT("Cartesian")) ||
+          (fileFormat == wxT("Binary") && stateType == wxT("Quaternion")))
          throw SubscriberException
             (wxT("FileFormat \"") + fileFormat + wxT("\" and StateType ") + wxT("\"") + stateType +
              wxT("\" does not match for the EphemerisFile \"") + GetName() + wxT("\""));
@@ -580,6 +586,8 @@ bool EphemerisFile::Initialize()
       fileType = SPK_ORBIT;
    else if (fileFormat == wxT("SPK") && stateType == wxT("Quaternion"))
       fileType = SPK_ATTITUDE;
+   else if (fileFormat == wxT("Binary") && stateType == wxT("Cartesian"))
+      fileType = BINARY_ORBIT;
    else
       throw SubscriberException
          (wxT("FileFormat \"") + fileFormat + wxT("\" is not valid"));
@@ -627,7 +635,7 @@ bool EphemerisFile::Initialize()
    // Determine output coordinate system, set to boolean to avoid string comparison
    // We don't need conversion for SPK_ORBIT. SpiceOrbitKernelWriter assumes it is in
    // J2000Eq frame for now
-   if (fileType == CCSDS_OEM &&
+   if ((fileType == CCSDS_OEM || fileType == BINARY_ORBIT) &&
        theDataCoordSystem->GetName() != outCoordSystemName)
       writeDataInDataCS = false;
    
@@ -778,14 +786,12 @@ wxString EphemerisFile::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer EphemerisFile::GetParameterID(const wxString &str) const
 {
-   for (Integer i = SubscriberParamCount; i < EphemerisFileParamCount; i++)
+   Integer id = PARAMETER_INDEX.Find(str);
+   if (id != -1)
    {
-      if (str == PARAMETER_TEXT[i - SubscriberParamCount])
-      {
-         if (i == FILE_NAME)
-            WriteDeprecatedMessage(i);
-         return i;
-      }
+      if (id == FILE_NAME)
+         WriteDeprecatedMessage(id);
+      return id;
    }
    return Subscriber::GetParameterID(str);
 }
@@ -1102,7 +1108,7 @@ bool EphemerisFile::SetStringParameter(const Integer id, const wxString &value)
          fileFormat = value;
 
          // Code to link interpolator selection to file type
-         if (fileFormat == wxT("CCSDS-OEM"))
+         if (fileFormat == wxT("CCSDS-OEM") || fileFormat == wxT("Binary"))
             interpolatorName = wxT("Lagrange");
          if (fileFormat == wxT("SPK"))
             interpolatorName = wxT("Hermite");
@@ -1166,12 +1172,13 @@ bool EphemerisFile::SetStringParameter(const Integer id, const wxString &value)
    // Interpolator is now set along with file format (bug 2219); if the parm is
    // passed in, just ensure compatibility
    case INTERPOLATOR:
-      if (fileFormat == wxT("CCSDS-OEM"))
+      if (fileFormat == wxT("CCSDS-OEM") || fileFormat == wxT("Binary"))
       {
          if (value != wxT("Lagrange"))
             throw SubscriberException(wxT("Cannot set interpolator \"") + value +
                   wxT("\" on the EphemerisFile named \"") + instanceName +
-                  wxT("\"; CCSDS-OEM ephemerides require Lagrange interpolators"));
+                  wxT("\"; ") + fileFormat +
+                  wxT(" ephemerides require Lagrange interpolators"));
       }
       else if (fileFormat == wxT("SPK"))
       {
@@ -1478,8 +1485,8 @@ bool EphemerisFile::OpenEphemerisFile()
    
    #if !defined(__USE_DATAFILE__) || defined(DEBUG_EPHEMFILE_TEXT)
    // Close the stream if it is open
-   if (dstream.is_open())
-      dstream.close();
+   if (dstream.IsOpen())
+      dstream.Close();
    
    wxString debugFileName;
    bool openDebugFile = false;
@@ -1504,8 +1511,7 @@ bool EphemerisFile::OpenEphemerisFile()
    
    if (openDebugFile)
    {
-      dstream.open(debugFileName.char_str());
-      if (dstream.is_open())
+      if (dstream.Open(debugFileName))
       {
          retval = true;
          #ifdef DEBUG_EPHEMFILE_TEXT
@@ -1535,6 +1541,13 @@ bool EphemerisFile::OpenEphemerisFile()
          return false;
    }
    
+   // Open binary output file
+   if (fileType == BINARY_ORBIT)
+   {
+      if (!OpenBinaryEphemerisFile())
+         return false;
+   }
+   
    #ifdef DEBUG_EPHEMFILE_OPEN
    MessageInterface::ShowMessage
       (wxT("EphemerisFile::OpenEphemerisFile() returning %d\n"), retval);
@@ -2001,11 +2014,7 @@ void EphemerisFile::GetAttitude()
 void EphemerisFile::WriteAttitude()
 {
    GetAttitude();
-   
-   char strBuff[200];
-   sprintf(strBuff, "%16.10f  %19.15f  %19.15f  %19.15f  %19.15f\n",
-           attEpoch, attQuat[0], attQuat[1], attQuat[2], attQuat[3]);
-   dstream << strBuff;
+   dstream.WriteAttitudeRecord(attEpoch, attQuat);
 }
 
 
@@ -2039,7 +2048,8 @@ void EphemerisFile::FinishUpWriting()
          (wxT("   It is not finalized yet, so trying to write the remainder of data\n"));
       #endif
       
-      if (fileType == CCSDS_OEM || fileType == CCSDS_AEM)
+      if (fileType == CCSDS_OEM || fileType == CCSDS_AEM ||
+          fileType == BINARY_ORBIT)
       {
          if (interpolator != NULL)
          {
@@ -2071,7 +2081,7 @@ void EphemerisFile::FinishUpWriting()
             }
             
             // Write last data received if not written yet(Do attitude later)
-            if (fileType == CCSDS_OEM && useStepSize)
+            if ((fileType == CCSDS_OEM || fileType == BINARY_ORBIT) && useStepSize)
             {
                if (currEpochInSecs > lastEpochWrote + 1.0e-6)
                {
@@ -2092,6 +2102,19 @@ void EphemerisFile::FinishUpWriting()
          if (fileType == CCSDS_AEM)
             WriteString(wxT("DATA_STOP\n"));
          #endif
+         
+         // Write the index so the file can be read before the run ends
+         if (fileType == BINARY_ORBIT)
+         {
+            try
+            {
+               binaryWriter.Flush();
+            }
+            catch (BaseException &e)
+            {
+               throw SubscriberException(e.GetFullMessage());
+            }
+         }
       }
       else if (fileType == SPK_ORBIT)
       {
@@ -2112,6 +2135,12 @@ void EphemerisFile::FinishUpWriting()
          }
       }
       
+      // Make sure the text written in the background is in the file
+      if (!dstream.Sync())
+         MessageInterface::ShowMessage
+            (wxT("*** WARNING *** Failed to write all data to the ephemeris ")
+             wxT("file \"%s\"\n"), fileName.c_str());
+      
       isFinalized = true;
    }
    
@@ -2373,9 +2402,8 @@ wxString EphemerisFile::ToString(const StringArray &strList)
 //------------------------------------------------------------------------------
 void EphemerisFile::WriteString(const wxString &str)
 {
-   // For now write it text file
-   dstream << str;
-   dstream.flush();
+   // For now write it text file; the writer keeps it in order with the data
+   dstream.WriteText(str);
 }
 
 
@@ -2449,14 +2477,17 @@ void EphemerisFile::BufferOrbitData(Real epochInDays, const Real state[6])
       {
          WriteCcsdsOrbitDataSegment();
       }
-      else if (fileType == SPK_ORBIT)
+      else if (fileType == SPK_ORBIT || fileType == BINARY_ORBIT)
       {
          // Save last data to become first data of next segment
          A1Mjd *a1mjd  = new A1Mjd(*a1MjdArray.back());
          Rvector6 *rv6 = new Rvector6(*stateArray.back());
          
          // Write a segment and delete data array pointers
-         WriteSpkOrbitDataSegment();
+         if (fileType == SPK_ORBIT)
+            WriteSpkOrbitDataSegment();
+         else
+            WriteBinaryOrbitDataSegment();
          
          // Add saved data to arrays
          a1MjdArray.push_back(a1mjd);
@@ -2650,6 +2681,12 @@ void EphemerisFile::WriteCcsdsOrbitDataSegment()
       return;
    }
    
+   if (fileType == BINARY_ORBIT)
+   {
+      WriteBinaryOrbitDataSegment();
+      return;
+   }
+   
    Real metaDataStart = (a1MjdArray.front())->GetReal();
    Real metaDataStop  = (a1MjdArray.back())->GetReal();
    metaDataStartStr = ToUtcGregorian(metaDataStart, true, 2);
@@ -2884,8 +2921,7 @@ void EphemerisFile::WriteSpkOrbitDataSegment()
       {
          DeleteOrbitData();
          spkWriteFailed = true;
-         dstream.flush();
-         dstream.close();
+         dstream.Close();
          #ifdef DEBUG_EPHEMFILE_SPICE
          MessageInterface::ShowMessage(wxT("**** ERROR **** ") + e.GetFullMessage());
          #endif
@@ -3033,6 +3069,67 @@ void EphemerisFile::FinalizeSpkFile()
 }
 
 
+//------------------------------------------------------------------------------
+// bool OpenBinaryEphemerisFile()
+//------------------------------------------------------------------------------
+/**
+ * Creates the binary ephemeris file.  The header records the spacecraft name
+ * and the origin and axes of the output coordinate system.
+ */
+//------------------------------------------------------------------------------
+bool EphemerisFile::OpenBinaryEphemerisFile()
+{
+   wxString origin = wxT("UNKNOWN");
+   wxString csType = wxT("UNKNOWN");
+   
+   if (outCoordSystem)
+   {
+      csType = outCoordSystem->GetStringParameter(wxT("Axes"));
+      origin = outCoordSystem->GetStringParameter(wxT("Origin"));
+      if (origin == wxT("Luna"))
+         origin = wxT("Moon");
+   }
+   
+   try
+   {
+      binaryWriter.Open(fileName, spacecraftName, origin, csType);
+   }
+   catch (BaseException &e)
+   {
+      MessageInterface::ShowMessage(e.GetFullMessage() + wxT("\n"));
+      return false;
+   }
+   
+   #ifdef DEBUG_EPHEMFILE_OPEN
+   MessageInterface::ShowMessage
+      (wxT("   '%s' is opened for binary output, origin='%s', axes='%s'\n"),
+       fileName.c_str(), origin.c_str(), csType.c_str());
+   #endif
+   
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// void WriteBinaryOrbitDataSegment()
+//------------------------------------------------------------------------------
+/**
+ * Writes the buffered states as a binary segment and clears the buffer.
+ */
+//------------------------------------------------------------------------------
+void EphemerisFile::WriteBinaryOrbitDataSegment()
+{
+   #ifdef DEBUG_EPHEMFILE_BINARY
+   MessageInterface::ShowMessage
+      (wxT("=====> WriteBinaryOrbitDataSegment() writing %d orbit data points\n"),
+       a1MjdArray.size());
+   #endif
+   
+   binaryWriter.WriteSegment(a1MjdArray, stateArray);
+   DeleteOrbitData();
+}
+
+
 //------------------------------------------------------------------------------
 // RealArray::iterator FindEpochOnWaiting(Real epochInSecs, const wxString &msg = wxT(""))
 //------------------------------------------------------------------------------
@@ -3212,10 +3309,9 @@ void EphemerisFile::DebugWriteOrbit(const wxString &msg, Real epoch,
    Rvector6 inState(state);
    Rvector6 outState(state);
    
-   wxString epochStr = ToUtcGregorian(reqEpochInDays, true, 2);
-   
    if (logOnly)
    {
+      wxString epochStr = ToUtcGregorian(reqEpochInDays, true, 2);
       MessageInterface::ShowMessage
          (wxT("%s\n%s\n%24.14f  %24.14f  %24.14f\n%19.16f  %19.16f  %19.16f\n"),
           msg.c_str(), epochStr.c_str(), outState[0], outState[1], outState[2],
@@ -3223,12 +3319,8 @@ void EphemerisFile::DebugWriteOrbit(const wxString &msg, Real epoch,
    }
    else
    {
-      char strBuff[200];
-      sprintf(strBuff, "%s  %24.14f  %24.14f  %24.14f  %19.16f  %19.16f  %19.16f\n",
-              (char *)(epochStr.char_str()), outState[0], outState[1], outState[2], outState[3],
-              outState[4], outState[5]);
-      dstream << strBuff;
-      dstream.flush();
+      // The writer converts and formats the UTC epochs a block at a time
+      dstream.WriteOrbitRecord(reqEpochInDays, outState.GetDataVector());
    }
 }
 
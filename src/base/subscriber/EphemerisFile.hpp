@@ -24,8 +24,8 @@
 #include "CoordinateSystem.hpp"
 #include "CoordinateConverter.hpp"
 #include "Interpolator.hpp"
-#include <iostream>
-#include <fstream>
+#include "EphemerisWriter.hpp"
+#include "BinaryEphemerisWriter.hpp"
 
 class SpiceOrbitKernelWriter;
 
@@ -97,7 +97,7 @@ protected:
    
    enum FileType
    {
-      CCSDS_OEM, CCSDS_AEM, SPK_ORBIT, SPK_ATTITUDE,
+      CCSDS_OEM, CCSDS_AEM, SPK_ORBIT, SPK_ATTITUDE, BINARY_ORBIT,
    };
    
    Spacecraft             *spacecraft;
@@ -175,8 +175,10 @@ protected:
    /// for maneuver handling
    ObjectArray maneuversHandled;
       
-   /// output data stream
-   std::ofstream      dstream;
+   /// output text writer; formats and writes records in the background
+   EphemerisWriter    dstream;
+   /// output writer for the binary format
+   BinaryEphemerisWriter binaryWriter;
    
    /// Available file format list
    static StringArray fileFormatList;   
@@ -260,6 +262,10 @@ protected:
    void         WriteSpkComments(const wxString &comments);
    void         FinalizeSpkFile();
    
+   // Binary file writing
+   bool         OpenBinaryEphemerisFile();
+   void         WriteBinaryOrbitDataSegment();
+   
    // Epoch handling
    RealArray::iterator
                 FindEpochOnWaiting(Real epochInSecs, const wxString &msg);
@@ -315,6 +321,8 @@ protected:
    
    static const wxString
       PARAMETER_TEXT[EphemerisFileParamCount - SubscriberParamCount];
+   /// Hash index of the PARAMETER_TEXT labels, used by GetParameterID()
+   static const ParameterIndex PARAMETER_INDEX;
    static const Gmat::ParameterType
       PARAMETER_TYPE[EphemerisFileParamCount - SubscriberParamCount];
    
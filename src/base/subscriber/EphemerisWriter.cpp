@@ -0,0 +1,410 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                                  EphemerisWriter
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002-2011 United States Government as represented by the
+// Administrator of The National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Created: 2026/10/18
+//
+/**
+ * Implements the block buffered text writer used by EphemerisFile.
+ */
+//------------------------------------------------------------------------------
+
+#include "EphemerisWriter.hpp"
+#include "TimeSystemConverter.hpp"   // for Convert(), FormatMjdToGregorian()
+#include <cstdio>                    // for sprintf()
+
+//#define DEBUG_EPHEMWRITER
+
+#ifdef DEBUG_EPHEMWRITER
+#include "MessageInterface.hpp"
+#endif
+
+
+//------------------------------------------------------------------------------
+// EphemerisWriter()
+//------------------------------------------------------------------------------
+EphemerisWriter::EphemerisWriter() :
+   currentBlock   (NULL),
+   writerThread   (NULL),
+   blockQueued    (queueMutex),
+   blockWritten   (queueMutex),
+   isClosing      (false),
+   isWriting      (false),
+   writeFailed    (false)
+{
+}
+
+
+//------------------------------------------------------------------------------
+// ~EphemerisWriter()
+//------------------------------------------------------------------------------
+EphemerisWriter::~EphemerisWriter()
+{
+   Close();
+}
+
+
+//------------------------------------------------------------------------------
+// bool Open(const wxString &fileName)
+//------------------------------------------------------------------------------
+/**
+ * Opens the output file and starts the writer thread.
+ *
+ * @param fileName  The file to write
+ *
+ * @return true if the file was opened
+ */
+//------------------------------------------------------------------------------
+bool EphemerisWriter::Open(const wxString &fileName)
+{
+   Close();
+
+   outStream.open(fileName.char_str());
+   if (!outStream.is_open())
+      return false;
+
+   isClosing = false;
+   writerThread = new WriterThread(this);
+   if (writerThread->Create() != wxTHREAD_NO_ERROR ||
+       writerThread->Run() != wxTHREAD_NO_ERROR)
+   {
+      // Blocks are written by the caller instead
+      delete writerThread;
+      writerThread = NULL;
+   }
+
+   #ifdef DEBUG_EPHEMWRITER
+   MessageInterface::ShowMessage
+      (wxT("EphemerisWriter::Open() opened '%s', writerThread=<%p>\n"),
+       fileName.c_str(), writerThread);
+   #endif
+
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// bool IsOpen() const
+//------------------------------------------------------------------------------
+bool EphemerisWriter::IsOpen() const
+{
+   return outStream.is_open();
+}
+
+
+//------------------------------------------------------------------------------
+// bool Close()
+//------------------------------------------------------------------------------
+/**
+ * Writes everything still buffered, stops the writer thread and closes the
+ * file.
+ *
+ * @return false if any block failed to write since the file was opened
+ */
+//------------------------------------------------------------------------------
+bool EphemerisWriter::Close()
+{
+   if (!outStream.is_open())
+      return true;
+
+   SubmitBlock();
+   StopWriter();
+
+   outStream.flush();
+   outStream.close();
+
+   bool retval = !writeFailed;
+   writeFailed = false;
+   return retval;
+}
+
+
+//------------------------------------------------------------------------------
+// bool Sync()
+//------------------------------------------------------------------------------
+/**
+ * Waits until everything written so far is in the file.
+ *
+ * @return false if any block failed to write since the file was opened
+ */
+//------------------------------------------------------------------------------
+bool EphemerisWriter::Sync()
+{
+   if (!outStream.is_open())
+      return true;
+
+   SubmitBlock();
+
+   if (writerThread != NULL)
+   {
+      wxMutexLocker lock(queueMutex);
+      while (!queuedBlocks.empty() || isWriting)
+         blockWritten.Wait();
+      outStream.flush();
+   }
+   else
+      outStream.flush();
+
+   return !writeFailed;
+}
+
+
+//------------------------------------------------------------------------------
+// void WriteText(const wxString &text)
+//------------------------------------------------------------------------------
+/**
+ * Writes text after the records written so far.
+ */
+//------------------------------------------------------------------------------
+void EphemerisWriter::WriteText(const wxString &text)
+{
+   if (!outStream.is_open())
+      return;
+
+   if (currentBlock != NULL && !currentBlock->types.empty())
+      SubmitBlock();
+
+   if (currentBlock == NULL)
+      currentBlock = new OutputBlock;
+
+   currentBlock->text += (const char*)text.mb_str();
+}
+
+
+//------------------------------------------------------------------------------
+// void WriteOrbitRecord(Real a1Mjd, const Real state[6])
+//------------------------------------------------------------------------------
+/**
+ * Writes one orbit record; the epoch is written in UTC Gregorian format.
+ *
+ * The epochs of a block are converted to UTC together when it is submitted.
+ *
+ * @param a1Mjd   The A.1 modified Julian epoch of the state
+ * @param state   The Cartesian state
+ */
+//------------------------------------------------------------------------------
+void EphemerisWriter::WriteOrbitRecord(Real a1Mjd, const Real state[6])
+{
+   if (!outStream.is_open())
+      return;
+
+   if (currentBlock == NULL)
+      currentBlock = new OutputBlock;
+
+   if (currentBlock->types.empty())
+      currentBlock->values.reserve(BLOCK_SIZE * RECORD_SIZE);
+
+   currentBlock->types.push_back(ORBIT_RECORD);
+   currentBlock->values.push_back(a1Mjd);
+   for (Integer i = 0; i < 6; ++i)
+      currentBlock->values.push_back(state[i]);
+
+   if (currentBlock->types.size() >= BLOCK_SIZE)
+      SubmitBlock();
+}
+
+
+//------------------------------------------------------------------------------
+// void WriteAttitudeRecord(Real epoch, const Real quat[4])
+//------------------------------------------------------------------------------
+/**
+ * Writes one attitude record.
+ *
+ * @param epoch  The epoch of the attitude, written as a number
+ * @param quat   The attitude quaternion
+ */
+//------------------------------------------------------------------------------
+void EphemerisWriter::WriteAttitudeRecord(Real epoch, const Real quat[4])
+{
+   if (!outStream.is_open())
+      return;
+
+   if (currentBlock == NULL)
+      currentBlock = new OutputBlock;
+
+   currentBlock->types.push_back(ATTITUDE_RECORD);
+   currentBlock->values.push_back(epoch);
+   for (Integer i = 0; i < RECORD_SIZE - 1; ++i)
+      currentBlock->values.push_back(i < 4 ? quat[i] : 0.0);
+
+   if (currentBlock->types.size() >= BLOCK_SIZE)
+      SubmitBlock();
+}
+
+
+//------------------------------------------------------------------------------
+// void SubmitBlock()
+//------------------------------------------------------------------------------
+/**
+ * Hands the current block to the writer thread, waiting if too many blocks
+ * are already queued.
+ */
+//------------------------------------------------------------------------------
+void EphemerisWriter::SubmitBlock()
+{
+   if (currentBlock == NULL)
+      return;
+
+   OutputBlock *block = currentBlock;
+   currentBlock = NULL;
+
+   // Convert the orbit epochs of the block from A.1 to UTC in one pass
+   RealArray epochs;
+   Integer count = block->types.size();
+   for (Integer i = 0; i < count; ++i)
+      if (block->types[i] == ORBIT_RECORD)
+         epochs.push_back(block->values[i * RECORD_SIZE]);
+
+   if (!epochs.empty())
+   {
+      TimeConverterUtil::Convert(epochs, epochs, TimeConverterUtil::A1MJD,
+            TimeConverterUtil::UTCMJD, GmatTimeConstants::JD_JAN_5_1941);
+      for (Integer i = 0, j = 0; i < count; ++i)
+         if (block->types[i] == ORBIT_RECORD)
+            block->values[i * RECORD_SIZE] = epochs[j++];
+   }
+
+   if (writerThread == NULL)
+   {
+      WriteBlock(block);
+      delete block;
+      return;
+   }
+
+   wxMutexLocker lock(queueMutex);
+   while (queuedBlocks.size() >= MAX_QUEUED_BLOCKS)
+      blockWritten.Wait();
+   queuedBlocks.push_back(block);
+   blockQueued.Signal();
+}
+
+
+//------------------------------------------------------------------------------
+// void WriteBlock(OutputBlock *block)
+//------------------------------------------------------------------------------
+/**
+ * Formats a block and writes it to the file.  Runs on the writer thread, so
+ * it uses only the block and the stream.
+ */
+//------------------------------------------------------------------------------
+void EphemerisWriter::WriteBlock(OutputBlock *block)
+{
+   std::string output;
+   output.reserve(block->text.size() + block->types.size() * 128);
+   output = block->text;
+
+   char record[256];
+   char epochText[TimeConverterUtil::GREGORIAN_BUFFER_SIZE];
+   wxChar epochBuffer[TimeConverterUtil::GREGORIAN_BUFFER_SIZE];
+
+   for (UnsignedInt i = 0; i < block->types.size(); ++i)
+   {
+      const Real *value = &block->values[i * RECORD_SIZE];
+      if (block->types[i] == ORBIT_RECORD)
+      {
+         // Same epoch text as the UTCGregorian conversion EphemerisFile used
+         // before, including its variable length seconds
+         Integer length =
+            TimeConverterUtil::FormatMjdToGregorian(value[0], epochBuffer, 2);
+         for (Integer j = 0; j <= length; ++j)
+            epochText[j] = (char)epochBuffer[j];
+
+         sprintf(record, "%s  %24.14f  %24.14f  %24.14f  %19.16f  %19.16f  %19.16f\n",
+                 epochText, value[1], value[2], value[3], value[4], value[5],
+                 value[6]);
+      }
+      else
+      {
+         sprintf(record, "%16.10f  %19.15f  %19.15f  %19.15f  %19.15f\n",
+                 value[0], value[1], value[2], value[3], value[4]);
+      }
+      output += record;
+   }
+
+   outStream.write(output.data(), output.size());
+   if (!outStream)
+      writeFailed = true;
+}
+
+
+//------------------------------------------------------------------------------
+// void RunWriter()
+//------------------------------------------------------------------------------
+/**
+ * Writes queued blocks in order until the writer is closed.
+ */
+//------------------------------------------------------------------------------
+void EphemerisWriter::RunWriter()
+{
+   queueMutex.Lock();
+   while (true)
+   {
+      while (queuedBlocks.empty() && !isClosing)
+         blockQueued.Wait();
+
+      if (queuedBlocks.empty())
+         break;
+
+      OutputBlock *block = queuedBlocks.front();
+      queuedBlocks.pop_front();
+      isWriting = true;
+      queueMutex.Unlock();
+
+      WriteBlock(block);
+      delete block;
+
+      queueMutex.Lock();
+      isWriting = false;
+      blockWritten.Broadcast();
+   }
+   queueMutex.Unlock();
+}
+
+
+//------------------------------------------------------------------------------
+// void StopWriter()
+//------------------------------------------------------------------------------
+/**
+ * Lets the writer thread finish the queued blocks and waits for it to exit.
+ */
+//------------------------------------------------------------------------------
+void EphemerisWriter::StopWriter()
+{
+   if (writerThread == NULL)
+      return;
+
+   queueMutex.Lock();
+   isClosing = true;
+   blockQueued.Signal();
+   queueMutex.Unlock();
+
+   writerThread->Wait();
+   delete writerThread;
+   writerThread = NULL;
+}
+
+
+//------------------------------------------------------------------------------
+// WriterThread(EphemerisWriter *owner)
+//------------------------------------------------------------------------------
+EphemerisWriter::WriterThread::WriterThread(EphemerisWriter *owner) :
+   wxThread (wxTHREAD_JOINABLE),
+   writer   (owner)
+{
+}
+
+
+//------------------------------------------------------------------------------
+// ExitCode Entry()
+//------------------------------------------------------------------------------
+wxThread::ExitCode EphemerisWriter::WriterThread::Entry()
+{
+   writer->RunWriter();
+   return 0;
+}
@@ -0,0 +1,105 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                                  EphemerisWriter
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002-2011 United States Government as represented by the
+// Administrator of The National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Created: 2026/10/18
+//
+/**
+ * Declares the block buffered text writer used by EphemerisFile.
+ */
+//------------------------------------------------------------------------------
+#ifndef EphemerisWriter_hpp
+#define EphemerisWriter_hpp
+
+#include "gmatdefs.hpp"
+#include <wx/thread.h>
+#include <fstream>
+#include <deque>
+#include <string>
+
+/**
+ * Streams text ephemeris records to a file from a background thread.
+ *
+ * Records are passed in as numbers and collected into blocks.  Each full
+ * block is handed to a writer thread, which formats the records and writes
+ * the block with one call, so formatting and disk output overlap with
+ * propagation.  Text written between records keeps its place in the file.
+ * If the thread cannot be started, blocks are written by the calling thread.
+ */
+class GMAT_API EphemerisWriter
+{
+public:
+   EphemerisWriter();
+   ~EphemerisWriter();
+
+   bool        Open(const wxString &fileName);
+   bool        IsOpen() const;
+   bool        Close();
+   bool        Sync();
+
+   void        WriteText(const wxString &text);
+   void        WriteOrbitRecord(Real a1Mjd, const Real state[6]);
+   void        WriteAttitudeRecord(Real epoch, const Real quat[4]);
+
+protected:
+   /// Number of records collected before a block is handed off
+   static const UnsignedInt BLOCK_SIZE = 2000;
+   /// Number of blocks allowed to wait for the writer thread
+   static const UnsignedInt MAX_QUEUED_BLOCKS = 8;
+   /// Number of values stored per record
+   static const Integer     RECORD_SIZE = 7;
+
+   enum RecordType
+   {
+      ORBIT_RECORD,
+      ATTITUDE_RECORD
+   };
+
+   /// Text and records written together, in order: text first
+   struct OutputBlock
+   {
+      std::string text;
+      IntegerArray types;
+      RealArray   values;
+   };
+
+   class WriterThread : public wxThread
+   {
+   public:
+      WriterThread(EphemerisWriter *owner);
+   protected:
+      virtual ExitCode Entry();
+      EphemerisWriter *writer;
+   };
+
+   std::ofstream  outStream;
+   OutputBlock    *currentBlock;
+   std::deque<OutputBlock*> queuedBlocks;
+   WriterThread   *writerThread;
+   wxMutex        queueMutex;
+   /// Signaled when a block is queued or the writer is closing
+   wxCondition    blockQueued;
+   /// Signaled when the writer thread finishes a block
+   wxCondition    blockWritten;
+   bool           isClosing;
+   bool           isWriting;
+   bool           writeFailed;
+
+   void           SubmitBlock();
+   void           WriteBlock(OutputBlock *block);
+   void           RunWriter();
+   void           StopWriter();
+
+private:
+   // Writers own a file and a thread, so they are not copied
+   EphemerisWriter(const EphemerisWriter&);
+   EphemerisWriter& operator=(const EphemerisWriter&);
+};
+
+#endif // EphemerisWriter_hpp
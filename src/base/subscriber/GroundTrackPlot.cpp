@@ -51,7 +51,11 @@ GroundTrackPlot::PARAMETER_TEXT[GroundTrackPlotParamCount - OrbitPlotParamCount]
    wxT("CentralBody"),
    wxT("TextureMap"),
    wxT("ShowFootPrints"),
-}; 
+};
+
+const ParameterIndex
+GroundTrackPlot::PARAMETER_INDEX(PARAMETER_TEXT,
+      OrbitPlotParamCount, GroundTrackPlotParamCount);
 
 
 const Gmat::ParameterType
@@ -477,11 +481,9 @@ wxString GroundTrackPlot::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer GroundTrackPlot::GetParameterID(const wxString &str) const
 {
-   for (int i=OrbitPlotParamCount; i<GroundTrackPlotParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - OrbitPlotParamCount])
-         return i;
-   }
+   Integer id = PARAMETER_INDEX.Find(str);
+   if (id != -1)
+      return id;
    
    return OrbitPlot::GetParameterID(str);
 }
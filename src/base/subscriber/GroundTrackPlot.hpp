@@ -109,6 +109,8 @@ public:
       PARAMETER_TYPE[GroundTrackPlotParamCount - OrbitPlotParamCount];
    static const wxString
       PARAMETER_TEXT[GroundTrackPlotParamCount - OrbitPlotParamCount];
+   /// Hash index of the PARAMETER_TEXT labels, used by GetParameterID()
+   static const ParameterIndex PARAMETER_INDEX;
    
    // for GUI population
    static StringArray footPrintOptions;
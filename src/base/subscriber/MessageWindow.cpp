@@ -29,7 +29,11 @@ const wxString
 MessageWindow::PARAMETER_TEXT[MessageWindowParamCount - SubscriberParamCount] =
 {
    wxT("Precision")
-}; 
+};
+
+const ParameterIndex
+MessageWindow::PARAMETER_INDEX(PARAMETER_TEXT,
+      SubscriberParamCount, MessageWindowParamCount);
 
 const Gmat::ParameterType
 MessageWindow::PARAMETER_TYPE[MessageWindowParamCount - SubscriberParamCount] =
@@ -143,11 +147,9 @@ wxString MessageWindow::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer MessageWindow::GetParameterID(const wxString &str) const
 {
-   for (int i=SubscriberParamCount; i<MessageWindowParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - SubscriberParamCount])
-         return i;
-   }
+   Integer id = PARAMETER_INDEX.Find(str);
+   if (id != -1)
+      return id;
    
    return Subscriber::GetParameterID(str);
 }
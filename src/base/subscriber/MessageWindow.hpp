@@ -59,6 +59,8 @@ protected:
       PARAMETER_TYPE[MessageWindowParamCount - SubscriberParamCount];
    static const wxString
       PARAMETER_TEXT[MessageWindowParamCount - SubscriberParamCount];
+   /// Hash index of the PARAMETER_TEXT labels, used by GetParameterID()
+   static const ParameterIndex PARAMETER_INDEX;
    
    virtual bool Distribute(Integer len);
    virtual bool Distribute(const Real * dat, Integer len);
@@ -91,7 +91,11 @@ OpenGlPlot::PARAMETER_TEXT[OpenGlPlotParamCount - SubscriberParamCount] =
         wxT("MinFOV"),
         wxT("MaxFOV"),
         wxT("InitialFOV"),
-}; 
+};
+
+const ParameterIndex
+OpenGlPlot::PARAMETER_INDEX(PARAMETER_TEXT,
+      SubscriberParamCount, OpenGlPlotParamCount);
 
 
 const Gmat::ParameterType
@@ -1167,11 +1171,9 @@ wxString OpenGlPlot::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer OpenGlPlot::GetParameterID(const wxString &str) const
 {
-   for (int i=SubscriberParamCount; i<OpenGlPlotParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - SubscriberParamCount])
-         return i;
-   }
+   Integer id = PARAMETER_INDEX.Find(str);
+   if (id != -1)
+      return id;
    
    return Subscriber::GetParameterID(str);
 }
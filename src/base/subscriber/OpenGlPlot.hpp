@@ -295,6 +295,8 @@ protected:
       PARAMETER_TYPE[OpenGlPlotParamCount - SubscriberParamCount];
    static const wxString
       PARAMETER_TEXT[OpenGlPlotParamCount - SubscriberParamCount];
+   /// Hash index of the PARAMETER_TEXT labels, used by GetParameterID()
+   static const ParameterIndex PARAMETER_INDEX;
    
    virtual bool Distribute(Integer len);
    virtual bool Distribute(const Real * dat, Integer len);
@@ -58,7 +58,11 @@ OrbitPlot::PARAMETER_TEXT[OrbitPlotParamCount - SubscriberParamCount] =
    wxT("UpdatePlotFrequency"),
    wxT("NumPointsToRedraw"),
    wxT("ShowPlot"),
-}; 
+};
+
+const ParameterIndex
+OrbitPlot::PARAMETER_INDEX(PARAMETER_TEXT,
+      SubscriberParamCount, OrbitPlotParamCount);
 
 
 const Gmat::ParameterType
@@ -741,11 +745,9 @@ wxString OrbitPlot::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer OrbitPlot::GetParameterID(const wxString &str) const
 {
-   for (int i=SubscriberParamCount; i<OrbitPlotParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - SubscriberParamCount])
-         return i;
-   }
+   Integer id = PARAMETER_INDEX.Find(str);
+   if (id != -1)
+      return id;
    
    return Subscriber::GetParameterID(str);
 }
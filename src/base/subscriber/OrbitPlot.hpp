@@ -237,6 +237,8 @@ protected:
       PARAMETER_TYPE[OrbitPlotParamCount - SubscriberParamCount];
    static const wxString
       PARAMETER_TEXT[OrbitPlotParamCount - SubscriberParamCount];
+   /// Hash index of the PARAMETER_TEXT labels, used by GetParameterID()
+   static const ParameterIndex PARAMETER_INDEX;
    
    const static int MAX_SP_COLOR = 15;
    static const UnsignedInt DEFAULT_ORBIT_COLOR[MAX_SP_COLOR];
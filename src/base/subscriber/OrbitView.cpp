@@ -78,7 +78,11 @@ OrbitView::PARAMETER_TEXT[OrbitViewParamCount - OrbitPlotParamCount] =
    wxT("MinFOV"),
    wxT("MaxFOV"),
    wxT("InitialFOV"),
-}; 
+};
+
+const ParameterIndex
+OrbitView::PARAMETER_INDEX(PARAMETER_TEXT,
+      OrbitPlotParamCount, OrbitViewParamCount);
 
 
 const Gmat::ParameterType
@@ -732,11 +736,9 @@ Integer OrbitView::GetParameterID(const wxString &str) const
        str == wxT("MinFOV") || str == wxT("MaxFOV") || str == wxT("InitialFOV"))
       return Gmat::PARAMETER_REMOVED;
    
-   for (int i=OrbitPlotParamCount; i<OrbitViewParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - OrbitPlotParamCount])
-         return i;
-   }
+   Integer id = PARAMETER_INDEX.Find(str);
+   if (id != -1)
+      return id;
    
    return OrbitPlot::GetParameterID(str);
 }
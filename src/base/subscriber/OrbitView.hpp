@@ -199,6 +199,8 @@ protected:
       PARAMETER_TYPE[OrbitViewParamCount - OrbitPlotParamCount];
    static const wxString
       PARAMETER_TEXT[OrbitViewParamCount - OrbitPlotParamCount];
+   /// Hash index of the PARAMETER_TEXT labels, used by GetParameterID()
+   static const ParameterIndex PARAMETER_INDEX;
    
    virtual bool Distribute(Integer len);
    virtual bool Distribute(const Real * dat, Integer len);
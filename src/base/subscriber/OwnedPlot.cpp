@@ -56,7 +56,11 @@ OwnedPlot::PARAMETER_TEXT[OwnedPlotParamCount - GmatBaseParamCount] =
    wxT("MarkerSize"),
    wxT("Marker"),
    wxT("UseHiLow")
-}; 
+};
+
+const ParameterIndex
+OwnedPlot::PARAMETER_INDEX(PARAMETER_TEXT,
+      GmatBaseParamCount, OwnedPlotParamCount);
 
 
 const Gmat::ParameterType
@@ -521,11 +525,9 @@ wxString OwnedPlot::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer OwnedPlot::GetParameterID(const wxString &str) const
 {
-   for (int i=GmatBaseParamCount; i<OwnedPlotParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - GmatBaseParamCount])
-         return i;
-   }
+   Integer id = PARAMETER_INDEX.Find(str);
+   if (id != -1)
+      return id;
    
    return GmatBase::GetParameterID(str);
 }
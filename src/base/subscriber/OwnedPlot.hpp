@@ -227,6 +227,8 @@ protected:
       PARAMETER_TYPE[OwnedPlotParamCount - GmatBaseParamCount];
    static const wxString
       PARAMETER_TEXT[OwnedPlotParamCount - GmatBaseParamCount];
+   /// Hash index of the PARAMETER_TEXT labels, used by GetParameterID()
+   static const ParameterIndex PARAMETER_INDEX;
 };
 
 #endif
@@ -31,6 +31,13 @@
 #include "RealUtilities.hpp"
 #include <iomanip>
 #include <sstream>
+#include <algorithm>               // for find(), equal()
+#include <limits>                  // for quiet_NaN()
+#include <cstdio>                  // for sprintf()
+#include <cstring>                 // for strcpy()
+#include <cfloat>                  // for DBL_MAX_10_EXP
+#include <wx/mstream.h>            // for wxMemoryOutputStream
+#include <wx/zstream.h>            // for wxZlibOutputStream
 
 //#define DEBUG_REPORTFILE_OPEN
 //#define DEBUG_REPORTFILE_SET
@@ -46,6 +53,8 @@
 //---------------------------------
 // static data
 //---------------------------------
+StringArray ReportFile::fileFormatList;
+
 const wxString
 ReportFile::PARAMETER_TEXT[ReportFileParamCount - SubscriberParamCount] =
 {
@@ -57,8 +66,13 @@ ReportFile::PARAMETER_TEXT[ReportFileParamCount - SubscriberParamCount] =
    wxT("ZeroFill"),
    wxT("ColumnWidth"),
    wxT("WriteReport"),
+   wxT("FileFormat"),
 };
 
+const ParameterIndex
+ReportFile::PARAMETER_INDEX(PARAMETER_TEXT,
+      SubscriberParamCount, ReportFileParamCount);
+
 const Gmat::ParameterType
 ReportFile::PARAMETER_TYPE[ReportFileParamCount - SubscriberParamCount] =
 {
@@ -70,6 +84,7 @@ ReportFile::PARAMETER_TYPE[ReportFileParamCount - SubscriberParamCount] =
    Gmat::ON_OFF_TYPE,        //wxT("ZeroFill"),
    Gmat::INTEGER_TYPE,       //wxT("ColumnWidth"),
    Gmat::BOOLEAN_TYPE,       //wxT("WriteReport"),
+   Gmat::ENUMERATION_TYPE,   //wxT("FileFormat"),
 };
 
 
@@ -89,14 +104,22 @@ ReportFile::ReportFile(const wxString &type, const wxString &name,
    writeHeaders    (true),
    leftJustify     (true),
    zeroFill        (false),
+   fileFormat      (wxT("Text")),
+   binaryFormat    (false),
    lastUsedProvider(-1),
    mLastReportTime (0.0),
    usedByReport    (false),
-   calledByReport  (false)
+   calledByReport  (false),
+   schemaWritten   (false),
+   blockRows       (0)
 {
    objectTypes.push_back(Gmat::REPORT_FILE);
    objectTypeNames.push_back(wxT("ReportFile"));
    
+   fileFormatList.clear();
+   fileFormatList.push_back(wxT("Text"));
+   fileFormatList.push_back(wxT("Binary"));
+   
    mNumParams = 0;
    
    if (firstParam != NULL)
@@ -112,8 +135,7 @@ ReportFile::ReportFile(const wxString &type, const wxString &name,
 //------------------------------------------------------------------------------
 ReportFile::~ReportFile(void)
 {
-   dstream.flush();
-   dstream.close();
+   CloseReportFile();
 }
 
 
@@ -131,10 +153,14 @@ ReportFile::ReportFile(const ReportFile &rf) :
    writeHeaders    (rf.writeHeaders),
    leftJustify     (rf.leftJustify),
    zeroFill        (rf.zeroFill),
+   fileFormat      (rf.fileFormat),
+   binaryFormat    (rf.binaryFormat),
    lastUsedProvider(-1),
    mLastReportTime (rf.mLastReportTime),
    usedByReport    (rf.usedByReport),
-   calledByReport  (rf.calledByReport)
+   calledByReport  (rf.calledByReport),
+   schemaWritten   (false),
+   blockRows       (0)
 {
    mParams = rf.mParams; 
    mNumParams = rf.mNumParams;
@@ -177,6 +203,8 @@ ReportFile& ReportFile::operator=(const ReportFile& rf)
    writeHeaders = rf.writeHeaders;
    leftJustify = rf.leftJustify;
    zeroFill = rf.zeroFill;
+   fileFormat = rf.fileFormat;
+   binaryFormat = rf.binaryFormat;
    mParams = rf.mParams; 
    mNumParams = rf.mNumParams;
    mParamNames = rf.mParamNames;
@@ -339,59 +367,49 @@ bool ReportFile::AddParameterForTitleOnly(const wxString &paramName)
 
 
 //------------------------------------------------------------------------------
-// bool WriteData(WrapperArray wrapperArray)
+// bool WriteData(const WrapperArray &wrapperArray)
 //------------------------------------------------------------------------------
 /*
  * Writes array of data wrapped with ElementWrapper to stream.
  *
+ * Real values are formatted into per-column buffers that are reused from row
+ * to row, and rows end with a newline rather than a flush; the stream buffer
+ * is written out as it fills and when the file is closed.  When FileFormat
+ * is Binary the row is added to the current binary block instead.
+ *
  * @param  wrapperArray  data wrapper array
  */
 //------------------------------------------------------------------------------
-bool ReportFile::WriteData(WrapperArray wrapperArray)
+bool ReportFile::WriteData(const WrapperArray &wrapperArray)
 {
+   if (binaryFormat)
+      return WriteBinaryData(wrapperArray);
+   
    Integer numData = wrapperArray.size();
    UnsignedInt maxRow = 1;
    Real rval = -9999.999;
-   wxString sval;
-   wxString desc;
-   
-   // create output buffer
-   StringArray *output = new StringArray[numData];
-   Integer *colWidths = new Integer[numData];
    
    #if DBGLVL_WRITE_DATA > 0
    MessageInterface::ShowMessage(wxT("ReportFile::WriteData() has %d wrappers\n"), numData);
    MessageInterface::ShowMessage(wxT("   ==> Now start buffering data\n"));
    #endif
    
+   SetColumnWidths(wrapperArray);
+   sprintf(realFormat, (zeroFill ? "%%#1.%df" : "%%1.%df"), (int)precision);
+   
    // buffer formatted data
    for (Integer i=0; i < numData; i++)
    {
-      desc = wrapperArray[i]->GetDescription();
-      
-      #if DBGLVL_WRITE_DATA > 1
-      MessageInterface::ShowMessage(wxT("   desc is '%s'\n"), desc.c_str());
-      #endif
-      
       Gmat::WrapperDataType wrapperType = wrapperArray[i]->GetWrapperType();
       #if DBGLVL_WRITE_DATA > 1
       MessageInterface::ShowMessage
          (wxT("      It's wrapper type is %d\n"), wrapperType);
       #endif
       
-      Integer defWidth = columnWidth;
-      
       // set longer width of param names or columnWidth
-      if (writeHeaders)
-      {
-         defWidth = (Integer)desc.length() > columnWidth ?
-            desc.length() : columnWidth;
-         
-         // parameter name has Gregorian, minimum width is 24
-         if (desc.find(wxT("Gregorian")) != desc.npos)
-            if (defWidth < 24)
-               defWidth = 24;
-      }
+      Integer defWidth = columnWidth;
+      if (writeHeaders && descWidths[i] > columnWidth)
+         defWidth = descWidths[i];
       
       // if writing headers or called by Report add 3 more spaces
       // since header adds 3 more spaces
@@ -399,6 +417,8 @@ bool ReportFile::WriteData(WrapperArray wrapperArray)
          defWidth = defWidth + 3;
       
       colWidths[i] = defWidth;
+      realColumn[i] = false;
+      textRows[i].clear();
       
       switch (wrapperType)
       {
@@ -407,13 +427,7 @@ bool ReportFile::WriteData(WrapperArray wrapperArray)
       case Gmat::OBJECT_PROPERTY_WT:
          {
             rval = wrapperArray[i]->EvaluateReal();
-            if (IsNotANumber(rval))
-               output[i].push_back(wxT("NaN"));
-            else
-               output[i].push_back(GmatStringUtil::ToString(rval, precision, zeroFill));
-            #ifdef DEBUG_REAL_DATA
-               MessageInterface::ShowMessage(wxT("   resulting string for value of %12.10f = %s\n"), rval, output[i].back().c_str());
-            #endif
+            FormatReal(i, rval);
             break;
          }
       case Gmat::PARAMETER_WT:
@@ -428,47 +442,39 @@ bool ReportFile::WriteData(WrapperArray wrapperArray)
             case Gmat::REAL_TYPE:
                {
                   rval = wrapperArray[i]->EvaluateReal();
-                  if (IsNotANumber(rval))
-                     output[i].push_back(wxT("NaN"));
-                  else
-                     output[i].push_back(GmatStringUtil::ToString(rval, precision, zeroFill));
-                  #ifdef DEBUG_REAL_DATA
-                     MessageInterface::ShowMessage(wxT("   resulting string for value of %12.10f = %s\n"), rval, output[i].back().c_str());
-                  #endif
+                  FormatReal(i, rval);
                   break;
                }
             case Gmat::RMATRIX_TYPE:
                {
                   Rmatrix rmat = wrapperArray[i]->EvaluateArray();
-                  colWidths[i] = WriteMatrix(output, i, rmat, maxRow, defWidth);
+                  colWidths[i] = WriteMatrix(&textRows[0], i, rmat, maxRow, defWidth);
                   break;
                }
             case Gmat::STRING_TYPE:
                {
-                  sval = wrapperArray[i]->EvaluateString();
-                  output[i].push_back(sval);
+                  textRows[i].push_back(wrapperArray[i]->EvaluateString());
                   break;
                }
             default:
                throw GmatBaseException
-                  (wxT("Cannot write \"") + desc + wxT("\" due to unimplemented ")
-                   wxT("Parameter data type"));
+                  (wxT("Cannot write \"") + wrapperArray[i]->GetDescription() +
+                   wxT("\" due to unimplemented Parameter data type"));
             }
             break;
          }
       case Gmat::ARRAY_WT:
          {
             Rmatrix rmat = wrapperArray[i]->EvaluateArray();
-            colWidths[i] = WriteMatrix(output, i, rmat, maxRow, defWidth);
+            colWidths[i] = WriteMatrix(&textRows[0], i, rmat, maxRow, defWidth);
             break;
          }
       case Gmat::STRING_OBJECT_WT:
          {
-            sval = wrapperArray[i]->EvaluateString();
-            output[i].push_back(sval);
+            textRows[i].push_back(wrapperArray[i]->EvaluateString());
             #if DBGLVL_WRITE_DATA > 1
             MessageInterface::ShowMessage
-               (wxT("      Got string value of '%s'\n"), sval.c_str());
+               (wxT("      Got string value of '%s'\n"), textRows[i].back().c_str());
             #endif
             break;
          }
@@ -479,8 +485,7 @@ bool ReportFile::WriteData(WrapperArray wrapperArray)
    
    #if DBGLVL_WRITE_DATA > 0
    MessageInterface::ShowMessage
-      (wxT("   ==> Now write data to stream, maxRow is %d, first item = '%s'\n"),
-       maxRow, output[0][0].c_str());
+      (wxT("   ==> Now write data to stream, maxRow is %d\n"), maxRow);
    #endif
    
    if (leftJustify)
@@ -493,34 +498,22 @@ bool ReportFile::WriteData(WrapperArray wrapperArray)
       {
          dstream.width(colWidths[param]);
          
-         #if DBGLVL_WRITE_DATA > 1
-         MessageInterface::ShowMessage
-            (wxT("leftJustify=%d, w=%2d, %s\n"), leftJustify, colWidths[param],
-             output[param][row].c_str());
-         #endif
-         
-         UnsignedInt numRow = output[param].size();
+         UnsignedInt numRow = (realColumn[param] ? 1 : textRows[param].size());
          if (numRow >= row+1)
-            dstream << output[param][row].char_str();
+         {
+            if (realColumn[param])
+               dstream << &realText[param][0];
+            else
+               dstream << textRows[param][row].char_str();
+         }
          else if (numRow < maxRow)
             dstream << "  ";
       }
-      dstream << std::endl;
-      
-      #if DBGLVL_WRITE_DATA > 1
-      MessageInterface::ShowMessage(wxT("\n"));
-      #endif
+      dstream << '\n';
    }
    
-   // delete output buffer
-   delete[] output;
-   delete[] colWidths;
-   
    if (isEndOfRun)  // close file
-   {
-      if (dstream.is_open())
-         dstream.close();
-   }
+      CloseReportFile();
    
    #if DBGLVL_WRITE_DATA > 0
    MessageInterface::ShowMessage(wxT("ReportFile::WriteData() returning true\n"));
@@ -676,10 +669,7 @@ bool ReportFile::TakeAction(const wxString &action,
    }
    
    if (action == wxT("Finalize"))
-   {
-      if (dstream.is_open())
-         dstream.close();
-   }
+      CloseReportFile();
    
    return false;
 }
@@ -746,11 +736,9 @@ wxString ReportFile::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer ReportFile::GetParameterID(const wxString &str) const
 {
-   for (Integer i = SubscriberParamCount; i < ReportFileParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - SubscriberParamCount])
-         return i;
-   }
+   Integer id = PARAMETER_INDEX.Find(str);
+   if (id != -1)
+      return id;
    
    return Subscriber::GetParameterID(str);
 }
@@ -913,6 +901,9 @@ Integer ReportFile::SetIntegerParameter(const Integer id, const Integer value)
 //------------------------------------------------------------------------------
 wxString ReportFile::GetStringParameter(const Integer id) const
 {
+   if (id == FILE_FORMAT)
+      return fileFormat;
+   
    if (id == FILENAME)
    {
       return filename;
@@ -989,10 +980,29 @@ bool ReportFile::SetStringParameter(const Integer id, const wxString &value)
       // Close the stream if it is open
       if (dstream.is_open())
       {
-         dstream.close();
-         dstream.open(fullPathName.char_str());
+         CloseReportFile();
+         OpenReportFile();
+      }
+      
+      return true;
+   }
+   else if (id == FILE_FORMAT)
+   {
+      if (find(fileFormatList.begin(), fileFormatList.end(), value) ==
+          fileFormatList.end())
+      {
+         SubscriberException se;
+         se.SetDetails(errorMessageFormat.c_str(), value.c_str(),
+                       GetParameterText(FILE_FORMAT).c_str(), wxT("Text or Binary"));
+         throw se;
       }
       
+      // Close an open file so that it is reopened in the new format
+      if (value != fileFormat)
+         CloseReportFile();
+      
+      fileFormat = value;
+      binaryFormat = (fileFormat == wxT("Binary"));
       return true;
    }
    else if (id == ADD)
@@ -1050,6 +1060,26 @@ bool ReportFile::SetStringParameter(const wxString &label,
 }
 
 
+//---------------------------------------------------------------------------
+// const StringArray& GetPropertyEnumStrings(const Integer id) const
+//---------------------------------------------------------------------------
+/**
+ * Retrieves eumeration symbols of parameter of given id.
+ *
+ * @param <id> ID for the parameter.
+ *
+ * @return list of enumeration symbols
+ */
+//---------------------------------------------------------------------------
+const StringArray& ReportFile::GetPropertyEnumStrings(const Integer id) const
+{
+   if (id == FILE_FORMAT)
+      return fileFormatList;
+   
+   return Subscriber::GetPropertyEnumStrings(id);
+}
+
+
 //------------------------------------------------------------------------------
 // const StringArray& GetStringArrayParameter(const Integer id) const
 //------------------------------------------------------------------------------
@@ -1303,10 +1333,17 @@ bool ReportFile::OpenReportFile(void)
       (wxT("ReportFile::OpenReportFile() entered, filename = %s\n"), filename.c_str());
    #endif
    
-   if (dstream.is_open())
-     dstream.close();
+   CloseReportFile();
    
-   dstream.open(filename.char_str());
+   // Give the stream a large buffer; it must be set before the file is opened
+   if (streamBuffer.empty())
+      streamBuffer.resize(STREAM_BUFFER_SIZE);
+   dstream.rdbuf()->pubsetbuf(&streamBuffer[0], streamBuffer.size());
+   
+   if (binaryFormat)
+      dstream.open(filename.char_str(), std::ios::out | std::ios::binary);
+   else
+      dstream.open(filename.char_str());
    if (!dstream.is_open())
    {
       #ifdef DEBUG_REPORTFILE_OPEN
@@ -1326,6 +1363,28 @@ bool ReportFile::OpenReportFile(void)
 }
 
 
+//------------------------------------------------------------------------------
+// void CloseReportFile()
+//------------------------------------------------------------------------------
+/**
+ * Writes out any pending binary block and closes the report file.
+ */
+//------------------------------------------------------------------------------
+void ReportFile::CloseReportFile()
+{
+   if (dstream.is_open())
+   {
+      if (binaryFormat)
+         WriteBinaryBlock();
+      dstream.close();
+   }
+   
+   // A reopened file starts with a new schema
+   schemaWritten = false;
+   blockRows = 0;
+}
+
+
 //------------------------------------------------------------------------------
 // void ClearYParameters()
 //------------------------------------------------------------------------------
@@ -1357,7 +1416,8 @@ void ReportFile::WriteHeaders()
        mNumParams, columnWidth);
    #endif
    
-   if (writeHeaders)
+   // The binary format carries its own column schema
+   if (writeHeaders && !binaryFormat)
    {
       if (!dstream.is_open())
          return;
@@ -1391,7 +1451,7 @@ void ReportFile::WriteHeaders()
           dstream << mParamNames[i].char_str();
       }
       
-      dstream << std::endl;
+      dstream << '\n';
    }
    
    initial = false;
@@ -1468,6 +1528,317 @@ Integer ReportFile::WriteMatrix(StringArray *output, Integer param,
    return newWidth;
 } // WriteMatrix()
 
+
+//------------------------------------------------------------------------------
+// void SetColumnWidths(const WrapperArray &wrapperArray)
+//------------------------------------------------------------------------------
+/*
+ * Sizes the per-column buffers and finds the width needed by each column
+ * description.  This is only redone when the wrappers change.
+ *
+ * @param  wrapperArray  data wrapper array
+ */
+//------------------------------------------------------------------------------
+void ReportFile::SetColumnWidths(const WrapperArray &wrapperArray)
+{
+   UnsignedInt numData = wrapperArray.size();
+   if ((widthWrappers.size() == numData) &&
+       std::equal(wrapperArray.begin(), wrapperArray.end(), widthWrappers.begin()))
+      return;
+   
+   widthWrappers.assign(wrapperArray.begin(), wrapperArray.end());
+   descWidths.resize(numData);
+   colWidths.resize(numData);
+   realColumn.resize(numData);
+   textRows.resize(numData);
+   realText.resize(numData);
+   
+   for (UnsignedInt i = 0; i < numData; ++i)
+   {
+      wxString desc = wrapperArray[i]->GetDescription();
+      descWidths[i] = desc.length();
+      
+      // parameter name has Gregorian, minimum width is 24
+      if (desc.find(wxT("Gregorian")) != desc.npos)
+         if (descWidths[i] < 24)
+            descWidths[i] = 24;
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// const char* FormatReal(Integer col, Real rval)
+//------------------------------------------------------------------------------
+/*
+ * Formats a Real value into the column's text buffer, the same way as
+ * GmatStringUtil::ToString(rval, precision, zeroFill).
+ *
+ * @param  col   column index
+ * @param  rval  value to format
+ *
+ * @return  the formatted text
+ */
+//------------------------------------------------------------------------------
+const char* ReportFile::FormatReal(Integer col, Real rval)
+{
+   std::vector<char> &text = realText[col];
+   realColumn[col] = true;
+   
+   // Fixed notation needs at most a sign, DBL_MAX_10_EXP + 1 integer digits,
+   // the decimal point, precision decimals and the terminator
+   UnsignedInt maxLength = precision + DBL_MAX_10_EXP + 4;
+   if (text.size() < maxLength)
+      text.resize(maxLength);
+   
+   if (IsNotANumber(rval))
+      strcpy(&text[0], "NaN");
+   else
+      sprintf(&text[0], realFormat, rval);
+   
+   #ifdef DEBUG_REAL_DATA
+      MessageInterface::ShowMessage
+         (wxT("   resulting string for value of %12.10f = %s\n"), rval, &text[0]);
+   #endif
+   
+   return &text[0];
+}
+
+
+//------------------------------------------------------------------------------
+// bool WriteBinaryData(const WrapperArray &wrapperArray)
+//------------------------------------------------------------------------------
+/*
+ * Adds one row of data to the current binary block.
+ *
+ * Real values, including values reported as NaN in text reports, are stored
+ * as Reals (NaN for undefined values); arrays are stored row by row in one
+ * column; string data is stored as text.  The block is written when it
+ * holds BINARY_BLOCK_SIZE rows or when the file is closed.
+ *
+ * @param  wrapperArray  data wrapper array
+ */
+//------------------------------------------------------------------------------
+bool ReportFile::WriteBinaryData(const WrapperArray &wrapperArray)
+{
+   Integer numData = wrapperArray.size();
+   
+   if (!dstream.is_open())
+      if (!OpenReportFile())
+         return false;
+   
+   if (!schemaWritten)
+      WriteBinarySchema(wrapperArray);
+   else if ((Integer)binaryTypes.size() != numData)
+      throw SubscriberException
+         (wxT("The columns written to the binary report file \"") + filename +
+          wxT("\" changed during the run"));
+   
+   for (Integer i = 0; i < numData; ++i)
+   {
+      Gmat::WrapperDataType wrapperType = wrapperArray[i]->GetWrapperType();
+      
+      if (binaryTypes[i] == BINARY_STRING)
+      {
+         // Wrappers that are not written in text reports get empty strings
+         if ((wrapperType == Gmat::PARAMETER_WT) ||
+             (wrapperType == Gmat::STRING_OBJECT_WT))
+            binaryStrings[i].push_back(wrapperArray[i]->EvaluateString());
+         else
+            binaryStrings[i].push_back(wxT(""));
+         continue;
+      }
+      
+      bool isArray = (wrapperType == Gmat::ARRAY_WT) ||
+            (wrapperType == Gmat::PARAMETER_WT &&
+             wrapperArray[i]->GetDataType() == Gmat::RMATRIX_TYPE);
+      
+      if (!isArray)
+      {
+         Real rval = wrapperArray[i]->EvaluateReal();
+         if (IsNotANumber(rval))
+            rval = std::numeric_limits<Real>::quiet_NaN();
+         binaryReals[i].push_back(rval);
+         continue;
+      }
+      
+      Rmatrix rmat = wrapperArray[i]->EvaluateArray();
+      Integer rows = rmat.GetNumRows(), cols = rmat.GetNumColumns();
+      if (rows * cols != binaryCounts[i])
+         throw SubscriberException
+            (wxT("The size of \"") + wrapperArray[i]->GetDescription() +
+             wxT("\" changed while writing the binary report file \"") +
+             filename + wxT("\""));
+      
+      for (Integer r = 0; r < rows; ++r)
+         for (Integer c = 0; c < cols; ++c)
+            binaryReals[i].push_back(rmat(r, c));
+   }
+   
+   ++blockRows;
+   if (blockRows >= BINARY_BLOCK_SIZE)
+      WriteBinaryBlock();
+   
+   if (isEndOfRun)  // close file
+      CloseReportFile();
+   
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// void WriteBinarySchema(const WrapperArray &wrapperArray)
+//------------------------------------------------------------------------------
+/*
+ * Writes the header of a binary report file.
+ *
+ * The binary format is columnar and uses the native byte order, with
+ * 4-byte Integers and 8-byte Reals:
+ *
+ *   header:  8 characters "GMATRPTB", Integer version (2), Integer column
+ *            count, Integer rows per block
+ *   columns: for each column, Integer type (1 = Real, 2 = String), Integer
+ *            Reals per row (1 for scalars, rows x columns for arrays, 0 for
+ *            strings), Integer array row count, Integer name length, and the
+ *            name characters
+ *   blocks:  Integer row count, Integer byte count, then that many bytes of
+ *            zlib (RFC 1950) compressed data holding each column in turn: the
+ *            Reals of all of the rows, or for strings an Integer length and
+ *            the characters of each row
+ *
+ * @param  wrapperArray  data wrapper array
+ */
+//------------------------------------------------------------------------------
+void ReportFile::WriteBinarySchema(const WrapperArray &wrapperArray)
+{
+   Integer numData = wrapperArray.size();
+   binaryTypes.assign(numData, BINARY_REAL);
+   binaryCounts.assign(numData, 1);
+   IntegerArray rowCounts(numData, 1);
+   
+   for (Integer i = 0; i < numData; ++i)
+   {
+      Gmat::WrapperDataType wrapperType = wrapperArray[i]->GetWrapperType();
+      Gmat::ParameterType dataType = wrapperArray[i]->GetDataType();
+      
+      if ((wrapperType == Gmat::STRING_OBJECT_WT) ||
+          (wrapperType == Gmat::PARAMETER_WT && dataType == Gmat::STRING_TYPE))
+      {
+         binaryTypes[i] = BINARY_STRING;
+         binaryCounts[i] = 0;
+         rowCounts[i] = 0;
+      }
+      else if ((wrapperType == Gmat::ARRAY_WT) ||
+               (wrapperType == Gmat::PARAMETER_WT && dataType == Gmat::RMATRIX_TYPE))
+      {
+         Rmatrix rmat = wrapperArray[i]->EvaluateArray();
+         rowCounts[i] = rmat.GetNumRows();
+         binaryCounts[i] = rmat.GetNumRows() * rmat.GetNumColumns();
+      }
+      else if (wrapperType == Gmat::PARAMETER_WT && dataType != Gmat::REAL_TYPE)
+      {
+         throw GmatBaseException
+            (wxT("Cannot write \"") + wrapperArray[i]->GetDescription() +
+             wxT("\" due to unimplemented Parameter data type"));
+      }
+      else if ((wrapperType != Gmat::PARAMETER_WT) &&
+               (wrapperType != Gmat::VARIABLE_WT) &&
+               (wrapperType != Gmat::ARRAY_ELEMENT_WT) &&
+               (wrapperType != Gmat::OBJECT_PROPERTY_WT))
+      {
+         binaryTypes[i] = BINARY_STRING;
+         binaryCounts[i] = 0;
+         rowCounts[i] = 0;
+      }
+   }
+   
+   Integer version = 2, blockSize = BINARY_BLOCK_SIZE;
+   dstream.write("GMATRPTB", 8);
+   dstream.write((const char*)&version, sizeof(Integer));
+   dstream.write((const char*)&numData, sizeof(Integer));
+   dstream.write((const char*)&blockSize, sizeof(Integer));
+   
+   for (Integer i = 0; i < numData; ++i)
+   {
+      std::string name(wrapperArray[i]->GetDescription().char_str());
+      Integer nameLength = name.length();
+      
+      dstream.write((const char*)&binaryTypes[i], sizeof(Integer));
+      dstream.write((const char*)&binaryCounts[i], sizeof(Integer));
+      dstream.write((const char*)&rowCounts[i], sizeof(Integer));
+      dstream.write((const char*)&nameLength, sizeof(Integer));
+      dstream.write(name.c_str(), nameLength);
+   }
+   
+   binaryReals.resize(numData);
+   binaryStrings.resize(numData);
+   for (Integer i = 0; i < numData; ++i)
+   {
+      binaryReals[i].clear();
+      binaryReals[i].reserve(binaryCounts[i] * BINARY_BLOCK_SIZE);
+      binaryStrings[i].clear();
+   }
+   
+   blockRows = 0;
+   schemaWritten = true;
+}
+
+
+//------------------------------------------------------------------------------
+// void WriteBinaryBlock()
+//------------------------------------------------------------------------------
+/*
+ * Compresses the rows buffered for the current block, column by column, and
+ * writes them to the file.
+ */
+//------------------------------------------------------------------------------
+void ReportFile::WriteBinaryBlock()
+{
+   if (!schemaWritten || blockRows == 0 || !dstream.is_open())
+      return;
+   
+   wxMemoryOutputStream blockData;
+   wxZlibOutputStream zstream(blockData, wxZ_DEFAULT_COMPRESSION, wxZLIB_ZLIB);
+   
+   for (UnsignedInt i = 0; i < binaryTypes.size(); ++i)
+   {
+      if (binaryTypes[i] == BINARY_REAL)
+      {
+         if (!binaryReals[i].empty())
+            zstream.Write(&binaryReals[i][0],
+                          binaryReals[i].size() * sizeof(Real));
+         binaryReals[i].clear();
+      }
+      else
+      {
+         for (UnsignedInt j = 0; j < binaryStrings[i].size(); ++j)
+         {
+            std::string text(binaryStrings[i][j].char_str());
+            Integer length = text.length();
+            zstream.Write(&length, sizeof(Integer));
+            zstream.Write(text.c_str(), length);
+         }
+         binaryStrings[i].clear();
+      }
+   }
+   
+   if (!zstream.Close())
+      throw SubscriberException
+         (wxT("ReportFile cannot compress a block of the binary report \"") +
+          filename + wxT("\""));
+   
+   Integer byteCount = blockData.GetSize();
+   compressedBlock.resize(byteCount);
+   if (byteCount > 0)
+      blockData.CopyTo(&compressedBlock[0], byteCount);
+   
+   dstream.write((const char*)&blockRows, sizeof(Integer));
+   dstream.write((const char*)&byteCount, sizeof(Integer));
+   if (byteCount > 0)
+      dstream.write(&compressedBlock[0], byteCount);
+   
+   blockRows = 0;
+}
+
 //--------------------------------------
 // methods inherited from Subscriber
 //--------------------------------------
@@ -1508,17 +1879,18 @@ bool ReportFile::Distribute(int len)
          MessageInterface::ShowMessage(wxT("   Writing data to '%s'\n"), filename.c_str());
          #endif
          
+         // Text lines from the Report command only go to text reports
+         if (binaryFormat)
+            return true;
+         
          dstream << data.char_str();
-         dstream << std::endl;
+         dstream << '\n';
       }
       return true;
    }
    
    if (isEndOfRun)  // close file
-   {
-      if (dstream.is_open())
-         dstream.close();
-   }
+      CloseReportFile();
    
    return false;
 }
@@ -1611,10 +1983,7 @@ bool ReportFile::Distribute(const Real * dat, Integer len)
       mLastReportTime = dat[0];
       
       if (isEndOfRun)  // close file
-      {
-         if (dstream.is_open())
-            dstream.close();
-      }
+         CloseReportFile();
       
       #if DBGLVL_REPORTFILE_DATA > 1
       MessageInterface::ShowMessage
@@ -52,7 +52,7 @@ public:
    Integer              GetNumParameters();
    bool                 AddParameter(const wxString &paramName, Integer index);
    bool                 AddParameterForTitleOnly(const wxString &paramName);
-   bool                 WriteData(WrapperArray dataArray);
+   bool                 WriteData(const WrapperArray &dataArray);
    
    // methods inherited from GmatBase
    virtual bool         Initialize();
@@ -100,6 +100,9 @@ public:
    virtual const StringArray&
                         GetStringArrayParameter(const wxString &label) const;
    
+   virtual const StringArray&
+                        GetPropertyEnumStrings(const Integer id) const;
+   
    virtual wxString  GetOnOffParameter(const Integer id) const;
    virtual bool         SetOnOffParameter(const Integer id, 
                                           const wxString &value);
@@ -141,9 +144,15 @@ protected:
    bool                 leftJustify;
    /// Fill right field with 0
    bool                 zeroFill;
+   /// Format of the report file, "Text" or "Binary"
+   wxString          fileFormat;
+   /// Flag indicating that the binary columnar format is written
+   bool                 binaryFormat;
    
    /// output data stream
    std::ofstream        dstream;
+   /// Buffer set on the stream so that rows are not written one at a time
+   std::vector<char>    streamBuffer;
    std::vector<Parameter*> mParams;
    
    Integer              mNumParams;
@@ -155,12 +164,62 @@ protected:
    bool                 calledByReport;
    bool                 initial;
    
+   /// Wrappers the column widths were computed for
+   std::vector<ElementWrapper*> widthWrappers;
+   /// Width needed by each column description
+   IntegerArray         descWidths;
+   /// Width of each column for the current row
+   IntegerArray         colWidths;
+   /// Flag for each column indicating that it holds one formatted Real
+   std::vector<bool>    realColumn;
+   /// Formatted Real value of each column, in a reused buffer
+   std::vector< std::vector<char> > realText;
+   /// Formatted rows of the matrix and string columns
+   std::vector<StringArray> textRows;
+   /// printf format for Real values built from precision and zeroFill
+   char                 realFormat[16];
+   
+   /// Flag indicating that the binary column schema has been written
+   bool                 schemaWritten;
+   /// Type of each binary column (BINARY_REAL or BINARY_STRING)
+   IntegerArray         binaryTypes;
+   /// Number of Reals in each row of each binary column
+   IntegerArray         binaryCounts;
+   /// Real data of the current block, one array per column
+   std::vector<RealArray> binaryReals;
+   /// String data of the current block, one array per column
+   std::vector<StringArray> binaryStrings;
+   /// Number of rows in the current block
+   Integer              blockRows;
+   /// Compressed bytes of the block being written
+   std::vector<char>    compressedBlock;
+   
+   /// Rows written per block of the binary format
+   static const Integer BINARY_BLOCK_SIZE = 4096;
+   /// Size of the stream buffer
+   static const Integer STREAM_BUFFER_SIZE = 1048576;
+   /// Column type codes of the binary format
+   enum BinaryColumnType
+   {
+      BINARY_REAL = 1,
+      BINARY_STRING = 2
+   };
+   
+   /// Available file formats
+   static StringArray   fileFormatList;
+   
    virtual bool         OpenReportFile(void);
+   void                 CloseReportFile();
    void                 ClearParameters();
    void                 WriteHeaders();
    Integer              WriteMatrix(StringArray *output, Integer param,
                                     const Rmatrix &rmat, UnsignedInt &maxRow,
                                     Integer defWidth);
+   void                 SetColumnWidths(const WrapperArray &wrapperArray);
+   const char*          FormatReal(Integer col, Real rval);
+   bool                 WriteBinaryData(const WrapperArray &wrapperArray);
+   void                 WriteBinarySchema(const WrapperArray &wrapperArray);
+   void                 WriteBinaryBlock();
    
    // methods inherited from Subscriber
    virtual bool         Distribute(Integer len);
@@ -178,6 +237,7 @@ protected:
       ZERO_FILL,
       COL_WIDTH,
       WRITE_REPORT,
+      FILE_FORMAT,
       ReportFileParamCount  /// Count of the parameters for this class
    };
 
@@ -185,6 +245,8 @@ private:
 
    static const wxString
       PARAMETER_TEXT[ReportFileParamCount - SubscriberParamCount];
+   /// Hash index of the PARAMETER_TEXT labels, used by GetParameterID()
+   static const ParameterIndex PARAMETER_INDEX;
    static const Gmat::ParameterType
       PARAMETER_TYPE[ReportFileParamCount - SubscriberParamCount];
    
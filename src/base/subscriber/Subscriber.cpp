@@ -82,6 +82,10 @@ Subscriber::PARAMETER_TEXT[SubscriberParamCount - GmatBaseParamCount] =
    wxT("Minimized"),
 };
 
+const ParameterIndex
+Subscriber::PARAMETER_INDEX(PARAMETER_TEXT,
+      GmatBaseParamCount, SubscriberParamCount);
+
 const Gmat::ParameterType
 Subscriber::PARAMETER_TYPE[SubscriberParamCount - GmatBaseParamCount] =
 {
@@ -996,11 +1000,9 @@ wxString Subscriber::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer Subscriber::GetParameterID(const wxString &str) const
 {
-   for (int i=GmatBaseParamCount; i<SubscriberParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - GmatBaseParamCount])
-         return i;
-   }
+   Integer id = PARAMETER_INDEX.Find(str);
+   if (id != -1)
+      return id;
    
    return GmatBase::GetParameterID(str);
 }
@@ -239,6 +239,8 @@ public:
       PARAMETER_TYPE[SubscriberParamCount - GmatBaseParamCount];
    static const wxString
       PARAMETER_TEXT[SubscriberParamCount - GmatBaseParamCount];
+   /// Hash index of the PARAMETER_TEXT labels, used by GetParameterID()
+   static const ParameterIndex PARAMETER_INDEX;
    
    // for GUI population
    static StringArray solverIterOptions;
@@ -45,6 +45,10 @@ TextEphemFile::PARAMETER_TEXT[TextEphemFileParamCount - ReportFileParamCount] =
    wxT("CoordinateSystem"),
 };
 
+const ParameterIndex
+TextEphemFile::PARAMETER_INDEX(PARAMETER_TEXT,
+      ReportFileParamCount, TextEphemFileParamCount);
+
 const Gmat::ParameterType
 TextEphemFile::PARAMETER_TYPE[TextEphemFileParamCount - ReportFileParamCount] =
 {
@@ -228,11 +232,9 @@ GmatBase* TextEphemFile::Clone(void) const
 //------------------------------------------------------------------------------
 Integer TextEphemFile::GetParameterID(const wxString &str) const
 {
-   for (Integer i = ReportFileParamCount; i < TextEphemFileParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - ReportFileParamCount])
-         return i;
-   }
+   Integer id = PARAMETER_INDEX.Find(str);
+   if (id != -1)
+      return id;
 
    return ReportFile::GetParameterID(str);
 }
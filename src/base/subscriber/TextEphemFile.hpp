@@ -71,6 +71,8 @@ protected:
    
    static const wxString
       PARAMETER_TEXT[TextEphemFileParamCount - ReportFileParamCount];
+   /// Hash index of the PARAMETER_TEXT labels, used by GetParameterID()
+   static const ParameterIndex PARAMETER_INDEX;
    static const Gmat::ParameterType
       PARAMETER_TYPE[TextEphemFileParamCount - ReportFileParamCount];
    
@@ -55,7 +55,10 @@ XyPlot::PARAMETER_TEXT[XyPlotParamCount - SubscriberParamCount] =
    wxT("IndVar"),
    wxT("Add"),
    wxT("Grid"),
-}; 
+};
+
+const ParameterIndex
+XyPlot::PARAMETER_INDEX(PARAMETER_TEXT, SubscriberParamCount, XyPlotParamCount);
 
 const Gmat::ParameterType
 XyPlot::PARAMETER_TYPE[XyPlotParamCount - SubscriberParamCount] =
@@ -585,17 +588,15 @@ wxString XyPlot::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer XyPlot::GetParameterID(const wxString &str) const
 {
-   for (int i=SubscriberParamCount; i<XyPlotParamCount; i++)
+   Integer id = PARAMETER_INDEX.Find(str);
+   if (id != -1)
    {
-      if (str == PARAMETER_TEXT[i - SubscriberParamCount])
-      {
-         switch (i)
-            case IND_VAR:
-            case ADD:
-            case DRAW_GRID:
-               WriteDeprecatedMessage(i);
-         return i;
-      }
+      switch (id)
+         case IND_VAR:
+         case ADD:
+         case DRAW_GRID:
+            WriteDeprecatedMessage(id);
+      return id;
    }
    // deprecated labels
    
@@ -193,6 +193,8 @@ public:
       PARAMETER_TYPE[XyPlotParamCount - SubscriberParamCount];
    static const wxString
       PARAMETER_TEXT[XyPlotParamCount - SubscriberParamCount];
+   /// Hash index of the PARAMETER_TEXT labels, used by GetParameterID()
+   static const ParameterIndex PARAMETER_INDEX;
 
 };
 
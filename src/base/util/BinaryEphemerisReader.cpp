@@ -0,0 +1,513 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                             BinaryEphemerisReader
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002-2011 United States Government as represented by the
+// Administrator of The National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Created: 2026/10/18
+//
+/**
+ * Implements the reader for GMAT's native binary ephemeris format.
+ */
+//------------------------------------------------------------------------------
+
+#include "BinaryEphemerisReader.hpp"
+#include "BinaryEphemerisWriter.hpp"    // for the format constants
+#include "UtilityException.hpp"
+#include "GmatConstants.hpp"            // for SECS_PER_DAY
+#include "HermiteInterpolation.hpp"     // for HermiteState()
+#include <algorithm>                    // for sort()
+#include <cstring>                      // for memcpy(), memcmp()
+#include <cmath>                        // for floor()
+#include <fstream>
+
+// Platform specific memory map routines
+#ifdef _WIN32
+#define __WIN32__
+#endif
+
+#ifdef __WIN32__
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+//#define DEBUG_BINARY_EPHEM_READER
+
+#ifdef DEBUG_BINARY_EPHEM_READER
+#include "MessageInterface.hpp"
+#endif
+
+namespace
+{
+   /// Tolerance, in days, on requests just outside of a segment
+   const Real EPOCH_SLOP = 1.0e-10;
+}
+
+
+//------------------------------------------------------------------------------
+// BinaryEphemerisReader()
+//------------------------------------------------------------------------------
+BinaryEphemerisReader::BinaryEphemerisReader() :
+   startEpoch     (0.0),
+   endEpoch       (0.0),
+   recordCount    (0),
+   lastSegment    (-1),
+   fileData       (NULL),
+   fileSize       (0),
+   records        (NULL),
+   mapHandle      (NULL)
+{
+}
+
+
+//------------------------------------------------------------------------------
+// ~BinaryEphemerisReader()
+//------------------------------------------------------------------------------
+BinaryEphemerisReader::~BinaryEphemerisReader()
+{
+   Close();
+}
+
+
+//------------------------------------------------------------------------------
+// void Open(const wxString &fileName)
+//------------------------------------------------------------------------------
+/**
+ * Maps a binary ephemeris file and reads its header and segment index.
+ *
+ * @param fileName  The file to read
+ */
+//------------------------------------------------------------------------------
+void BinaryEphemerisReader::Open(const wxString &fileName)
+{
+   Close();
+   theFileName = fileName;
+
+   MapFile();
+   if (fileData == NULL)
+   {
+      std::ifstream inStream(fileName.char_str(), std::ios::in | std::ios::binary);
+      if (inStream.is_open())
+      {
+         inStream.seekg(0, std::ios::end);
+         fileBuffer.resize((size_t)inStream.tellg());
+         inStream.seekg(0, std::ios::beg);
+         if (!fileBuffer.empty() && inStream.read(&fileBuffer[0], fileBuffer.size()))
+         {
+            fileData = &fileBuffer[0];
+            fileSize = fileBuffer.size();
+         }
+      }
+   }
+
+   if (fileData == NULL)
+   {
+      Close();
+      throw UtilityException(wxT("Cannot open the binary ephemeris file \"") +
+            fileName + wxT("\""));
+   }
+
+   Integer version = 0, recordSize = 0, segmentCount = 0;
+   if (fileSize >= (size_t)BinaryEphemerisWriter::HEADER_SIZE &&
+       memcmp(fileData, BinaryEphemerisWriter::FILE_ID, 8) == 0)
+   {
+      memcpy(&version, fileData + 8, sizeof(Integer));
+      memcpy(&recordSize, fileData + 12, sizeof(Integer));
+      memcpy(&segmentCount, fileData + 16, sizeof(Integer));
+      memcpy(&recordCount, fileData + 20, sizeof(Integer));
+      memcpy(&startEpoch, fileData + 24, sizeof(Real));
+      memcpy(&endEpoch, fileData + 32, sizeof(Real));
+   }
+
+   size_t indexOffset = BinaryEphemerisWriter::HEADER_SIZE +
+         (size_t)recordCount * BinaryEphemerisWriter::RECORD_SIZE * sizeof(Real);
+   if (version != BinaryEphemerisWriter::FORMAT_VERSION ||
+       recordSize != BinaryEphemerisWriter::RECORD_SIZE ||
+       recordCount < 0 || segmentCount < 0 ||
+       fileSize < indexOffset + (size_t)segmentCount *
+             BinaryEphemerisWriter::INDEX_ENTRY_SIZE)
+   {
+      Close();
+      throw UtilityException(wxT("The file \"") + fileName +
+            wxT("\" is not a complete binary ephemeris file"));
+   }
+
+   objectName  = ReadName(40);
+   centralBody = ReadName(40 + BinaryEphemerisWriter::NAME_SIZE);
+   axesType    = ReadName(40 + 2 * BinaryEphemerisWriter::NAME_SIZE);
+   records = (const Real*)(fileData + BinaryEphemerisWriter::HEADER_SIZE);
+
+   for (Integer i = 0; i < segmentCount; ++i)
+   {
+      const char *entry = fileData + indexOffset +
+            i * BinaryEphemerisWriter::INDEX_ENTRY_SIZE;
+      Segment segment;
+      memcpy(&segment.first, entry, sizeof(Integer));
+      memcpy(&segment.count, entry + 4, sizeof(Integer));
+      memcpy(&segment.start, entry + 8, sizeof(Real));
+      memcpy(&segment.end, entry + 16, sizeof(Real));
+      memcpy(&segment.step, entry + 24, sizeof(Real));
+
+      if (segment.first < 0 || segment.count <= 0 ||
+          segment.first + segment.count > recordCount)
+      {
+         Close();
+         throw UtilityException(wxT("The segment index of the binary ephemeris ")
+               wxT("file \"") + fileName + wxT("\" is corrupt"));
+      }
+      segments.push_back(segment);
+   }
+
+   // Backward propagation writes segments in reverse time order
+   std::stable_sort(segments.begin(), segments.end());
+
+   #ifdef DEBUG_BINARY_EPHEM_READER
+   MessageInterface::ShowMessage
+      (wxT("BinaryEphemerisReader::Open() '%s': %d records in %d segments, ")
+       wxT("%s about %s in %s, span %.12f to %.12f, %s\n"), fileName.c_str(),
+       recordCount, segmentCount, objectName.c_str(), centralBody.c_str(),
+       axesType.c_str(), startEpoch, endEpoch,
+       (mapHandle != NULL ? wxT("mapped") : wxT("read")));
+   #endif
+}
+
+
+//------------------------------------------------------------------------------
+// bool IsOpen() const
+//------------------------------------------------------------------------------
+bool BinaryEphemerisReader::IsOpen() const
+{
+   return records != NULL;
+}
+
+
+//------------------------------------------------------------------------------
+// void Close()
+//------------------------------------------------------------------------------
+void BinaryEphemerisReader::Close()
+{
+   UnmapFile();
+   fileBuffer.clear();
+   fileData = NULL;
+   fileSize = 0;
+   records = NULL;
+   recordCount = 0;
+   segments.clear();
+   lastSegment = -1;
+}
+
+
+//------------------------------------------------------------------------------
+// const wxString& GetFileName() const
+//------------------------------------------------------------------------------
+const wxString& BinaryEphemerisReader::GetFileName() const
+{
+   return theFileName;
+}
+
+
+//------------------------------------------------------------------------------
+// const wxString& GetObjectName() const
+//------------------------------------------------------------------------------
+const wxString& BinaryEphemerisReader::GetObjectName() const
+{
+   return objectName;
+}
+
+
+//------------------------------------------------------------------------------
+// const wxString& GetCentralBody() const
+//------------------------------------------------------------------------------
+const wxString& BinaryEphemerisReader::GetCentralBody() const
+{
+   return centralBody;
+}
+
+
+//------------------------------------------------------------------------------
+// const wxString& GetAxesType() const
+//------------------------------------------------------------------------------
+const wxString& BinaryEphemerisReader::GetAxesType() const
+{
+   return axesType;
+}
+
+
+//------------------------------------------------------------------------------
+// Real GetStartEpoch() const
+//------------------------------------------------------------------------------
+Real BinaryEphemerisReader::GetStartEpoch() const
+{
+   return startEpoch;
+}
+
+
+//------------------------------------------------------------------------------
+// Real GetEndEpoch() const
+//------------------------------------------------------------------------------
+Real BinaryEphemerisReader::GetEndEpoch() const
+{
+   return endEpoch;
+}
+
+
+//------------------------------------------------------------------------------
+// Integer GetRecordCount() const
+//------------------------------------------------------------------------------
+Integer BinaryEphemerisReader::GetRecordCount() const
+{
+   return recordCount;
+}
+
+
+//------------------------------------------------------------------------------
+// bool GetState(Real a1Mjd, Real state[6])
+//------------------------------------------------------------------------------
+/**
+ * Interpolates the state at an epoch.
+ *
+ * Up to HALF_WINDOW records on each side of the epoch, all from the segment
+ * containing it, are used.  The position is the Hermite polynomial matching
+ * their positions and velocities, and the velocity is its derivative.
+ *
+ * @param a1Mjd  The A.1 modified Julian epoch
+ * @param state  Output; the Cartesian state, in km and km/s
+ *
+ * @return false if the epoch is not covered by the file
+ */
+//------------------------------------------------------------------------------
+bool BinaryEphemerisReader::GetState(Real a1Mjd, Real state[6])
+{
+   Integer index = FindSegment(a1Mjd);
+   if (index < 0)
+      return false;
+
+   const Segment &segment = segments[index];
+   const Integer stride = BinaryEphemerisWriter::RECORD_SIZE;
+   Integer current = FindRecord(segment, a1Mjd);
+
+   if (segment.count == 1)
+   {
+      memcpy(state, records + current * stride + 1, 6 * sizeof(Real));
+      return true;
+   }
+
+   // Center the window on the interval, shifted to stay in the segment
+   Integer last = segment.first + segment.count - 1;
+   Integer from = current - HALF_WINDOW + 1;
+   Integer to   = current + HALF_WINDOW;
+   if (from < segment.first)
+   {
+      to += segment.first - from;
+      from = segment.first;
+   }
+   if (to > last)
+   {
+      from -= to - last;
+      to = last;
+   }
+   if (from < segment.first)
+      from = segment.first;
+
+   Integer nodeCount = to - from + 1;
+   Real times[2 * HALF_WINDOW];
+   Real epoch0 = records[from * stride];
+
+   for (Integer j = 0; j < nodeCount; ++j)
+      times[j] = (records[(from + j) * stride] - epoch0) *
+            GmatTimeConstants::SECS_PER_DAY;
+
+   GmatInterpolationUtil::HermiteState(nodeCount, times,
+         records + from * stride + 1, stride,
+         (a1Mjd - epoch0) * GmatTimeConstants::SECS_PER_DAY, state);
+
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// void MapFile()
+//------------------------------------------------------------------------------
+/**
+ * Maps the file read-only into memory.  On failure fileData is left NULL.
+ */
+//------------------------------------------------------------------------------
+void BinaryEphemerisReader::MapFile()
+{
+   #ifdef __WIN32__
+      HANDLE file = CreateFileA(theFileName.char_str(), GENERIC_READ,
+            FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+      if (file == INVALID_HANDLE_VALUE)
+         return;
+
+      LARGE_INTEGER size;
+      if (GetFileSizeEx(file, &size) && size.QuadPart > 0)
+      {
+         HANDLE mapping = CreateFileMapping(file, NULL, PAGE_READONLY, 0, 0,
+               NULL);
+         if (mapping != NULL)
+         {
+            // The view keeps the mapping open
+            void *view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+            CloseHandle(mapping);
+            if (view != NULL)
+            {
+               mapHandle = view;
+               fileData = (const char*)view;
+               fileSize = (size_t)size.QuadPart;
+            }
+         }
+      }
+      CloseHandle(file);
+   #else
+      int file = open(theFileName.char_str(), O_RDONLY);
+      if (file == -1)
+         return;
+
+      struct stat info;
+      if (fstat(file, &info) == 0 && info.st_size > 0)
+      {
+         void *view = mmap(NULL, info.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+         if (view != MAP_FAILED)
+         {
+            mapHandle = view;
+            fileData = (const char*)view;
+            fileSize = (size_t)info.st_size;
+         }
+      }
+      close(file);
+   #endif
+}
+
+
+//------------------------------------------------------------------------------
+// void UnmapFile()
+//------------------------------------------------------------------------------
+void BinaryEphemerisReader::UnmapFile()
+{
+   if (mapHandle == NULL)
+      return;
+
+   #ifdef __WIN32__
+      UnmapViewOfFile(mapHandle);
+   #else
+      munmap(mapHandle, fileSize);
+   #endif
+
+   mapHandle = NULL;
+}
+
+
+//------------------------------------------------------------------------------
+// wxString ReadName(Integer offset) const
+//------------------------------------------------------------------------------
+wxString BinaryEphemerisReader::ReadName(Integer offset) const
+{
+   char field[BinaryEphemerisWriter::NAME_SIZE + 1];
+   memcpy(field, fileData + offset, BinaryEphemerisWriter::NAME_SIZE);
+   field[BinaryEphemerisWriter::NAME_SIZE] = 0;
+   return wxString::FromAscii(field);
+}
+
+
+//------------------------------------------------------------------------------
+// Integer FindSegment(Real a1Mjd)
+//------------------------------------------------------------------------------
+/**
+ * Finds the segment containing an epoch.  Where segments meet, as they do at
+ * maneuvers, the later segment is used.
+ *
+ * @return The index of the segment, or -1 if no segment contains the epoch
+ */
+//------------------------------------------------------------------------------
+Integer BinaryEphemerisReader::FindSegment(Real a1Mjd)
+{
+   if (segments.empty())
+      return -1;
+
+   // Sequential requests usually stay in the same segment
+   if (lastSegment >= 0)
+   {
+      const Segment &previous = segments[lastSegment];
+      bool isLast = (lastSegment == (Integer)segments.size() - 1);
+      if (a1Mjd >= previous.start - EPOCH_SLOP &&
+          (a1Mjd < previous.end ||
+           (isLast && a1Mjd <= previous.end + EPOCH_SLOP)))
+         return lastSegment;
+   }
+
+   // Last segment starting at or before the epoch
+   Integer low = 0, high = segments.size() - 1;
+   if (a1Mjd < segments[0].start - EPOCH_SLOP)
+      return -1;
+   while (low < high)
+   {
+      Integer mid = (low + high + 1) / 2;
+      if (segments[mid].start <= a1Mjd)
+         low = mid;
+      else
+         high = mid - 1;
+   }
+
+   if (a1Mjd > segments[low].end + EPOCH_SLOP)
+      return -1;
+
+   lastSegment = low;
+   return low;
+}
+
+
+//------------------------------------------------------------------------------
+// Integer FindRecord(const Segment &segment, Real a1Mjd) const
+//------------------------------------------------------------------------------
+/**
+ * Finds the record that starts the interval containing an epoch.
+ *
+ * @return The record index, between the first and the next to last record of
+ *         the segment
+ */
+//------------------------------------------------------------------------------
+Integer BinaryEphemerisReader::FindRecord(const Segment &segment,
+                                          Real a1Mjd) const
+{
+   const Integer stride = BinaryEphemerisWriter::RECORD_SIZE;
+   Integer low = segment.first;
+   Integer high = segment.first + segment.count - 2;
+   if (high < low)
+      return low;
+
+   if (segment.step > 0.0)
+   {
+      Integer guess = segment.first + (Integer)floor((a1Mjd - segment.start) *
+            GmatTimeConstants::SECS_PER_DAY / segment.step);
+      if (guess < low)
+         guess = low;
+      if (guess > high)
+         guess = high;
+
+      // Epochs are rounded, so check the computed record and its neighbors
+      for (Integer i = guess - 1; i <= guess + 1; ++i)
+         if (i >= low && i <= high &&
+             records[i * stride] <= a1Mjd && a1Mjd <= records[(i+1) * stride])
+            return i;
+   }
+
+   while (low < high)
+   {
+      Integer mid = (low + high + 1) / 2;
+      if (records[mid * stride] <= a1Mjd)
+         low = mid;
+      else
+         high = mid - 1;
+   }
+
+   return low;
+}
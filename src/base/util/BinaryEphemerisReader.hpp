@@ -0,0 +1,107 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                             BinaryEphemerisReader
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002-2011 United States Government as represented by the
+// Administrator of The National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Created: 2026/10/18
+//
+/**
+ * Declares the reader for GMAT's native binary ephemeris format.
+ */
+//------------------------------------------------------------------------------
+#ifndef BinaryEphemerisReader_hpp
+#define BinaryEphemerisReader_hpp
+
+#include "gmatdefs.hpp"
+#include <vector>
+
+/**
+ * Samples a binary ephemeris file written by BinaryEphemerisWriter at
+ * arbitrary epochs.
+ *
+ * The file is memory mapped, so opening it does not read the records and
+ * only the pages that are sampled are loaded.  The segment containing an
+ * epoch is found from the segment index; in evenly spaced segments the
+ * record is then computed from the epoch directly.  States are interpolated
+ * with a Hermite polynomial through the positions and velocities of the
+ * nearest records.  Where the memory map is not available, the file is read
+ * into memory instead.
+ */
+class GMAT_API BinaryEphemerisReader
+{
+public:
+   BinaryEphemerisReader();
+   ~BinaryEphemerisReader();
+
+   void        Open(const wxString &fileName);
+   bool        IsOpen() const;
+   void        Close();
+
+   const wxString& GetFileName() const;
+   const wxString& GetObjectName() const;
+   const wxString& GetCentralBody() const;
+   const wxString& GetAxesType() const;
+   Real        GetStartEpoch() const;
+   Real        GetEndEpoch() const;
+   Integer     GetRecordCount() const;
+
+   bool        GetState(Real a1Mjd, Real state[6]);
+
+   /// Records used on each side of the epoch in the interpolation
+   static const Integer HALF_WINDOW = 2;
+
+protected:
+   /// Segment index entry
+   struct Segment
+   {
+      Integer  first;
+      Integer  count;
+      Real     start;
+      Real     end;
+      Real     step;
+
+      bool operator<(const Segment &other) const
+      {
+         return start < other.start;
+      }
+   };
+
+   wxString       theFileName;
+   wxString       objectName;
+   wxString       centralBody;
+   wxString       axesType;
+   Real           startEpoch;
+   Real           endEpoch;
+   Integer        recordCount;
+   std::vector<Segment> segments;
+   /// Segment used for the previous request
+   Integer        lastSegment;
+
+   /// Start of the file contents
+   const char     *fileData;
+   /// Size of the file contents in bytes
+   size_t         fileSize;
+   /// The records, in file order
+   const Real     *records;
+   /// Platform handle of the memory map, or NULL if the file was read
+   void           *mapHandle;
+   /// Copy of the file used when it is not mapped
+   std::vector<char> fileBuffer;
+
+   void           MapFile();
+   void           UnmapFile();
+   wxString       ReadName(Integer offset) const;
+   Integer        FindSegment(Real a1Mjd);
+   Integer        FindRecord(const Segment &segment, Real a1Mjd) const;
+
+private:
+   BinaryEphemerisReader(const BinaryEphemerisReader&);
+   BinaryEphemerisReader& operator=(const BinaryEphemerisReader&);
+};
+
+#endif // BinaryEphemerisReader_hpp
@@ -0,0 +1,295 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                             BinaryEphemerisWriter
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002-2011 United States Government as represented by the
+// Administrator of The National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Created: 2026/10/18
+//
+/**
+ * Implements the writer for GMAT's native binary ephemeris format.
+ */
+//------------------------------------------------------------------------------
+
+#include "BinaryEphemerisWriter.hpp"
+#include "UtilityException.hpp"
+#include "A1Mjd.hpp"
+#include "Rvector6.hpp"
+#include "TimeTypes.hpp"             // for SECS_PER_DAY
+#include "RealUtilities.hpp"         // for Abs()
+#include <cstring>                   // for memset()
+
+//#define DEBUG_BINARY_EPHEM_WRITER
+
+#ifdef DEBUG_BINARY_EPHEM_WRITER
+#include "MessageInterface.hpp"
+#endif
+
+//---------------------------------
+// static data
+//---------------------------------
+const char *BinaryEphemerisWriter::FILE_ID = "GMATEPHB";
+/// Tolerance, in seconds, on the spacing of evenly spaced records
+const Real BinaryEphemerisWriter::STEP_TOLERANCE = 1.0e-6;
+
+
+//------------------------------------------------------------------------------
+// BinaryEphemerisWriter()
+//------------------------------------------------------------------------------
+BinaryEphemerisWriter::BinaryEphemerisWriter() :
+   recordCount    (0),
+   startEpoch     (0.0),
+   endEpoch       (0.0)
+{
+}
+
+
+//------------------------------------------------------------------------------
+// ~BinaryEphemerisWriter()
+//------------------------------------------------------------------------------
+BinaryEphemerisWriter::~BinaryEphemerisWriter()
+{
+   try
+   {
+      Close();
+   }
+   catch (BaseException &)
+   {
+      // Destructors do not throw; the file is left incomplete
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// void Open(const wxString &fileName, const wxString &objectName,
+//           const wxString &centralBody, const wxString &axesType)
+//------------------------------------------------------------------------------
+/**
+ * Creates the file and writes a header with no records.
+ *
+ * @param fileName     The file to write
+ * @param objectName   Name of the object the states describe
+ * @param centralBody  Origin of the states
+ * @param axesType     Axes type of the states, e.g. "MJ2000Eq"
+ */
+//------------------------------------------------------------------------------
+void BinaryEphemerisWriter::Open(const wxString &fileName,
+      const wxString &objectName, const wxString &centralBody,
+      const wxString &axesType)
+{
+   Close();
+
+   outStream.open(fileName.char_str(), std::ios::out | std::ios::binary);
+   if (!outStream.is_open())
+      throw UtilityException(wxT("Cannot open the binary ephemeris file \"") +
+            fileName + wxT("\""));
+
+   theFileName = fileName;
+   segmentStart.clear();
+   segmentCount.clear();
+   segmentSpan.clear();
+   recordCount = 0;
+   startEpoch = 0.0;
+   endEpoch = 0.0;
+
+   WriteHeader(objectName, centralBody, axesType);
+}
+
+
+//------------------------------------------------------------------------------
+// bool IsOpen() const
+//------------------------------------------------------------------------------
+bool BinaryEphemerisWriter::IsOpen() const
+{
+   return outStream.is_open();
+}
+
+
+//------------------------------------------------------------------------------
+// void Flush()
+//------------------------------------------------------------------------------
+/**
+ * Writes the segment index and completes the header, so the file can be read
+ * while it stays open.  Later segments overwrite the index, which is written
+ * again by the next Flush() or Close().
+ */
+//------------------------------------------------------------------------------
+void BinaryEphemerisWriter::Flush()
+{
+   if (!outStream.is_open())
+      return;
+
+   std::streampos dataEnd = outStream.tellp();
+
+   for (UnsignedInt i = 0; i < segmentStart.size(); ++i)
+   {
+      outStream.write((const char*)&segmentStart[i], sizeof(Integer));
+      outStream.write((const char*)&segmentCount[i], sizeof(Integer));
+      outStream.write((const char*)&segmentSpan[i*3], 3 * sizeof(Real));
+   }
+
+   Integer segments = segmentStart.size();
+   outStream.seekp(8 + 2 * sizeof(Integer));
+   outStream.write((const char*)&segments, sizeof(Integer));
+   outStream.write((const char*)&recordCount, sizeof(Integer));
+   outStream.write((const char*)&startEpoch, sizeof(Real));
+   outStream.write((const char*)&endEpoch, sizeof(Real));
+   outStream.flush();
+   outStream.seekp(dataEnd);
+
+   #ifdef DEBUG_BINARY_EPHEM_WRITER
+   MessageInterface::ShowMessage
+      (wxT("BinaryEphemerisWriter::Flush() wrote %d records in %d segments ")
+       wxT("to '%s'\n"), recordCount, segments, theFileName.c_str());
+   #endif
+
+   if (!outStream)
+   {
+      outStream.close();
+      throw UtilityException(wxT("Failed to write the binary ephemeris file \"") +
+            theFileName + wxT("\""));
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// void Close()
+//------------------------------------------------------------------------------
+/**
+ * Writes the segment index, completes the header and closes the file.
+ */
+//------------------------------------------------------------------------------
+void BinaryEphemerisWriter::Close()
+{
+   if (!outStream.is_open())
+      return;
+
+   Flush();
+   outStream.close();
+}
+
+
+//------------------------------------------------------------------------------
+// void WriteSegment(const EpochArray &epochs, const StateArray &states)
+//------------------------------------------------------------------------------
+/**
+ * Appends a segment of records.
+ *
+ * Segments are written in time order; records within a segment are stored
+ * with increasing epochs even if they were generated backwards in time.
+ *
+ * @param epochs  A.1 modified Julian epochs of the states
+ * @param states  Cartesian states, in km and km/s
+ */
+//------------------------------------------------------------------------------
+void BinaryEphemerisWriter::WriteSegment(const EpochArray &epochs,
+                                         const StateArray &states)
+{
+   Integer count = epochs.size();
+   if (!outStream.is_open() || count == 0)
+      return;
+
+   bool reversed = (epochs.back()->GetReal() < epochs.front()->GetReal());
+   Real record[RECORD_SIZE];
+
+   for (Integer i = 0; i < count; ++i)
+   {
+      Integer index = (reversed ? count - 1 - i : i);
+      record[0] = epochs[index]->GetReal();
+      const Real *state = states[index]->GetDataVector();
+      for (Integer j = 0; j < 6; ++j)
+         record[j+1] = state[j];
+      outStream.write((const char*)record, RECORD_SIZE * sizeof(Real));
+   }
+
+   Real first = (reversed ? epochs.back() : epochs.front())->GetReal();
+   Real last  = (reversed ? epochs.front() : epochs.back())->GetReal();
+
+   // Evenly spaced segments let readers compute the record index directly
+   Real step = 0.0;
+   if (count > 1)
+   {
+      step = (last - first) * GmatTimeConstants::SECS_PER_DAY / (count - 1);
+      for (Integer i = 1; i < count; ++i)
+      {
+         Real dt = GmatMathUtil::Abs(epochs[i]->GetReal() -
+               epochs[i-1]->GetReal()) * GmatTimeConstants::SECS_PER_DAY;
+         if (GmatMathUtil::Abs(dt - step) > STEP_TOLERANCE)
+         {
+            step = 0.0;
+            break;
+         }
+      }
+   }
+
+   segmentStart.push_back(recordCount);
+   segmentCount.push_back(count);
+   segmentSpan.push_back(first);
+   segmentSpan.push_back(last);
+   segmentSpan.push_back(step);
+
+   if (recordCount == 0 || first < startEpoch)
+      startEpoch = first;
+   if (recordCount == 0 || last > endEpoch)
+      endEpoch = last;
+   recordCount += count;
+
+   #ifdef DEBUG_BINARY_EPHEM_WRITER
+   MessageInterface::ShowMessage
+      (wxT("BinaryEphemerisWriter::WriteSegment() wrote %d records from %.12f ")
+       wxT("to %.12f, step = %f\n"), count, first, last, step);
+   #endif
+}
+
+
+//------------------------------------------------------------------------------
+// void WriteHeader(const wxString &objectName, const wxString &centralBody,
+//                  const wxString &axesType)
+//------------------------------------------------------------------------------
+void BinaryEphemerisWriter::WriteHeader(const wxString &objectName,
+      const wxString &centralBody, const wxString &axesType)
+{
+   Integer version = FORMAT_VERSION, recordSize = RECORD_SIZE, zero = 0;
+
+   outStream.write(FILE_ID, 8);
+   outStream.write((const char*)&version, sizeof(Integer));
+   outStream.write((const char*)&recordSize, sizeof(Integer));
+   outStream.write((const char*)&zero, sizeof(Integer));
+   outStream.write((const char*)&zero, sizeof(Integer));
+   outStream.write((const char*)&startEpoch, sizeof(Real));
+   outStream.write((const char*)&endEpoch, sizeof(Real));
+
+   WriteName(objectName);
+   WriteName(centralBody);
+   WriteName(axesType);
+
+   char padding[HEADER_SIZE];
+   memset(padding, 0, HEADER_SIZE);
+   Integer used = 8 + 4 * sizeof(Integer) + 2 * sizeof(Real) + 3 * NAME_SIZE;
+   outStream.write(padding, HEADER_SIZE - used);
+}
+
+
+//------------------------------------------------------------------------------
+// void WriteName(const wxString &name)
+//------------------------------------------------------------------------------
+/**
+ * Writes a name into a zero padded field of NAME_SIZE characters.  Longer
+ * names are truncated.
+ */
+//------------------------------------------------------------------------------
+void BinaryEphemerisWriter::WriteName(const wxString &name)
+{
+   char field[NAME_SIZE];
+   memset(field, 0, NAME_SIZE);
+
+   std::string text(name.char_str());
+   for (UnsignedInt i = 0; i < text.length() && i < (UnsignedInt)NAME_SIZE - 1; ++i)
+      field[i] = text[i];
+
+   outStream.write(field, NAME_SIZE);
+}
@@ -0,0 +1,95 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                             BinaryEphemerisWriter
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002-2011 United States Government as represented by the
+// Administrator of The National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Created: 2026/10/18
+//
+/**
+ * Declares the writer for GMAT's native binary ephemeris format.
+ */
+//------------------------------------------------------------------------------
+#ifndef BinaryEphemerisWriter_hpp
+#define BinaryEphemerisWriter_hpp
+
+#include "gmatdefs.hpp"
+#include <fstream>
+
+/**
+ * Writes orbit states to a binary ephemeris file.
+ *
+ * The format uses the native byte order, with 4-byte Integers and 8-byte
+ * Reals:
+ *
+ *   header:   8 characters "GMATEPHB", Integer version (1), Integer record
+ *             size in Reals (7), Integer segment count, Integer record count,
+ *             Real start and end epochs (A.1 modified Julian), then the object
+ *             name, central body and axes type in NAME_SIZE characters each,
+ *             padded with zeros to HEADER_SIZE bytes
+ *   records:  epoch, X, Y, Z, VX, VY and VZ as Reals, in km and km/s
+ *   index:    for each segment, Integer first record, Integer record count,
+ *             Real start epoch, Real end epoch and Real step in seconds (0.0
+ *             if the records are not evenly spaced)
+ *
+ * Every record has the same size, so a record is found from its index alone.
+ * The header counts and the segment index are written when the file is
+ * flushed or closed.
+ */
+class GMAT_API BinaryEphemerisWriter
+{
+public:
+   BinaryEphemerisWriter();
+   ~BinaryEphemerisWriter();
+
+   void        Open(const wxString &fileName, const wxString &objectName,
+                    const wxString &centralBody, const wxString &axesType);
+   bool        IsOpen() const;
+   void        Flush();
+   void        Close();
+
+   void        WriteSegment(const EpochArray &epochs, const StateArray &states);
+
+   /// Format identifier at the start of the file
+   static const char        *FILE_ID;
+   /// Format version
+   static const Integer     FORMAT_VERSION = 1;
+   /// Reals per record: the epoch and the Cartesian state
+   static const Integer     RECORD_SIZE = 7;
+   /// Characters stored for each name in the header
+   static const Integer     NAME_SIZE = 32;
+   /// Size of the header in bytes; records start here
+   static const Integer     HEADER_SIZE = 160;
+   /// Size of a segment index entry in bytes
+   static const Integer     INDEX_ENTRY_SIZE = 32;
+   /// Relative tolerance used to decide that records are evenly spaced
+   static const Real        STEP_TOLERANCE;
+
+protected:
+   std::ofstream  outStream;
+   wxString       theFileName;
+   /// First record of each segment
+   IntegerArray   segmentStart;
+   /// Number of records in each segment
+   IntegerArray   segmentCount;
+   /// Start epoch, end epoch and step of each segment
+   RealArray      segmentSpan;
+   Integer        recordCount;
+   Real           startEpoch;
+   Real           endEpoch;
+
+   void           WriteHeader(const wxString &objectName,
+                              const wxString &centralBody,
+                              const wxString &axesType);
+   void           WriteName(const wxString &name);
+
+private:
+   BinaryEphemerisWriter(const BinaryEphemerisWriter&);
+   BinaryEphemerisWriter& operator=(const BinaryEphemerisWriter&);
+};
+
+#endif // BinaryEphemerisWriter_hpp
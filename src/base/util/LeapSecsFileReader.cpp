@@ -176,3 +176,59 @@ Real LeapSecsFileReader::NumberOfLeapSecondsFrom(UtcMjd utcMjd)
    else
       return 0;
 }
+
+//------------------------------------------------------------------------------
+// bool GetLeapSecondSpan(UtcMjd utcMjd, Real &spanStartJd, Real &spanEndJd,
+//                        LeapSecondInformation &info)
+//------------------------------------------------------------------------------
+/**
+ * Looks up the table entry that applies at the input epoch, along with the
+ * julian date span over which that entry stays in effect.
+ *
+ * Batch time conversions use the span to reuse one table lookup for every
+ * epoch that falls inside it.  An epoch is inside the span when
+ * spanStartJd < jd <= spanEndJd, matching NumberOfLeapSecondsFrom().
+ *
+ * @param utcMjd      The utc mjd to look up
+ * @param spanStartJd Julian date at which the entry takes effect
+ * @param spanEndJd   Julian date at which the next entry takes effect
+ * @param info        The table entry; leap seconds are computed as
+ *                    offset1 + (utcMjd - offset2) * offset3
+ *
+ * @return true if the table is loaded, false otherwise
+ */
+//------------------------------------------------------------------------------
+bool LeapSecsFileReader::GetLeapSecondSpan(UtcMjd utcMjd, Real &spanStartJd,
+                                           Real &spanEndJd,
+                                           LeapSecondInformation &info)
+{
+   if (!isInitialized || lookUpTable.empty())
+      return false;
+   
+   Real jd = utcMjd + GmatTimeConstants::JD_MJD_OFFSET;
+   Integer count = lookUpTable.size();
+   
+   for (Integer i = count - 1; i >= 0; --i)
+   {
+      if (jd > lookUpTable[i].julianDate)
+      {
+         info = lookUpTable[i];
+         spanStartJd = lookUpTable[i].julianDate;
+         if (i == count - 1)
+            spanEndJd = GmatRealConstants::REAL_MAX;
+         else
+            spanEndJd = lookUpTable[i+1].julianDate;
+         return true;
+      }
+   }
+   
+   // Before the first entry; no leap seconds
+   info.julianDate = -GmatRealConstants::REAL_MAX;
+   info.offset1 = 0.0;
+   info.offset2 = 0.0;
+   info.offset3 = 0.0;
+   spanStartJd = -GmatRealConstants::REAL_MAX;
+   spanEndJd = lookUpTable[0].julianDate;
+   
+   return true;
+}
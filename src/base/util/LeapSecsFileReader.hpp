@@ -55,6 +55,8 @@ public:
 
    bool Initialize();
    Real    NumberOfLeapSecondsFrom(UtcMjd utcMjd);
+   bool    GetLeapSecondSpan(UtcMjd utcMjd, Real &spanStartJd,
+                             Real &spanEndJd, LeapSecondInformation &info);
 
 private:
 
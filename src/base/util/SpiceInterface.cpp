@@ -87,6 +87,8 @@ const Integer SpiceInterface::MAX_CHAR_COMMENT          = 4000;
 
 /// array of files (kernels) currently loaded
 StringArray    SpiceInterface::loadedKernels;
+/// counter incremented whenever the set of loaded kernels changes
+Integer        SpiceInterface::kernelPoolVersion = 0;
 /// counter of number of instances created
 Integer        SpiceInterface::numInstances = 0;
 /// the name (full path) of the leap second kernel to use
@@ -231,6 +233,7 @@ bool SpiceInterface::LoadKernel(const wxString &fileName)
       }
    #endif
    loadedKernels.push_back(fileName);
+   ++kernelPoolVersion;
    
    return true;
 }
@@ -278,6 +281,7 @@ bool SpiceInterface::UnloadKernel(const wxString &fileName)
       {
          found = true;
          loadedKernels.erase(jj);
+         ++kernelPoolVersion;
          break;
       }
    if (!found)
@@ -375,6 +379,7 @@ bool SpiceInterface::UnloadAllKernels()
       // @todo - handle exceptional conditions (SPICE signals) here ...
    }
    loadedKernels.clear();
+   ++kernelPoolVersion;
    return true;
 }
 
@@ -101,6 +101,8 @@ protected:
    
    /// array of files (kernels) currently loaded
    static StringArray    loadedKernels;
+   /// counter incremented whenever the set of loaded kernels changes
+   static Integer        kernelPoolVersion;
    /// counter of number of instances created
    static Integer        numInstances;
    /// the name (full path) of the leap second kernel to use
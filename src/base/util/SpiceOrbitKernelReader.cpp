@@ -30,16 +30,23 @@
 #include "TimeTypes.hpp"
 #include "TimeSystemConverter.hpp"
 #include "UtilityException.hpp"
+#include "RealUtilities.hpp"
+#include "HermiteInterpolation.hpp"     // for HermiteState()
 
 
 //#define DEBUG_SPK_READING
 //#define DEBUG_SPK_COVERAGE
 //#define DEBUG_SPK_PLANETS
+//#define DEBUG_SPK_CACHE
 
 // -----------------------------------------------------------------------------
 // static data
 // -----------------------------------------------------------------------------
-// none
+const Real SpiceOrbitKernelReader::INITIAL_CACHE_STEP       = 1.0;
+const Real SpiceOrbitKernelReader::MIN_CACHE_STEP           = 60.0 /
+                                               GmatTimeConstants::SECS_PER_DAY;
+const Real SpiceOrbitKernelReader::CACHE_POSITION_TOLERANCE = 1.0e-6;
+const Real SpiceOrbitKernelReader::CACHE_VELOCITY_TOLERANCE = 1.0e-9;
 
 
 // -----------------------------------------------------------------------------
@@ -103,6 +110,7 @@ SpiceOrbitKernelReader& SpiceOrbitKernelReader::operator=(const SpiceOrbitKernel
 
    observingBodyNameSPICE   = NULL;
    aberrationSPICE          = NULL;
+   stateCaches.clear();
 
    return *this;
 }
@@ -419,3 +427,353 @@ Rvector6 SpiceOrbitKernelReader::GetTargetState(const wxString &targetName,
    Rvector6 r6(state[0],state[1],state[2],state[3],state[4],state[5]);
    return r6;
 }
+
+
+//------------------------------------------------------------------------------
+//  Rvector6 GetCachedTargetState(const wxString &targetName,
+//                                const Integer     targetNAIFId,
+//                                const A1Mjd       &atTime,
+//                                const wxString &observingBodyName)
+//------------------------------------------------------------------------------
+/**
+ * This method returns the J2000 state of the target with respect to the
+ * observing body at the input time, without aberration corrections.
+ *
+ * States are read from the kernels on a grid of evenly spaced epochs, a block
+ * of CACHE_NODES at a time, and requests are interpolated with a Hermite
+ * polynomial through the positions and velocities of the four nearest nodes.
+ * The grid spacing is halved until the interpolated states match the kernels
+ * to CACHE_POSITION_TOLERANCE and CACHE_VELOCITY_TOLERANCE; targets needing a
+ * spacing below MIN_CACHE_STEP, and epochs too close to the ends of the
+ * kernel coverage, are read directly.  The CACHE_BLOCKS most recently used
+ * blocks are kept for each target, so requests that move back and forth in
+ * time, such as a propagation and its event searches, do not reread the
+ * kernels.  Only bodies that move smoothly should be read this way;
+ * spacecraft ephemerides may contain maneuvers.
+ *
+ * @param <targetName>        name of the target object.
+ * @param <targetNAIFId>      NAIF ID of the target object.
+ * @param <atTime>            time at which the state is requested.
+ * @param <observingBodyName> name of the observing body
+ *
+ * @return state at the input time
+ */
+//------------------------------------------------------------------------------
+Rvector6 SpiceOrbitKernelReader::GetCachedTargetState(const wxString &targetName,
+                                 const Integer     targetNAIFId,
+                                 const A1Mjd       &atTime,
+                                 const wxString &observingBodyName)
+{
+   Real a1Mjd = atTime.Get();
+
+   std::map<Integer, StateCache>::iterator entry =
+         stateCaches.find(targetNAIFId);
+   bool isNew = (entry == stateCaches.end());
+   if (isNew)
+      entry = stateCaches.insert(
+            std::make_pair(targetNAIFId, StateCache())).first;
+
+   // Start over if the kernels or the observer changed
+   StateCache &cache = entry->second;
+   if (isNew || cache.kernelVersion != kernelPoolVersion ||
+       cache.observer != observingBodyName)
+   {
+      cache.observer      = observingBodyName;
+      cache.kernelVersion = kernelPoolVersion;
+      cache.step          = -1.0;
+      cache.coverageStart = 0.0;
+      cache.coverageEnd   = 0.0;
+      cache.blocks.clear();
+   }
+
+   std::list<CacheBlock>::iterator block = FindCacheBlock(cache, a1Mjd);
+   if (block == cache.blocks.end())
+   {
+      FillStateCache(cache, targetName, targetNAIFId, a1Mjd);
+      block = FindCacheBlock(cache, a1Mjd);
+   }
+
+   if ((block == cache.blocks.end()) || block->nodes.empty())
+      return GetTargetState(targetName, targetNAIFId, atTime,
+                            observingBodyName);
+
+   Real state[6];
+   InterpolateCache(*block,
+         (Integer)GmatMathUtil::Floor(a1Mjd / block->step), a1Mjd, state);
+
+   return Rvector6(state);
+}
+
+
+//------------------------------------------------------------------------------
+// bool FillStateCache(StateCache &cache, const wxString &targetName,
+//                     const Integer targetNAIFId, Real a1Mjd)
+//------------------------------------------------------------------------------
+/**
+ * Reads the block of nodes used to interpolate the state at an epoch,
+ * choosing a smaller grid spacing if the block is not accurate enough.  The
+ * blocks already cached are kept when no block can be read for the epoch.
+ *
+ * @return true if the cache holds the states needed at the epoch
+ */
+//------------------------------------------------------------------------------
+bool SpiceOrbitKernelReader::FillStateCache(StateCache &cache,
+      const wxString &targetName, const Integer targetNAIFId, Real a1Mjd)
+{
+   if (cache.step < 0.0)
+   {
+      // Read the target directly unless its coverage is known
+      cache.step = 0.0;
+      try
+      {
+         GetCoverageStartAndEnd(loadedKernels, targetNAIFId,
+               cache.coverageStart, cache.coverageEnd);
+      }
+      catch (BaseException &)
+      {
+         return false;
+      }
+      cache.step = INITIAL_CACHE_STEP;
+   }
+
+   CacheBlock block;
+   while (cache.step >= MIN_CACHE_STEP)
+   {
+      Integer interval = (Integer)GmatMathUtil::Floor(a1Mjd / cache.step);
+      Integer lowest   =
+            (Integer)GmatMathUtil::Ceiling(cache.coverageStart / cache.step);
+      Integer highest  =
+            (Integer)GmatMathUtil::Floor(cache.coverageEnd / cache.step);
+
+      // Near the ends of the coverage the nodes would be outside the kernels,
+      // so the epoch is read directly
+      if ((interval - 1 < lowest) || (interval + 2 > highest))
+         return false;
+
+      Integer first = interval + 2 - CACHE_NODES / 2;
+      if (first + CACHE_NODES - 1 > highest)
+         first = highest - CACHE_NODES + 1;
+      if (first < lowest)
+         first = lowest;
+      Integer count = highest - first + 1;
+      if (count > CACHE_NODES)
+         count = CACHE_NODES;
+
+      ReadCacheNodes(block, cache, targetName, targetNAIFId, first, count);
+
+      // The block is kept so its epochs are read directly without retrying
+      if (block.nodes.empty())
+      {
+         AddCacheBlock(cache, block);
+         return false;
+      }
+
+      if (IsCacheAccurate(block, cache, targetName, targetNAIFId))
+      {
+         AddCacheBlock(cache, block);
+         return true;
+      }
+
+      cache.step /= 2.0;
+   }
+
+   #ifdef DEBUG_SPK_CACHE
+      MessageInterface::ShowMessage(wxT("Caching disabled for %s (ID = %d)\n"),
+            targetName.c_str(), targetNAIFId);
+   #endif
+
+   cache.step = 0.0;
+   cache.blocks.clear();
+   return false;
+}
+
+
+//------------------------------------------------------------------------------
+// void AddCacheBlock(StateCache &cache, const CacheBlock &block)
+//------------------------------------------------------------------------------
+/**
+ * Adds a block as the most recently used one, dropping the least recently
+ * used block if the cache already holds CACHE_BLOCKS.
+ */
+//------------------------------------------------------------------------------
+void SpiceOrbitKernelReader::AddCacheBlock(StateCache &cache,
+      const CacheBlock &block)
+{
+   cache.blocks.push_front(block);
+   if ((Integer)cache.blocks.size() > CACHE_BLOCKS)
+      cache.blocks.pop_back();
+}
+
+
+//------------------------------------------------------------------------------
+// void ReadCacheNodes(CacheBlock &block, const StateCache &cache,
+//                     const wxString &targetName, const Integer targetNAIFId,
+//                     Integer firstNode, Integer nodeCount)
+//------------------------------------------------------------------------------
+/**
+ * Reads the states at a block of grid epochs, spaced at the cache's current
+ * step.  If the kernels cannot supply one of them, the block is left without
+ * nodes.
+ */
+//------------------------------------------------------------------------------
+void SpiceOrbitKernelReader::ReadCacheNodes(CacheBlock &block,
+      const StateCache &cache, const wxString &targetName,
+      const Integer targetNAIFId, Integer firstNode, Integer nodeCount)
+{
+   #ifdef DEBUG_SPK_CACHE
+      MessageInterface::ShowMessage(wxT("Caching %d states of %s (ID = %d) ")
+            wxT("from %.12f every %.8f days\n"), nodeCount, targetName.c_str(),
+            targetNAIFId, firstNode * cache.step, cache.step);
+   #endif
+
+   block.step      = cache.step;
+   block.firstNode = firstNode;
+   block.nodeCount = nodeCount;
+   block.nodes.clear();
+   block.nodes.reserve(6 * nodeCount);
+
+   try
+   {
+      for (Integer i = 0; i < nodeCount; ++i)
+      {
+         A1Mjd nodeTime((firstNode + i) * block.step);
+         Rvector6 nodeState = GetTargetState(targetName, targetNAIFId,
+               nodeTime, cache.observer);
+         const Real *data = nodeState.GetDataVector();
+         block.nodes.insert(block.nodes.end(), data, data + 6);
+      }
+   }
+   catch (BaseException &)
+   {
+      block.nodes.clear();
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// bool IsCacheAccurate(const CacheBlock &block, const StateCache &cache,
+//                      const wxString &targetName, const Integer targetNAIFId)
+//------------------------------------------------------------------------------
+/**
+ * Compares interpolated states with states read from the kernels halfway
+ * between nodes at the start, middle and end of a block.
+ *
+ * @return true if the errors are within the cache tolerances
+ */
+//------------------------------------------------------------------------------
+bool SpiceOrbitKernelReader::IsCacheAccurate(const CacheBlock &block,
+      const StateCache &cache, const wxString &targetName,
+      const Integer targetNAIFId)
+{
+   if (block.nodeCount < 4)
+      return false;
+
+   Integer intervals[3] = { block.firstNode + 1,
+                            block.firstNode + block.nodeCount / 2 - 1,
+                            block.firstNode + block.nodeCount - 3 };
+   Real state[6];
+
+   try
+   {
+      for (Integer i = 0; i < 3; ++i)
+      {
+         Real a1Mjd = (intervals[i] + 0.5) * block.step;
+         Rvector6 truth = GetTargetState(targetName, targetNAIFId,
+               A1Mjd(a1Mjd), cache.observer);
+         InterpolateCache(block, intervals[i], a1Mjd, state);
+
+         Real dr = 0.0, dv = 0.0;
+         for (Integer j = 0; j < 3; ++j)
+         {
+            dr += (state[j] - truth[j]) * (state[j] - truth[j]);
+            dv += (state[j+3] - truth[j+3]) * (state[j+3] - truth[j+3]);
+         }
+
+         #ifdef DEBUG_SPK_CACHE
+            MessageInterface::ShowMessage(wxT("   Cache errors for %s at %.12f: ")
+                  wxT("%le km, %le km/s\n"), targetName.c_str(), a1Mjd,
+                  GmatMathUtil::Sqrt(dr), GmatMathUtil::Sqrt(dv));
+         #endif
+
+         if ((dr > CACHE_POSITION_TOLERANCE * CACHE_POSITION_TOLERANCE) ||
+             (dv > CACHE_VELOCITY_TOLERANCE * CACHE_VELOCITY_TOLERANCE))
+            return false;
+      }
+   }
+   catch (BaseException &)
+   {
+      return false;
+   }
+
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// bool IsCoveredByBlock(const CacheBlock &block, Real a1Mjd) const
+//------------------------------------------------------------------------------
+/**
+ * Checks that the four nodes used to interpolate at an epoch are in a block.
+ */
+//------------------------------------------------------------------------------
+bool SpiceOrbitKernelReader::IsCoveredByBlock(const CacheBlock &block,
+                                              Real a1Mjd) const
+{
+   if ((block.step <= 0.0) || (block.nodeCount == 0))
+      return false;
+
+   Integer interval = (Integer)GmatMathUtil::Floor(a1Mjd / block.step);
+   return (interval - 1 >= block.firstNode) &&
+          (interval + 2 <= block.firstNode + block.nodeCount - 1);
+}
+
+
+//------------------------------------------------------------------------------
+// std::list<CacheBlock>::iterator FindCacheBlock(StateCache &cache,
+//                                                Real a1Mjd)
+//------------------------------------------------------------------------------
+/**
+ * Finds the cached block covering an epoch and marks it as the most recently
+ * used.
+ *
+ * @return the block, or the end of the block list if no block covers the epoch
+ */
+//------------------------------------------------------------------------------
+std::list<SpiceOrbitKernelReader::CacheBlock>::iterator
+      SpiceOrbitKernelReader::FindCacheBlock(StateCache &cache, Real a1Mjd)
+{
+   std::list<CacheBlock>::iterator block;
+   for (block = cache.blocks.begin(); block != cache.blocks.end(); ++block)
+   {
+      if (IsCoveredByBlock(*block, a1Mjd))
+      {
+         if (block != cache.blocks.begin())
+            cache.blocks.splice(cache.blocks.begin(), cache.blocks, block);
+         return cache.blocks.begin();
+      }
+   }
+
+   return cache.blocks.end();
+}
+
+
+//------------------------------------------------------------------------------
+// void InterpolateCache(const CacheBlock &block, Integer interval, Real a1Mjd,
+//                       Real state[6]) const
+//------------------------------------------------------------------------------
+/**
+ * Interpolates the state at an epoch in a grid interval from the two nodes on
+ * either side of it.
+ */
+//------------------------------------------------------------------------------
+void SpiceOrbitKernelReader::InterpolateCache(const CacheBlock &block,
+      Integer interval, Real a1Mjd, Real state[6]) const
+{
+   Real stepInSecs = block.step * GmatTimeConstants::SECS_PER_DAY;
+   Real times[4] = { 0.0, stepInSecs, 2.0 * stepInSecs, 3.0 * stepInSecs };
+
+   GmatInterpolationUtil::HermiteState(4, times,
+         &block.nodes[6 * (interval - 1 - block.firstNode)], 6,
+         (a1Mjd - (interval - 1) * block.step) *
+         GmatTimeConstants::SECS_PER_DAY, state);
+}
@@ -29,6 +29,8 @@
 #include "Rvector6.hpp"
 #include "Rmatrix33.hpp"
 #include "SpiceKernelReader.hpp"
+#include <map>
+#include <list>
 
 class GMAT_API SpiceOrbitKernelReader : public SpiceKernelReader
 {
@@ -59,9 +61,57 @@ public:
                             const wxString &referenceFrame = wxT("J2000"),
                             const wxString &aberration = wxT("NONE"));
 
+   /// method to return the J2000 state of a smoothly moving body, such as a
+   /// planet or an asteroid, interpolated from states cached from the kernels
+   Rvector6  GetCachedTargetState(const wxString &targetName,
+                                  const Integer     targetNAIFId,
+                                  const A1Mjd       &atTime,
+                                  const wxString &observingBodyName);
 
+   /// Number of evenly spaced states in each cached block
+   static const Integer CACHE_NODES = 64;
+   /// Number of blocks kept for each cached target
+   static const Integer CACHE_BLOCKS = 4;
+   /// Node spacing tried first when a target is cached, in days
+   static const Real    INITIAL_CACHE_STEP;
+   /// Smallest node spacing used before a target is read directly, in days
+   static const Real    MIN_CACHE_STEP;
+   /// Largest position error accepted from the cache, in km
+   static const Real    CACHE_POSITION_TOLERANCE;
+   /// Largest velocity error accepted from the cache, in km/s
+   static const Real    CACHE_VELOCITY_TOLERANCE;
 
 protected:
+   /// States of one target on a block of evenly spaced epochs
+   struct CacheBlock
+   {
+      /// Node spacing in days
+      Real        step;
+      /// Grid index of the first node
+      Integer     firstNode;
+      /// Number of nodes in the block; the nodes are empty if reading the
+      /// kernels failed over it
+      Integer     nodeCount;
+      /// Position and velocity at each node
+      RealArray   nodes;
+   };
+
+   /// Cached blocks of one target
+   struct StateCache
+   {
+      /// Observer the states are relative to
+      wxString    observer;
+      /// Kernel pool version the states were read from
+      Integer     kernelVersion;
+      /// Node spacing in days for new blocks; 0 if the target is read
+      /// directly, -1 if the spacing has not been chosen yet
+      Real        step;
+      /// Earliest and latest epochs covered by the kernels
+      Real        coverageStart;
+      Real        coverageEnd;
+      /// Up to CACHE_BLOCKS blocks, the most recently used first
+      std::list<CacheBlock> blocks;
+   };
 
    // data converted to SPICE types, to pass into SPICE methods
    /// the observing body name (SPICE)
@@ -69,6 +119,25 @@ protected:
    /// the aberration correction flag (SPICE)
    ConstSpiceChar  *aberrationSPICE;
 
+   /// cached states, by NAIF ID
+   std::map<Integer, StateCache> stateCaches;
+
+   bool      FillStateCache(StateCache &cache, const wxString &targetName,
+                            const Integer targetNAIFId, Real a1Mjd);
+   void      AddCacheBlock(StateCache &cache, const CacheBlock &block);
+   void      ReadCacheNodes(CacheBlock &block, const StateCache &cache,
+                            const wxString &targetName,
+                            const Integer targetNAIFId, Integer firstNode,
+                            Integer nodeCount);
+   bool      IsCacheAccurate(const CacheBlock &block, const StateCache &cache,
+                             const wxString &targetName,
+                             const Integer targetNAIFId);
+   bool      IsCoveredByBlock(const CacheBlock &block, Real a1Mjd) const;
+   std::list<CacheBlock>::iterator
+             FindCacheBlock(StateCache &cache, Real a1Mjd);
+   void      InterpolateCache(const CacheBlock &block, Integer interval,
+                              Real a1Mjd, Real state[6]) const;
+
 };
 
 #endif // SpiceOrbitKernelReader_hpp
@@ -26,6 +26,7 @@
 #include "StringUtil.hpp"          // for ToReal()
 #include "GmatGlobal.hpp"          // for TIME_PRECISION
 #include "MessageInterface.hpp"
+#include <cmath>                   // for sin(), cos() in the batch loops
 
 //#define DEBUG_FIRST_CALL
 //#define DEBUG_TIMECONVERTER_DETAILS
@@ -43,6 +44,68 @@ using namespace GmatMathUtil;
 static EopFile *theEopFile;
 static LeapSecsFileReader *theLeapSecsFileReader;
 
+//------------------------------------------------------------------------------
+// Helpers for the batch conversions
+//------------------------------------------------------------------------------
+/**
+ * Leap second table entry reused across a batch of epochs, so that the table
+ * is only searched when an epoch leaves the span of the current entry.
+ */
+struct LeapSecondSpan
+{
+   bool                  isValid;
+   Real                  startJd;
+   Real                  endJd;
+   LeapSecondInformation info;
+};
+
+//------------------------------------------------------------------------------
+// Real LeapSecondsFrom(Real utcMjd, LeapSecondSpan &span)
+//------------------------------------------------------------------------------
+/**
+ * Batch equivalent of LeapSecsFileReader::NumberOfLeapSecondsFrom().
+ */
+//------------------------------------------------------------------------------
+static Real LeapSecondsFrom(Real utcMjd, LeapSecondSpan &span)
+{
+   Real jd = utcMjd + GmatTimeConstants::JD_MJD_OFFSET;
+   
+   if (!span.isValid || (jd <= span.startJd) || (jd > span.endJd))
+      span.isValid = theLeapSecsFileReader->GetLeapSecondSpan(utcMjd,
+            span.startJd, span.endJd, span.info);
+   
+   if (!span.isValid)
+      return 0.0;
+   
+   return span.info.offset1 + ((utcMjd - span.info.offset2) * span.info.offset3);
+}
+
+//------------------------------------------------------------------------------
+// wxChar* WriteDigits(wxChar *cursor, Integer value, Integer width)
+//------------------------------------------------------------------------------
+/**
+ * Writes a zero padded non-negative integer and returns the next position.
+ */
+//------------------------------------------------------------------------------
+static wxChar* WriteDigits(wxChar *cursor, Integer value, Integer width)
+{
+   wxChar digits[12];
+   Integer count = 0;
+   
+   do
+   {
+      digits[count++] = wxT('0') + (value % 10);
+      value /= 10;
+   } while (value > 0);
+   
+   for (Integer i = count; i < width; ++i)
+      *cursor++ = wxT('0');
+   while (count > 0)
+      *cursor++ = digits[--count];
+   
+   return cursor;
+}
+
 //------------------------------------------------------------------------------
 // Integer GetTimeTypeID(wxString &str) 
 //------------------------------------------------------------------------------
@@ -424,6 +487,301 @@ Real TimeConverterUtil::ConvertFromTaiMjd(Integer toType, Real origValue,
 }
 
 
+//---------------------------------------------------------------------------
+// void Convert(const Real *origValues, Real *newValues, const Integer count,
+//              const Integer fromType, const Integer toType, Real refJd)
+//---------------------------------------------------------------------------
+/**
+ * Converts an array of epochs from one time system to another.
+ *
+ * The results match element by element calls to the scalar Convert(), but
+ * the time system dispatch is done once for the whole array and the leap
+ * second and EOP table lookups are reused while the epochs stay inside the
+ * same table entry.  Sorted input gets the most reuse.
+ *
+ * @param origValues  The epochs to convert
+ * @param newValues   The converted epochs; may be the same array as origValues
+ * @param count       The number of epochs
+ * @param fromType    Time system of the input epochs
+ * @param toType      Time system of the output epochs
+ * @param refJd       The reference julian date of the epochs
+ */
+//---------------------------------------------------------------------------
+void TimeConverterUtil::Convert(const Real *origValues, Real *newValues,
+                                const Integer count, const Integer fromType,
+                                const Integer toType, Real refJd)
+{
+   if (count <= 0)
+      return;
+   
+   #ifdef DEBUG_TIMECONVERTER_DETAILS
+      MessageInterface::ShowMessage(
+         wxT("      TimeConverterUtil::Converting %d epochs from %s to %s; ")
+         wxT("refJD = %.18lf\n"), count, TIME_SYSTEM_TEXT[fromType].c_str(),
+         TIME_SYSTEM_TEXT[toType].c_str(), refJd);
+   #endif
+   
+   // Both passes work in place in newValues
+   TimeConverterUtil::ConvertToTaiMjd(fromType, origValues, newValues, count,
+         refJd);
+   TimeConverterUtil::ConvertFromTaiMjd(toType, newValues, newValues, count,
+         refJd);
+}
+
+
+//---------------------------------------------------------------------------
+// void Convert(const RealArray &origValues, RealArray &newValues,
+//              const Integer fromType, const Integer toType, Real refJd)
+//---------------------------------------------------------------------------
+void TimeConverterUtil::Convert(const RealArray &origValues,
+                                RealArray &newValues, const Integer fromType,
+                                const Integer toType, Real refJd)
+{
+   newValues.resize(origValues.size());
+   if (origValues.empty())
+      return;
+   
+   TimeConverterUtil::Convert(&origValues[0], &newValues[0],
+         origValues.size(), fromType, toType, refJd);
+}
+
+
+//---------------------------------------------------------------------------
+// void ConvertToTaiMjd(Integer fromType, const Real *origValues,
+//                      Real *taiValues, const Integer count, Real refJd)
+//---------------------------------------------------------------------------
+/**
+ * Batch version of ConvertToTaiMjd(); taiValues may alias origValues.
+ */
+//---------------------------------------------------------------------------
+void TimeConverterUtil::ConvertToTaiMjd(Integer fromType,
+                                        const Real *origValues,
+                                        Real *taiValues, const Integer count,
+                                        Real refJd)
+{
+   switch(fromType)
+   {
+    case TimeConverterUtil::A1MJD:
+    case TimeConverterUtil::A1:
+    {
+       const Real offset =
+             GmatTimeConstants::A1_TAI_OFFSET/GmatTimeConstants::SECS_PER_DAY;
+       for (Integer i = 0; i < count; ++i)
+          taiValues[i] = origValues[i] - offset;
+       break;
+    }
+    case TimeConverterUtil::TAIMJD:
+    case TimeConverterUtil::TAI:
+    {
+       if (taiValues != origValues)
+          for (Integer i = 0; i < count; ++i)
+             taiValues[i] = origValues[i];
+       break;
+    }
+    case TimeConverterUtil::UTCMJD:
+    case TimeConverterUtil::UTC:
+    {
+       Real offsetValue = 0;
+       if (refJd != GmatTimeConstants::JD_NOV_17_1858)
+          offsetValue = refJd - GmatTimeConstants::JD_NOV_17_1858;
+       
+       if (theLeapSecsFileReader == NULL)
+          throw TimeFileException
+             (wxT("theLeapSecsFileReader is unknown\n"));
+       
+       LeapSecondSpan span;
+       span.isValid = false;
+       for (Integer i = 0; i < count; ++i)
+       {
+          Real numLeapSecs = LeapSecondsFrom(origValues[i] + offsetValue, span);
+          taiValues[i] = origValues[i] +
+                (numLeapSecs/GmatTimeConstants::SECS_PER_DAY);
+       }
+       break;
+    }
+    case TimeConverterUtil::UT1MJD:
+    case TimeConverterUtil::UT1:
+    {
+       if (theEopFile == NULL)
+          throw TimeFileException(wxT("EopFile is unknown\n"));
+       
+       Real offsetValue = 0;
+       if (refJd != GmatTimeConstants::JD_NOV_17_1858)
+          offsetValue = GmatTimeConstants::JD_NOV_17_1858 - refJd;
+       
+       // Take the epochs to UTC in place, then run the UTC pass.  The EopFile
+       // keeps its last table index, so ordered epochs search very little.
+       for (Integer i = 0; i < count; ++i)
+       {
+          Real ut1Offset = theEopFile->GetUt1UtcOffset(origValues[i] +
+                offsetValue);
+          Real utcOffset = theEopFile->GetUt1UtcOffset((origValues[i] +
+                offsetValue) - (ut1Offset/GmatTimeConstants::SECS_PER_DAY));
+          taiValues[i] = origValues[i] -
+                (utcOffset/GmatTimeConstants::SECS_PER_DAY);
+       }
+       TimeConverterUtil::ConvertToTaiMjd(TimeConverterUtil::UTCMJD, taiValues,
+             taiValues, count, refJd);
+       break;
+    }
+    case TimeConverterUtil::TDBMJD:
+    case TimeConverterUtil::TDB:
+    {
+       // Same approximation as the scalar version; sin(2 M_E) comes from the
+       // double angle identity so each epoch needs one sin/cos pair
+       const Real tttOffset = T_TT_OFFSET - refJd;
+       const Real ttOffset =
+             GmatTimeConstants::TT_TAI_OFFSET/GmatTimeConstants::SECS_PER_DAY;
+       for (Integer i = 0; i < count; ++i)
+       {
+          Real t_TT = (origValues[i] - tttOffset) / T_TT_COEFF1;
+          Real m_E = (M_E_OFFSET + (M_E_COEFF1 * t_TT)) *
+                GmatMathConstants::RAD_PER_DEG;
+          Real sinM = sin(m_E);
+          Real cosM = cos(m_E);
+          Real offset = ((TDB_COEFF1 * sinM) + (TDB_COEFF2 * 2.0 * sinM * cosM))
+                / GmatTimeConstants::SECS_PER_DAY;
+          taiValues[i] = origValues[i] - offset - ttOffset;
+       }
+       break;
+    }
+    case TimeConverterUtil::TCBMJD:
+    case TimeConverterUtil::TCB:
+       throw UnimplementedException(
+             wxT("Not Implemented - TCB to TAI"));
+    case TimeConverterUtil::TTMJD:
+    case TimeConverterUtil::TT:
+    {
+       const Real offset =
+             GmatTimeConstants::TT_TAI_OFFSET/GmatTimeConstants::SECS_PER_DAY;
+       for (Integer i = 0; i < count; ++i)
+          taiValues[i] = origValues[i] - offset;
+       break;
+    }
+    default:
+       for (Integer i = 0; i < count; ++i)
+          taiValues[i] = 0.0;
+   }
+}
+
+
+//---------------------------------------------------------------------------
+// void ConvertFromTaiMjd(Integer toType, const Real *taiValues,
+//                        Real *newValues, const Integer count, Real refJd)
+//---------------------------------------------------------------------------
+/**
+ * Batch version of ConvertFromTaiMjd(); newValues may alias taiValues.
+ */
+//---------------------------------------------------------------------------
+void TimeConverterUtil::ConvertFromTaiMjd(Integer toType,
+                                          const Real *taiValues,
+                                          Real *newValues, const Integer count,
+                                          Real refJd)
+{
+   switch (toType)
+   {
+      case TimeConverterUtil::A1MJD:
+      case TimeConverterUtil::A1:
+      {
+         const Real offset =
+               GmatTimeConstants::A1_TAI_OFFSET/GmatTimeConstants::SECS_PER_DAY;
+         for (Integer i = 0; i < count; ++i)
+            newValues[i] = taiValues[i] + offset;
+         break;
+      }
+      case TimeConverterUtil::TAIMJD:
+      case TimeConverterUtil::TAI:
+      {
+         if (newValues != taiValues)
+            for (Integer i = 0; i < count; ++i)
+               newValues[i] = taiValues[i];
+         break;
+      }
+      case TimeConverterUtil::UTCMJD:
+      case TimeConverterUtil::UTC:
+      {
+         Real offsetValue = 0;
+         if (refJd != GmatTimeConstants::JD_NOV_17_1858)
+            offsetValue = refJd - GmatTimeConstants::JD_NOV_17_1858;
+         
+         if (theLeapSecsFileReader == NULL)
+            throw TimeFileException
+               (wxT("theLeapSecsFileReader is unknown\n"));
+         
+         LeapSecondSpan span;
+         span.isValid = false;
+         for (Integer i = 0; i < count; ++i)
+         {
+            Real taiLeapSecs = LeapSecondsFrom(taiValues[i] + offsetValue,
+                  span);
+            Real utcLeapSecs = LeapSecondsFrom((taiValues[i] + offsetValue) -
+                  (taiLeapSecs/GmatTimeConstants::SECS_PER_DAY), span);
+            newValues[i] = taiValues[i] -
+                  (utcLeapSecs/GmatTimeConstants::SECS_PER_DAY);
+         }
+         break;
+      }
+      case TimeConverterUtil::UT1MJD:
+      case TimeConverterUtil::UT1:
+      {
+         if (theEopFile == NULL)
+            throw TimeFileException(
+                  wxT("EopFile is unknown"));
+         
+         Real offsetValue = 0;
+         if (refJd != GmatTimeConstants::JD_NOV_17_1858)
+            offsetValue = refJd - GmatTimeConstants::JD_NOV_17_1858;
+         
+         TimeConverterUtil::ConvertFromTaiMjd(TimeConverterUtil::UTCMJD,
+               taiValues, newValues, count, refJd);
+         for (Integer i = 0; i < count; ++i)
+            newValues[i] += theEopFile->GetUt1UtcOffset(newValues[i] +
+                  offsetValue) / GmatTimeConstants::SECS_PER_DAY;
+         break;
+      }
+      case TimeConverterUtil::TDBMJD:
+      case TimeConverterUtil::TDB:
+      case TimeConverterUtil::TCBMJD:
+      case TimeConverterUtil::TCB:
+      {
+         const Real tttOffset = T_TT_OFFSET - refJd;
+         const Real ttOffset =
+               GmatTimeConstants::TT_TAI_OFFSET/GmatTimeConstants::SECS_PER_DAY;
+         const bool toTcb = ((toType == TimeConverterUtil::TCBMJD) ||
+                             (toType == TimeConverterUtil::TCB));
+         for (Integer i = 0; i < count; ++i)
+         {
+            Real t_TT = (taiValues[i] - tttOffset) / T_TT_COEFF1;
+            Real m_E = (M_E_OFFSET + (M_E_COEFF1 * t_TT)) *
+                  GmatMathConstants::RAD_PER_DEG;
+            Real sinM = sin(m_E);
+            Real cosM = cos(m_E);
+            Real offset = ((TDB_COEFF1 * sinM) +
+                  (TDB_COEFF2 * 2.0 * sinM * cosM)) /
+                  GmatTimeConstants::SECS_PER_DAY;
+            Real tdbMjd = taiValues[i] + ttOffset + offset;
+            if (toTcb)
+               tdbMjd += L_B * ((tdbMjd + refJd) - TCB_JD_MJD_OFFSET);
+            newValues[i] = tdbMjd;
+         }
+         break;
+      }
+      case TimeConverterUtil::TTMJD:
+      case TimeConverterUtil::TT:
+      {
+         const Real offset =
+               GmatTimeConstants::TT_TAI_OFFSET/GmatTimeConstants::SECS_PER_DAY;
+         for (Integer i = 0; i < count; ++i)
+            newValues[i] = taiValues[i] + offset;
+         break;
+      }
+      default:
+         for (Integer i = 0; i < count; ++i)
+            newValues[i] = 0.0;
+   }
+}
+
+
 //---------------------------------------------------------------------------
 // void SetEopFile(EopFile *eopFile)
 //---------------------------------------------------------------------------
@@ -507,6 +865,95 @@ wxString TimeConverterUtil::ConvertMjdToGregorian(const Real mjd,
 }
 
 
+//---------------------------------------------------------------------------
+// Integer FormatMjdToGregorian(const Real mjd, wxChar *buffer,
+//                              Integer format = 1)
+//---------------------------------------------------------------------------
+/**
+ * Writes the Gregorian form of an MJD into a caller supplied buffer.
+ *
+ * The text matches ConvertMjdToGregorian(): the fields come from the same
+ * A1Date, and the seconds use the GregorianDate layout, so they are written
+ * with up to 6 significant digits and no trailing zeros (e.g. "28", "28.5",
+ * "28.1235").  No rounding is applied here, so no carry into the minutes is
+ * needed.  Only the buffer is written, so no strings are built.
+ *
+ * @param  mjd       The epoch to format
+ * @param  buffer    Output; must hold GREGORIAN_BUFFER_SIZE characters
+ * @param  format    1 = wxT("01 Jan 2000 11:59:28.5")
+ *                   2 = wxT("2000-01-01T11:59:28.5")
+ *
+ * @return The number of characters written, not counting the terminator
+ */
+//---------------------------------------------------------------------------
+Integer TimeConverterUtil::FormatMjdToGregorian(const Real mjd, wxChar *buffer,
+                                                Integer format)
+{
+   A1Mjd a1Mjd(mjd);
+   A1Date a1Date = a1Mjd.ToA1Date();
+   
+   Integer year   = a1Date.GetYear();
+   Integer month  = a1Date.GetMonth();
+   Integer day    = a1Date.GetDay();
+   Integer hour   = a1Date.GetHour();
+   Integer minute = a1Date.GetMinute();
+   Real    second = a1Date.GetSecond();
+   
+   wxChar *cursor = buffer;
+   
+   if (format == 2)
+   {
+      if (year < 0)
+      {
+         *cursor++ = wxT('-');
+         year = -year;
+      }
+      cursor = WriteDigits(cursor, year, 2);
+      *cursor++ = wxT('-');
+      cursor = WriteDigits(cursor, month, 2);
+      *cursor++ = wxT('-');
+      cursor = WriteDigits(cursor, day, 2);
+      *cursor++ = wxT('T');
+   }
+   else
+   {
+      cursor = WriteDigits(cursor, day, 2);
+      *cursor++ = wxT(' ');
+      if ((month >= 1) && (month <= 12))
+      {
+         const wxChar *name = GmatTimeConstants::MONTH_NAME_TEXT[month-1].c_str();
+         while (*name != 0)
+            *cursor++ = *name++;
+      }
+      *cursor++ = wxT(' ');
+      if (year < 0)
+      {
+         *cursor++ = wxT('-');
+         year = -year;
+      }
+      cursor = WriteDigits(cursor, year, 2);
+      *cursor++ = wxT(' ');
+   }
+   
+   cursor = WriteDigits(cursor, hour, 2);
+   *cursor++ = wxT(':');
+   cursor = WriteDigits(cursor, minute, 2);
+   *cursor++ = wxT(':');
+   
+   // GregorianDate pads seconds below 10 with one zero, then appends %g
+   if (second < 10.0)
+      *cursor++ = wxT('0');
+   Integer room = GREGORIAN_BUFFER_SIZE - (cursor - buffer);
+   Integer length = wxSnprintf(cursor, room, wxT("%g"), second);
+   if ((length < 0) || (length >= room))
+      length = 0;
+   cursor += length;
+   *cursor = 0;
+   
+   return cursor - buffer;
+}
+
+
 //---------------------------------------------------------------------------
 // Real ConvertGregorianToMjd(const wxString &greg)
 //---------------------------------------------------------------------------
@@ -75,6 +75,9 @@ namespace TimeConverterUtil
    static const Real TCB_JD_MJD_OFFSET             = 2443144.5;
    static const Real NUM_SECS                      = GmatTimeConstants::SECS_PER_DAY;
 
+   /// Buffer length needed by FormatMjdToGregorian(), including terminator
+   static const Integer GREGORIAN_BUFFER_SIZE      = 40;
+
    enum TimeSystemTypes
    {
       A1MJD = 0,
@@ -136,6 +139,19 @@ namespace TimeConverterUtil
    Real GMAT_API ConvertFromTaiMjd(Integer toType, Real origValue,
       Real refJd= GmatTimeConstants::JD_NOV_17_1858);
 
+   // Batch conversions, for arrays of epochs sharing one time system pair
+   void GMAT_API Convert(const Real *origValues, Real *newValues,
+                const Integer count, const Integer fromType,
+                const Integer toType, Real refJd);
+   void GMAT_API Convert(const RealArray &origValues, RealArray &newValues,
+                const Integer fromType, const Integer toType, Real refJd);
+   void GMAT_API ConvertToTaiMjd(Integer fromType, const Real *origValues,
+                Real *taiValues, const Integer count,
+                Real refJd = GmatTimeConstants::JD_NOV_17_1858);
+   void GMAT_API ConvertFromTaiMjd(Integer toType, const Real *taiValues,
+                Real *newValues, const Integer count,
+                Real refJd = GmatTimeConstants::JD_NOV_17_1858);
+
    void GMAT_API SetEopFile(EopFile *eopFile);
    void GMAT_API SetLeapSecsFileReader(LeapSecsFileReader *leapSecsFileReader);
    
@@ -143,6 +159,8 @@ namespace TimeConverterUtil
                                wxString &format);
    
    wxString GMAT_API ConvertMjdToGregorian(const Real mjd, Integer format = 1);   
+   Integer GMAT_API FormatMjdToGregorian(const Real mjd, wxChar *buffer,
+                Integer format = 1);
    Real GMAT_API ConvertGregorianToMjd(const wxString &greg);
    void GMAT_API Convert(const wxString &fromType, Real fromMjd,
                 const wxString &fromStr, const wxString &toType,
@@ -63,6 +63,9 @@ void ShowHelp()
              << "   --save                  Saves current script (interactive mode only)\n"
              << "   --summary               Writes command summary (interactive mode only)\n"
              << "   --verbose <on/off>      Dump info messages to screen during run (default is on)\n"
+             << "   --rerun-cache           Reuses the interpreted mission when an unchanged script\n"
+             << "                           is run again (default is off); only the script file\n"
+             << "                           itself is compared, not #Include, function or data files\n"
              << "   --exit, -x              Exit after run (default)\n"
              << std::endl << std::endl;
 }
@@ -517,6 +520,11 @@ int main(int argc, char *argv[])
                {
                   std::cout << "\nGMAT server currently unavailable to GmatConsole\n ";
                }
+               else if (!strcmp(scriptfile, "--rerun-cache"))
+               {
+                  mod->EnableRerunCache(true);
+                  std::cout << "Rerun cache is on\n";
+               }
                // Options used for some detailed tests but hidden from casual users
                // (i.e. missing from the help messages)
                else if (!strcmp(scriptfile, "--DumpDEData"))
@@ -656,6 +664,10 @@ int main(int argc, char *argv[])
                      RunBatch(batchToRun);
                   }
                }
+               else if (arg == "--rerun-cache")
+               {
+                  mod->EnableRerunCache(true);
+               }
                else if ((arg == "--exit") || (arg == "-x"))
                {
                   ; // ignored - console always exits at end of non-interactive run